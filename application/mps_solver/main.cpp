@@ -19,7 +19,8 @@ int main([[maybe_unused]] int argc, char *argv[]) {
      */
     if (argv[1] == nullptr) {
         std::cout << "Usage: ./mps_solver.exe [-p OPTION_FILE_NAME] [-i "
-                     "INITIAL_SOLUTION_FILE_NAME] [--separate] mps_file"
+                     "INITIAL_SOLUTION_FILE_NAME] [-r CHECKPOINT_FILE_NAME] "
+                     "[--separate] mps_file"
                   << std::endl;
         std::cout << std::endl;
         std::cout  //
@@ -28,6 +29,10 @@ int main([[maybe_unused]] int argc, char *argv[]) {
             << "  -i INITIAL_SOLUTION_FILE_NAME: Specify initial solution "
                "file name."
             << std::endl;
+        std::cout  //
+            << "  -r CHECKPOINT_FILE_NAME: Resume the search from the "
+               "checkpoint file written by a previous run."
+            << std::endl;
         std::cout  //
             << "  --separate: Separate equality constraints into lower "
                "and upper constraints."
@@ -45,6 +50,7 @@ int main([[maybe_unused]] int argc, char *argv[]) {
     std::string mps_file_name;
     std::string option_file_name;
     std::string initial_solution_file_name;
+    std::string checkpoint_file_name;
     bool        is_enabled_separate_equality = false;
     bool        accept_continuous_variables  = false;
 
@@ -57,6 +63,9 @@ int main([[maybe_unused]] int argc, char *argv[]) {
         } else if (args[i] == "-i") {
             initial_solution_file_name = args[i + 1];
             i += 2;
+        } else if (args[i] == "-r") {
+            checkpoint_file_name = args[i + 1];
+            i += 2;
         } else if (args[i] == "--separate") {
             is_enabled_separate_equality = true;
             i++;
@@ -93,16 +102,20 @@ int main([[maybe_unused]] int argc, char *argv[]) {
      * variables in the file will be used as the initial values. Otherwise, the
      * default values will be used.
      */
+    std::unordered_map<std::string, int> initial_solution;
     if (!initial_solution_file_name.empty()) {
-        auto solution =
+        initial_solution =
             printemps::utility::read_solution(initial_solution_file_name);
-        model.import_solution(solution);
+        model.import_solution(initial_solution);
     }
 
     /**
-     * Run the solver.
+     * Run the solver. If the checkpoint file is given, the search is resumed
+     * from it. If the multi-start search is enabled, each chain builds its
+     * own model from the MPS data read above.
      */
-    auto result = printemps::solver::solve(&model, option);
+    auto result = printemps::utility::solve_mps_model(
+        &mps_reader, &model, option, initial_solution, checkpoint_file_name);
 
     /**
      * Print the result summary.
@@ -119,6 +132,13 @@ int main([[maybe_unused]] int argc, char *argv[]) {
         "total violation: " + std::to_string(result.solution.total_violation()),
         option.verbose >= printemps::solver::Verbose::Warning);
 
+    if (result.status.is_found_lagrangian_bound) {
+        printemps::utility::print_info(
+            "lagrangian bound: " +
+                std::to_string(result.status.lagrangian_bound),
+            option.verbose >= printemps::solver::Verbose::Warning);
+    }
+
     auto summary = model.export_summary();
     result.solution.write_json_by_name("incumbent.json", summary);
     result.solution.write_solution("incumbent.sol");
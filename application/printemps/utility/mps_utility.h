@@ -526,6 +526,9 @@ MPS read_mps(const std::string &a_FILE_NAME) {
 class MPSReader {
    private:
     model::IPModel m_model;
+    MPS            m_mps;
+    bool           m_is_enabled_separate_equality;
+    bool           m_accept_continuous;
 
    public:
     /*************************************************************************/
@@ -541,6 +544,9 @@ class MPSReader {
     /*************************************************************************/
     void initialize(void) {
         m_model.initialize();
+        m_mps.initialize();
+        m_is_enabled_separate_equality = false;
+        m_accept_continuous            = false;
     }
 
     /*************************************************************************/
@@ -548,11 +554,31 @@ class MPSReader {
         const std::string &a_FILE_NAME,
         const bool         a_IS_ENABLED_SEPARATE_EQUALITY,
         const bool         a_ACCEPT_CONTINUOUS) {
-        MPS mps = read_mps(a_FILE_NAME);
+        m_mps                          = read_mps(a_FILE_NAME);
+        m_is_enabled_separate_equality = a_IS_ENABLED_SEPARATE_EQUALITY;
+        m_accept_continuous            = a_ACCEPT_CONTINUOUS;
+
+        this->build_model(&m_model, true);
+        return m_model;
+    }
+
+    /*************************************************************************/
+    void build_model(model::IPModel *a_model,
+                     const bool      a_IS_ENABLED_PRINT) const {
+        /**
+         * This method builds a model from the MPS data read by
+         * create_model_from_mps(). It does not modify the reader, so that it
+         * can be called concurrently, e.g., as the model builder of the
+         * multi-start search. The warnings are printed only if
+         * a_IS_ENABLED_PRINT is true, so that the concurrent calls do not
+         * repeat the ones already printed by create_model_from_mps().
+         */
+        const auto &mps = m_mps;
+
         std::unordered_map<std::string, model::IPVariable *> variable_ptrs;
 
         auto &variable_proxy =
-            m_model.create_variables("variables", mps.variables.size());
+            a_model->create_variables("variables", mps.variables.size());
 
         /**
          * Set up the decision variables.
@@ -561,14 +587,14 @@ class MPSReader {
 
         for (auto i = 0; i < number_of_variables; i++) {
             auto &name     = mps.variable_names[i];
-            auto &variable = mps.variables[name];
+            auto &variable = mps.variables.at(name);
 
             if (variable.sense == MPSVariableSense::Continuous) {
-                if (a_ACCEPT_CONTINUOUS) {
+                if (m_accept_continuous) {
                     utility::print_warning(
                         "The continuous variable " + name +
                             " will be regarded as an integer variable.",
-                        true);
+                        a_IS_ENABLED_PRINT);
                 } else {
                     throw std::logic_error(utility::format_error_location(
                         __FILE__, __LINE__, __func__,
@@ -594,21 +620,21 @@ class MPSReader {
         int mod_number_of_constraints = raw_number_of_constraints;
         std::vector<int> offsets(raw_number_of_constraints);
 
-        if (a_IS_ENABLED_SEPARATE_EQUALITY) {
+        if (m_is_enabled_separate_equality) {
             mod_number_of_constraints = mps.number_of_lower_constraints +
                                         2 * mps.number_of_equal_constraints +
                                         mps.number_of_upper_constraints;
         }
 
-        auto &constraint_proxy = m_model.create_constraints(
+        auto &constraint_proxy = a_model->create_constraints(
             "constraints", mod_number_of_constraints);
 
         int offset = 0;
         for (auto i = 0; i < raw_number_of_constraints; i++) {
             auto &name       = mps.constraint_names[i];
-            auto &constraint = mps.constraints[name];
+            auto &constraint = mps.constraints.at(name);
             offsets[i]       = offset++;
-            if (a_IS_ENABLED_SEPARATE_EQUALITY &&
+            if (m_is_enabled_separate_equality &&
                 (constraint.sense == MPSConstraintSense::Equal)) {
                 offset++;
             }
@@ -618,7 +644,7 @@ class MPSReader {
 #endif
         for (auto i = 0; i < raw_number_of_constraints; i++) {
             auto &name       = mps.constraint_names[i];
-            auto &constraint = mps.constraints[name];
+            auto &constraint = mps.constraints.at(name);
             int   offset     = offsets[i];
             auto  expression = model::IPExpression::create_instance();
 
@@ -640,7 +666,7 @@ class MPSReader {
                 }
 
                 case MPSConstraintSense::Equal: {
-                    if (a_IS_ENABLED_SEPARATE_EQUALITY) {
+                    if (m_is_enabled_separate_equality) {
                         constraint_proxy(offset) =
                             (expression <= constraint.rhs);
                         constraint_proxy(offset).set_name(name + "_lower");
@@ -676,9 +702,7 @@ class MPSReader {
             objective_sensitivities[variable_ptrs[variable_name]] = coefficient;
         }
         objective.set_sensitivities(objective_sensitivities);
-        m_model.minimize(objective);
-
-        return m_model;
+        a_model->minimize(objective);
     }
 };
 
@@ -729,6 +753,54 @@ std::unordered_map<std::string, int> read_solution(
 
     return solution;
 }
+
+/*****************************************************************************/
+solver::Result<int, double> solve_mps_model(
+    const MPSReader *                           a_MPS_READER,
+    model::IPModel *                            a_model,
+    const solver::Option &                      a_OPTION,
+    const std::unordered_map<std::string, int> &a_INITIAL_SOLUTION,
+    const std::string &                         a_CHECKPOINT_FILE_NAME) {
+    /**
+     * This function solves the model created by
+     * MPSReader::create_model_from_mps(). If the checkpoint file name is
+     * given, the search is resumed from the checkpoint written by a previous
+     * run. If the multi-start search is enabled, each chain builds its own
+     * model from the MPS data, and the given model is not solved. Its
+     * variables and constraints are categorized instead, so that the summary
+     * exported from it is the same as that of the single-start search.
+     */
+    if (!a_CHECKPOINT_FILE_NAME.empty()) {
+        if (a_OPTION.is_enabled_multi_start) {
+            utility::print_warning(
+                "The multi-start search was disabled because the search is "
+                "resumed from the checkpoint.",
+                a_OPTION.verbose >= solver::Verbose::Warning);
+        }
+        return solver::resume(a_model, a_OPTION, a_CHECKPOINT_FILE_NAME);
+    }
+
+    if (!a_OPTION.is_enabled_multi_start) {
+        return solver::solve(a_model, a_OPTION);
+    }
+
+    auto model_builder = [a_MPS_READER, a_model, &a_INITIAL_SOLUTION](
+                             model::IPModel *a_chain_model) {
+        a_MPS_READER->build_model(a_chain_model, false);
+        a_chain_model->set_name(a_model->name());
+        if (!a_INITIAL_SOLUTION.empty()) {
+            a_chain_model->import_solution(a_INITIAL_SOLUTION);
+        }
+    };
+
+    auto result =
+        solver::multi_start::solve<int, double>(model_builder, a_OPTION);
+
+    a_model->categorize_variables();
+    a_model->categorize_constraints();
+
+    return result;
+}
 }  // namespace utility
 }  // namespace printemps
 #endif
@@ -94,6 +94,12 @@ printemps::solver::Option read_option(const std::string &a_FILE_NAME) {
               "is_enabled_local_search",        //
               option_object);
 
+    /**************************************************************************/
+    /// is_enabled_multi_start
+    read_json(&option.is_enabled_multi_start,  //
+              "is_enabled_multi_start",        //
+              option_object);
+
     /**************************************************************************/
     /// is_enabled_grouping_penalty_coefficient
     read_json(&option.is_enabled_grouping_penalty_coefficient,  //
@@ -124,6 +130,18 @@ printemps::solver::Option read_option(const std::string &a_FILE_NAME) {
               "is_enabled_parallel_neighborhood_update",        //
               option_object);
 
+    /**********************************************************************/
+    /// is_enabled_adaptive_parallelization
+    read_json(&option.is_enabled_adaptive_parallelization,  //
+              "is_enabled_adaptive_parallelization",        //
+              option_object);
+
+    /**********************************************************************/
+    /// parallel_size_threshold
+    read_json(&option.parallel_size_threshold,  //
+              "parallel_size_threshold",        //
+              option_object);
+
     /**********************************************************************/
     /// is_enabled_binary_move
     read_json(&option.is_enabled_binary_move,  //
@@ -232,6 +250,42 @@ printemps::solver::Option read_option(const std::string &a_FILE_NAME) {
               "historical_data_capacity",        //
               option_object);
 
+    /**************************************************************************/
+    /// is_enabled_profile
+    read_json(&option.is_enabled_profile,  //
+              "is_enabled_profile",        //
+              option_object);
+
+    /**************************************************************************/
+    /// trace_mode
+    read_json(&option.trace_mode,  //
+              "trace_mode",        //
+              option_object);
+
+    /**************************************************************************/
+    /// trace_file_name
+    read_json(&option.trace_file_name,  //
+              "trace_file_name",        //
+              option_object);
+
+    /**************************************************************************/
+    /// is_enabled_checkpoint
+    read_json(&option.is_enabled_checkpoint,  //
+              "is_enabled_checkpoint",        //
+              option_object);
+
+    /**************************************************************************/
+    /// checkpoint_file_name
+    read_json(&option.checkpoint_file_name,  //
+              "checkpoint_file_name",        //
+              option_object);
+
+    /**************************************************************************/
+    /// checkpoint_interval
+    read_json(&option.checkpoint_interval,  //
+              "checkpoint_interval",        //
+              option_object);
+
     /**************************************************************************/
     /// lagrange dual
     /**************************************************************************/
@@ -289,6 +343,18 @@ printemps::solver::Option read_option(const std::string &a_FILE_NAME) {
         read_json(&option.lagrange_dual.log_interval,  //
                   "log_interval",                      //
                   option_object_lagrange_dual);
+
+        /**********************************************************************/
+        /// lagrange_dual.method
+        read_json(&option.lagrange_dual.method,  //
+                  "method",                      //
+                  option_object_lagrange_dual);
+
+        /**********************************************************************/
+        /// lagrange_dual.volume_averaging_rate_max
+        read_json(&option.lagrange_dual.volume_averaging_rate_max,  //
+                  "volume_averaging_rate_max",                      //
+                  option_object_lagrange_dual);
     }
 
     /**************************************************************************/
@@ -488,6 +554,18 @@ printemps::solver::Option read_option(const std::string &a_FILE_NAME) {
                   "number_of_initial_modification",                    //
                   option_object_tabu_search);
 
+        /**********************************************************************/
+        /// tabu_search.is_enabled_move_evaluation_cache
+        read_json(&option.tabu_search.is_enabled_move_evaluation_cache,  //
+                  "is_enabled_move_evaluation_cache",                    //
+                  option_object_tabu_search);
+
+        /**********************************************************************/
+        /// tabu_search.is_enabled_binary_flip_evaluation
+        read_json(&option.tabu_search.is_enabled_binary_flip_evaluation,  //
+                  "is_enabled_binary_flip_evaluation",                    //
+                  option_object_tabu_search);
+
         /**********************************************************************/
         /// tabu_search.seed
         read_json(&option.tabu_search.seed,  //
@@ -495,6 +573,41 @@ printemps::solver::Option read_option(const std::string &a_FILE_NAME) {
                   option_object_tabu_search);
     }
 
+    /**************************************************************************/
+    /// multi start
+    /**************************************************************************/
+    nlohmann::json option_object_multi_start;
+
+    bool has_multi_start_option = read_json(&option_object_multi_start,  //
+                                            "multi_start",               //
+                                            option_object);
+
+    if (has_multi_start_option) {
+        /**********************************************************************/
+        /// multi_start.number_of_chains
+        read_json(&option.multi_start.number_of_chains,  //
+                  "number_of_chains",                    //
+                  option_object_multi_start);
+
+        /**********************************************************************/
+        /// multi_start.number_of_rounds
+        read_json(&option.multi_start.number_of_rounds,  //
+                  "number_of_rounds",                    //
+                  option_object_multi_start);
+
+        /**********************************************************************/
+        /// multi_start.migration_rate
+        read_json(&option.multi_start.migration_rate,  //
+                  "migration_rate",                    //
+                  option_object_multi_start);
+
+        /**********************************************************************/
+        /// multi_start.is_enabled_parallel_chains
+        read_json(&option.multi_start.is_enabled_parallel_chains,  //
+                  "is_enabled_parallel_chains",                    //
+                  option_object_multi_start);
+    }
+
     return option;
 }
 }  // namespace utility
@@ -0,0 +1,255 @@
+/*****************************************************************************/
+// Copyright (c) 2020 Yuji KOGUMA
+// Released under the MIT license
+// https://opensource.org/licenses/mit-license.php
+/*****************************************************************************/
+#ifndef PRINTEMPS_BENCHMARK_BENCHMARK_INSTANCE_H__
+#define PRINTEMPS_BENCHMARK_BENCHMARK_INSTANCE_H__
+
+#include <random>
+#include <printemps.h>
+
+namespace printemps_benchmark {
+/*****************************************************************************/
+struct BenchmarkInstanceConstant {
+    static constexpr int SEED = 1;
+};
+
+/*****************************************************************************/
+struct QuadraticAssignmentInstance {
+    int                              N;
+    std::vector<std::vector<double>> A;
+    std::vector<std::vector<double>> B;
+};
+
+/*****************************************************************************/
+inline void build_set_partitioning(printemps::model::IPModel* a_model,
+                                   const int                  a_NUMBER_OF_ROWS) {
+    /**
+     * This function builds a synthetic set partitioning problem with
+     * a_NUMBER_OF_ROWS rows and 10 * a_NUMBER_OF_ROWS columns. Each column
+     * covers 2 to 5 randomly chosen rows, and the first a_NUMBER_OF_ROWS
+     * columns are singletons so that the instance is feasible.
+     */
+    std::mt19937 get_rand_mt(BenchmarkInstanceConstant::SEED);
+
+    const int NUMBER_OF_ROWS    = a_NUMBER_OF_ROWS;
+    const int NUMBER_OF_COLUMNS = 10 * a_NUMBER_OF_ROWS;
+
+    auto& x = a_model->create_variables("x", NUMBER_OF_COLUMNS, 0, 1);
+    auto& covers = a_model->create_expressions("covers", NUMBER_OF_ROWS);
+    auto& cost   = a_model->create_expression("cost");
+
+    for (auto j = 0; j < NUMBER_OF_COLUMNS; j++) {
+        if (j < NUMBER_OF_ROWS) {
+            covers(j) += x(j);
+            cost += 100 * x(j);
+            continue;
+        }
+        const int NUMBER_OF_COVERED_ROWS = 2 + get_rand_mt() % 4;
+        for (auto k = 0; k < NUMBER_OF_COVERED_ROWS; k++) {
+            const int ROW = get_rand_mt() % NUMBER_OF_ROWS;
+            covers(ROW) += x(j);
+        }
+        cost += static_cast<int>(1 + get_rand_mt() % 100) * x(j);
+    }
+
+    auto& partitionings =
+        a_model->create_constraints("partitionings", NUMBER_OF_ROWS);
+    for (auto i = 0; i < NUMBER_OF_ROWS; i++) {
+        partitionings(i) = (covers(i) == 1);
+    }
+    a_model->minimize(cost);
+
+    for (auto j = 0; j < NUMBER_OF_COLUMNS; j++) {
+        x(j) = (j < NUMBER_OF_ROWS) ? 1 : 0;
+    }
+}
+
+/*****************************************************************************/
+inline void build_knapsack(printemps::model::IPModel* a_model,
+                           const int                  a_NUMBER_OF_ITEMS) {
+    /**
+     * This function builds a synthetic knapsack problem with weight and volume
+     * capacities, in the same manner as example/knapsack.cpp.
+     */
+    std::mt19937 get_rand_mt(BenchmarkInstanceConstant::SEED);
+
+    const int NUMBER_OF_ITEMS = a_NUMBER_OF_ITEMS;
+
+    std::vector<int> weights;
+    std::vector<int> volumes;
+    std::vector<int> prices;
+
+    for (auto n = 0; n < NUMBER_OF_ITEMS; n++) {
+        prices.push_back(get_rand_mt() % 100);
+        weights.push_back(prices.back() + get_rand_mt() % 10);
+        volumes.push_back(prices.back() + get_rand_mt() % 10);
+    }
+
+    auto& x = a_model->create_variables("x", NUMBER_OF_ITEMS, 0, 1);
+
+    auto& total_weight =
+        a_model->create_expression("total_weight", x.dot(weights));
+    auto& total_volume =
+        a_model->create_expression("total_volume", x.dot(volumes));
+    auto& total_price =
+        a_model->create_expression("total_price", x.dot(prices));
+
+    a_model->create_constraint("total_weight",
+                               total_weight <= 15 * NUMBER_OF_ITEMS);
+    a_model->create_constraint("total_volume",
+                               total_volume <= 15 * NUMBER_OF_ITEMS);
+    a_model->maximize(total_price);
+
+    for (auto n = 0; n < NUMBER_OF_ITEMS; n++) {
+        x(n) = 0;
+    }
+}
+
+/*****************************************************************************/
+inline void build_quadratic_assignment(
+    printemps::model::IPModel*   a_model,     //
+    QuadraticAssignmentInstance* a_instance,  //
+    const int                    a_N) {
+    /**
+     * This function builds a synthetic quadratic assignment problem of size
+     * a_N with random flow and distance matrices, in the same manner as
+     * example/quadratic_assignment.cpp. The problem is formulated with a
+     * nonlinear objective function and user-defined swap moves. The matrices
+     * are stored in a_instance, which must outlive a_model.
+     */
+    std::mt19937 get_rand_mt(BenchmarkInstanceConstant::SEED);
+
+    auto& qap = *a_instance;
+    qap.N     = a_N;
+    qap.A.assign(qap.N, std::vector<double>(qap.N, 0.0));
+    qap.B.assign(qap.N, std::vector<double>(qap.N, 0.0));
+    for (auto n = 0; n < qap.N; n++) {
+        for (auto m = 0; m < qap.N; m++) {
+            qap.A[n][m] = get_rand_mt() % 10;
+            qap.B[n][m] = get_rand_mt() % 10;
+        }
+    }
+
+    auto& p = a_model->create_variables("p", qap.N, 0, qap.N - 1);
+
+    std::function<double(const printemps::model::IPMove&)> f =
+        [&qap, &p](const printemps::model::IPMove& a_MOVE) {
+            double           f = 0.0;
+            std::vector<int> p_values(qap.N);
+            for (auto n = 0; n < qap.N; n++) {
+                p_values[n] = p(n).evaluate(a_MOVE);
+            }
+            for (auto n = 0; n < qap.N; n++) {
+                for (auto m = 0; m < qap.N; m++) {
+                    f += qap.A[n][m] * qap.B[p_values[n]][p_values[m]];
+                }
+            }
+            return f;
+        };
+    a_model->minimize(f);
+
+    for (auto n = 0; n < qap.N; n++) {
+        p(n) = n;
+    }
+
+    std::function<void(std::vector<printemps::model::IPMove>*)> move_updater =
+        [&qap, &p](std::vector<printemps::model::IPMove>* a_moves) {
+            a_moves->resize(qap.N * (qap.N - 1) / 2);
+            auto count = 0;
+            for (auto n = 0; n < qap.N; n++) {
+                for (auto m = n + 1; m < qap.N; m++) {
+                    (*a_moves)[count].alterations.clear();
+                    (*a_moves)[count].alterations.emplace_back(&p(n),
+                                                               p(m).value());
+                    (*a_moves)[count].alterations.emplace_back(&p(m),
+                                                               p(n).value());
+                    count++;
+                }
+            }
+        };
+    a_model->neighborhood().set_user_defined_move_updater(move_updater);
+}
+
+/*****************************************************************************/
+inline void setup_model(printemps::model::IPModel* a_model,
+                        const bool a_IS_ENABLED_USER_DEFINED_MOVE) {
+    /**
+     * This function sets up the model as printemps::solver::solve() does, so
+     * that the candidate moves can be generated and evaluated.
+     */
+    printemps::solver::Option option;
+    option.is_enabled_presolve = false;
+
+    a_model->setup(option.is_enabled_presolve,                 //
+                   option.is_enabled_initial_value_correction,  //
+                   false,                                       //
+                   false,                                       //
+                   false,                                       //
+                   false,                                       //
+                   a_IS_ENABLED_USER_DEFINED_MOVE,              //
+                   false,                                       //
+                   printemps::model::SelectionMode::None,       //
+                   false);
+
+    if (a_IS_ENABLED_USER_DEFINED_MOVE) {
+        a_model->neighborhood().enable_user_defined_move();
+    } else {
+        a_model->neighborhood().enable_binary_move();
+        a_model->neighborhood().enable_integer_move();
+    }
+
+    for (auto&& proxy : a_model->constraint_proxies()) {
+        for (auto&& constraint : proxy.flat_indexed_constraints()) {
+            constraint.local_penalty_coefficient() =
+                option.initial_penalty_coefficient;
+            constraint.global_penalty_coefficient() =
+                option.initial_penalty_coefficient;
+        }
+    }
+    a_model->update();
+    a_model->neighborhood().update_moves(true, false, false, false);
+}
+
+/*****************************************************************************/
+enum class InstanceType { SetPartitioning, Knapsack, QuadraticAssignment };
+
+/*****************************************************************************/
+struct BenchmarkInstance {
+    /**
+     * BenchmarkInstance owns a synthetic model which is set up and ready to
+     * evaluate the candidate moves. The benchmark argument a_SIZE is the
+     * number of rows, items, or facilities, respectively.
+     */
+    printemps::model::IPModel   model;
+    QuadraticAssignmentInstance quadratic_assignment;
+
+    /*************************************************************************/
+    BenchmarkInstance(const InstanceType a_TYPE, const int a_SIZE) {
+        switch (a_TYPE) {
+            case InstanceType::SetPartitioning: {
+                build_set_partitioning(&model, a_SIZE);
+                setup_model(&model, false);
+                break;
+            }
+            case InstanceType::Knapsack: {
+                build_knapsack(&model, a_SIZE);
+                setup_model(&model, false);
+                break;
+            }
+            case InstanceType::QuadraticAssignment: {
+                build_quadratic_assignment(&model, &quadratic_assignment,
+                                           a_SIZE);
+                setup_model(&model, true);
+                break;
+            }
+        }
+    }
+};
+}  // namespace printemps_benchmark
+
+#endif
+/*****************************************************************************/
+// END
+/*****************************************************************************/
@@ -0,0 +1,54 @@
+/*****************************************************************************/
+// Copyright (c) 2020 Yuji KOGUMA
+// Released under the MIT license
+// https://opensource.org/licenses/mit-license.php
+/*****************************************************************************/
+#include <benchmark/benchmark.h>
+#include <printemps.h>
+
+#include "../benchmark_instance.h"
+
+namespace {
+using printemps_benchmark::BenchmarkInstance;
+using printemps_benchmark::InstanceType;
+
+/*****************************************************************************/
+void BM_ExpressionEvaluateMove(benchmark::State& a_state,
+                               const InstanceType a_TYPE) {
+    /**
+     * Evaluate the objective function expression for all of the candidate
+     * moves.
+     */
+    BenchmarkInstance instance(a_TYPE, a_state.range(0));
+
+    auto& model      = instance.model;
+    auto& move_ptrs  = model.neighborhood().move_ptrs();
+    auto& expression = model.objective().expression();
+
+    const int MOVES_SIZE = move_ptrs.size();
+
+    for (auto _ : a_state) {
+        for (auto i = 0; i < MOVES_SIZE; i++) {
+            benchmark::DoNotOptimize(expression.evaluate(*move_ptrs[i]));
+        }
+    }
+    a_state.SetItemsProcessed(a_state.iterations() * MOVES_SIZE);
+}
+
+/*****************************************************************************/
+BENCHMARK_CAPTURE(BM_ExpressionEvaluateMove, set_partitioning,
+                  InstanceType::SetPartitioning)
+    ->Arg(100)
+    ->Arg(1000)
+    ->Arg(5000)
+    ->Unit(benchmark::kMicrosecond);
+
+BENCHMARK_CAPTURE(BM_ExpressionEvaluateMove, knapsack, InstanceType::Knapsack)
+    ->Arg(1000)
+    ->Arg(10000)
+    ->Arg(100000)
+    ->Unit(benchmark::kMicrosecond);
+}  // namespace
+/*****************************************************************************/
+// END
+/*****************************************************************************/
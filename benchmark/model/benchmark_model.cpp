@@ -0,0 +1,106 @@
+/*****************************************************************************/
+// Copyright (c) 2020 Yuji KOGUMA
+// Released under the MIT license
+// https://opensource.org/licenses/mit-license.php
+/*****************************************************************************/
+#include <benchmark/benchmark.h>
+#include <printemps.h>
+
+#include "../benchmark_instance.h"
+
+namespace {
+using printemps_benchmark::BenchmarkInstance;
+using printemps_benchmark::InstanceType;
+
+/*****************************************************************************/
+void BM_ModelEvaluateFast(benchmark::State& a_state,
+                          const InstanceType a_TYPE) {
+    /**
+     * Evaluate all of the candidate moves by the fast (differential)
+     * evaluation, which is used in the tabu search.
+     */
+    BenchmarkInstance instance(a_TYPE, a_state.range(0));
+
+    auto& model     = instance.model;
+    auto& move_ptrs = model.neighborhood().move_ptrs();
+
+    const int  MOVES_SIZE    = move_ptrs.size();
+    const auto CURRENT_SCORE = model.evaluate({});
+
+    printemps::model::SolutionScore score;
+    for (auto _ : a_state) {
+        for (auto i = 0; i < MOVES_SIZE; i++) {
+            model.evaluate(&score, *move_ptrs[i], CURRENT_SCORE);
+            benchmark::DoNotOptimize(score);
+        }
+    }
+    a_state.SetItemsProcessed(a_state.iterations() * MOVES_SIZE);
+}
+
+/*****************************************************************************/
+void BM_ModelEvaluateSlow(benchmark::State& a_state,
+                          const InstanceType a_TYPE) {
+    /**
+     * Evaluate all of the candidate moves by the slow evaluation, which
+     * evaluates all of the constraints from scratch.
+     */
+    BenchmarkInstance instance(a_TYPE, a_state.range(0));
+
+    auto& model     = instance.model;
+    auto& move_ptrs = model.neighborhood().move_ptrs();
+
+    const int MOVES_SIZE = move_ptrs.size();
+
+    printemps::model::SolutionScore score;
+    for (auto _ : a_state) {
+        for (auto i = 0; i < MOVES_SIZE; i++) {
+            model.evaluate(&score, *move_ptrs[i]);
+            benchmark::DoNotOptimize(score);
+        }
+    }
+    a_state.SetItemsProcessed(a_state.iterations() * MOVES_SIZE);
+}
+
+/*****************************************************************************/
+BENCHMARK_CAPTURE(BM_ModelEvaluateFast, set_partitioning,
+                  InstanceType::SetPartitioning)
+    ->Arg(100)
+    ->Arg(1000)
+    ->Arg(5000)
+    ->Unit(benchmark::kMicrosecond);
+
+BENCHMARK_CAPTURE(BM_ModelEvaluateFast, knapsack, InstanceType::Knapsack)
+    ->Arg(1000)
+    ->Arg(10000)
+    ->Arg(100000)
+    ->Unit(benchmark::kMicrosecond);
+
+BENCHMARK_CAPTURE(BM_ModelEvaluateFast, quadratic_assignment,
+                  InstanceType::QuadraticAssignment)
+    ->Arg(12)
+    ->Arg(24)
+    ->Arg(48)
+    ->Unit(benchmark::kMicrosecond);
+
+/*****************************************************************************/
+BENCHMARK_CAPTURE(BM_ModelEvaluateSlow, set_partitioning,
+                  InstanceType::SetPartitioning)
+    ->Arg(100)
+    ->Arg(1000)
+    ->Unit(benchmark::kMicrosecond);
+
+BENCHMARK_CAPTURE(BM_ModelEvaluateSlow, knapsack, InstanceType::Knapsack)
+    ->Arg(1000)
+    ->Arg(10000)
+    ->Unit(benchmark::kMicrosecond);
+
+BENCHMARK_CAPTURE(BM_ModelEvaluateSlow, quadratic_assignment,
+                  InstanceType::QuadraticAssignment)
+    ->Arg(12)
+    ->Arg(24)
+    ->Arg(48)
+    ->Unit(benchmark::kMicrosecond);
+}  // namespace
+/*****************************************************************************/
+// END
+/*****************************************************************************/
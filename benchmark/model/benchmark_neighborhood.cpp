@@ -0,0 +1,57 @@
+/*****************************************************************************/
+// Copyright (c) 2020 Yuji KOGUMA
+// Released under the MIT license
+// https://opensource.org/licenses/mit-license.php
+/*****************************************************************************/
+#include <benchmark/benchmark.h>
+#include <printemps.h>
+
+#include "../benchmark_instance.h"
+
+namespace {
+using printemps_benchmark::BenchmarkInstance;
+using printemps_benchmark::InstanceType;
+
+/*****************************************************************************/
+void BM_NeighborhoodUpdateMoves(benchmark::State& a_state,
+                                const InstanceType a_TYPE) {
+    /**
+     * Update all of the candidate moves from the current solution.
+     */
+    BenchmarkInstance instance(a_TYPE, a_state.range(0));
+
+    auto& neighborhood = instance.model.neighborhood();
+
+    for (auto _ : a_state) {
+        neighborhood.update_moves(true, false, false, false);
+        benchmark::DoNotOptimize(neighborhood.move_ptrs().data());
+    }
+    a_state.SetItemsProcessed(a_state.iterations() *
+                              neighborhood.move_ptrs().size());
+}
+
+/*****************************************************************************/
+BENCHMARK_CAPTURE(BM_NeighborhoodUpdateMoves, set_partitioning,
+                  InstanceType::SetPartitioning)
+    ->Arg(100)
+    ->Arg(1000)
+    ->Arg(5000)
+    ->Unit(benchmark::kMicrosecond);
+
+BENCHMARK_CAPTURE(BM_NeighborhoodUpdateMoves, knapsack,
+                  InstanceType::Knapsack)
+    ->Arg(1000)
+    ->Arg(10000)
+    ->Arg(100000)
+    ->Unit(benchmark::kMicrosecond);
+
+BENCHMARK_CAPTURE(BM_NeighborhoodUpdateMoves, quadratic_assignment,
+                  InstanceType::QuadraticAssignment)
+    ->Arg(12)
+    ->Arg(24)
+    ->Arg(48)
+    ->Unit(benchmark::kMicrosecond);
+}  // namespace
+/*****************************************************************************/
+// END
+/*****************************************************************************/
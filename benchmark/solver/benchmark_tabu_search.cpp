@@ -0,0 +1,88 @@
+/*****************************************************************************/
+// Copyright (c) 2020 Yuji KOGUMA
+// Released under the MIT license
+// https://opensource.org/licenses/mit-license.php
+/*****************************************************************************/
+#include <benchmark/benchmark.h>
+#include <printemps.h>
+
+#include "../benchmark_instance.h"
+
+namespace {
+using printemps_benchmark::BenchmarkInstance;
+using printemps_benchmark::InstanceType;
+
+/*****************************************************************************/
+void BM_TabuSearchSolve(benchmark::State& a_state, const InstanceType a_TYPE) {
+    /**
+     * Run the tabu search for a fixed number of iterations. The setup of the
+     * search (e.g. the memory, the move evaluation cache, and the initial
+     * evaluation of the model) is included in the measured time, and it is
+     * amortized over the iterations. The number of the processed items is
+     * the number of the iterations.
+     */
+    BenchmarkInstance instance(a_TYPE, a_state.range(0));
+
+    auto& model = instance.model;
+
+    const int ITERATION_MAX = 100;
+
+    printemps::solver::Option option;
+    option.verbose                      = printemps::solver::None;
+    option.improvability_screening_mode = printemps::solver::Off;
+    option.tabu_search.iteration_max    = ITERATION_MAX;
+
+    option.tabu_search.is_enabled_automatic_break      = false;
+    option.tabu_search.is_enabled_initial_modification = false;
+
+    const auto INITIAL_VARIABLE_VALUES =
+        model.export_compact_solution().variables;
+
+    printemps::solver::IncumbentHolder<int, double> incumbent_holder;
+    printemps::solver::Memory                       memory(&model);
+
+    /**
+     * The calibration is disabled since every run of the benchmark starts
+     * from the same parallel controller.
+     */
+    printemps::solver::ParallelController parallel_controller;
+    parallel_controller.setup(option.is_enabled_parallel_neighborhood_update,
+                              option.is_enabled_parallel_evaluation,  //
+                              false,                                  //
+                              option.parallel_size_threshold);
+
+    long number_of_iterations = 0;
+    for (auto _ : a_state) {
+        auto result = printemps::solver::tabu_search::solve(
+            &model, option, INITIAL_VARIABLE_VALUES, incumbent_holder, &memory,
+            parallel_controller);
+        benchmark::DoNotOptimize(result.number_of_iterations);
+        number_of_iterations += result.number_of_iterations;
+    }
+    a_state.SetItemsProcessed(number_of_iterations);
+}
+
+/*****************************************************************************/
+BENCHMARK_CAPTURE(BM_TabuSearchSolve, set_partitioning,
+                  InstanceType::SetPartitioning)
+    ->Arg(100)
+    ->Arg(1000)
+    ->Arg(5000)
+    ->Unit(benchmark::kMicrosecond);
+
+BENCHMARK_CAPTURE(BM_TabuSearchSolve, knapsack, InstanceType::Knapsack)
+    ->Arg(1000)
+    ->Arg(10000)
+    ->Arg(100000)
+    ->Unit(benchmark::kMicrosecond);
+
+BENCHMARK_CAPTURE(BM_TabuSearchSolve, quadratic_assignment,
+                  InstanceType::QuadraticAssignment)
+    ->Arg(12)
+    ->Arg(24)
+    ->Arg(48)
+    ->Unit(benchmark::kMicrosecond);
+}  // namespace
+/*****************************************************************************/
+// END
+/*****************************************************************************/
@@ -0,0 +1,100 @@
+/*****************************************************************************/
+// Copyright (c) 2020 Yuji KOGUMA
+// Released under the MIT license
+// https://opensource.org/licenses/mit-license.php
+/*****************************************************************************/
+#include <benchmark/benchmark.h>
+#include <random>
+#include <printemps.h>
+
+namespace {
+/*****************************************************************************/
+void BM_FixedSizeHashMapAt(benchmark::State& a_state) {
+    /**
+     * Look up the values for the keys stored in the map, as
+     * Expression::evaluate(move) does for the fixed sensitivities. The keys
+     * are accessed in random order.
+     */
+    const int NUMBER_OF_KEYS = a_state.range(0);
+
+    printemps::model::Model<int, double> model;
+    auto& x = model.create_variables("x", NUMBER_OF_KEYS);
+
+    std::unordered_map<printemps::model::Variable<int, double>*, double>
+        unordered_map;
+    std::vector<printemps::model::Variable<int, double>*> keys;
+    for (auto i = 0; i < NUMBER_OF_KEYS; i++) {
+        unordered_map[&x(i)] = i;
+        keys.push_back(&x(i));
+    }
+
+    std::mt19937 get_rand_mt(1);
+    std::shuffle(keys.begin(), keys.end(), get_rand_mt);
+
+    printemps::utility::FixedSizeHashMap<
+        printemps::model::Variable<int, double>*, double>
+        fixed_size_hash_map;
+    fixed_size_hash_map.setup(unordered_map,
+                              sizeof(printemps::model::Variable<int, double>));
+
+    for (auto _ : a_state) {
+        double sum = 0.0;
+        for (const auto& key : keys) {
+            sum += fixed_size_hash_map.at(key);
+        }
+        benchmark::DoNotOptimize(sum);
+    }
+    a_state.SetItemsProcessed(a_state.iterations() * NUMBER_OF_KEYS);
+}
+
+/*****************************************************************************/
+void BM_FixedSizeHashMapAtBatch(benchmark::State& a_state) {
+    /**
+     * Look up the same keys as BM_FixedSizeHashMapAt in batches of 8 keys
+     * with prefetching.
+     */
+    const int NUMBER_OF_KEYS = a_state.range(0);
+    const int BATCH_SIZE     = 8;
+
+    printemps::model::Model<int, double> model;
+    auto& x = model.create_variables("x", NUMBER_OF_KEYS);
+
+    std::unordered_map<printemps::model::Variable<int, double>*, double>
+        unordered_map;
+    std::vector<printemps::model::Variable<int, double>*> keys;
+    for (auto i = 0; i < NUMBER_OF_KEYS; i++) {
+        unordered_map[&x(i)] = i;
+        keys.push_back(&x(i));
+    }
+
+    std::mt19937 get_rand_mt(1);
+    std::shuffle(keys.begin(), keys.end(), get_rand_mt);
+
+    printemps::utility::FixedSizeHashMap<
+        printemps::model::Variable<int, double>*, double>
+        fixed_size_hash_map;
+    fixed_size_hash_map.setup(unordered_map,
+                              sizeof(printemps::model::Variable<int, double>));
+
+    double values[BATCH_SIZE];
+    for (auto _ : a_state) {
+        double sum = 0.0;
+        for (auto i = 0; i < NUMBER_OF_KEYS; i += BATCH_SIZE) {
+            const int SIZE = std::min(BATCH_SIZE, NUMBER_OF_KEYS - i);
+            fixed_size_hash_map.at(values, keys.data() + i, SIZE);
+            for (auto j = 0; j < SIZE; j++) {
+                sum += values[j];
+            }
+        }
+        benchmark::DoNotOptimize(sum);
+    }
+    a_state.SetItemsProcessed(a_state.iterations() * NUMBER_OF_KEYS);
+}
+
+/*****************************************************************************/
+BENCHMARK(BM_FixedSizeHashMapAt)->Arg(8)->Arg(64)->Arg(1024)->Arg(65536);
+BENCHMARK(BM_FixedSizeHashMapAtBatch)->Arg(8)->Arg(64)->Arg(1024)->Arg(65536);
+}  // namespace
+/*****************************************************************************/
+// END
+/*****************************************************************************/
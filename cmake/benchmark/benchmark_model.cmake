@@ -0,0 +1,19 @@
+file(GLOB BENCHMARK_MODEL_SOURCE ${TOP_DIR}/benchmark/model/*.cpp)
+
+add_executable(
+    benchmark_model
+    ${BENCHMARK_MODEL_SOURCE}
+)
+
+target_include_directories(
+    benchmark_model
+    PUBLIC ${TOP_DIR}/printemps/
+    PUBLIC ${TOP_DIR}/external/include/
+)
+
+target_link_libraries(
+    benchmark_model
+    PUBLIC benchmark
+    PUBLIC benchmark_main
+    PUBLIC pthread
+)
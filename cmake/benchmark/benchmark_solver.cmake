@@ -0,0 +1,19 @@
+file(GLOB BENCHMARK_SOLVER_SOURCE ${TOP_DIR}/benchmark/solver/*.cpp)
+
+add_executable(
+    benchmark_solver
+    ${BENCHMARK_SOLVER_SOURCE}
+)
+
+target_include_directories(
+    benchmark_solver
+    PUBLIC ${TOP_DIR}/printemps/
+    PUBLIC ${TOP_DIR}/external/include/
+)
+
+target_link_libraries(
+    benchmark_solver
+    PUBLIC benchmark
+    PUBLIC benchmark_main
+    PUBLIC pthread
+)
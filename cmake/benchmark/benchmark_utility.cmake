@@ -0,0 +1,19 @@
+file(GLOB BENCHMARK_UTILITY_SOURCE ${TOP_DIR}/benchmark/utility/*.cpp)
+
+add_executable(
+    benchmark_utility
+    ${BENCHMARK_UTILITY_SOURCE}
+)
+
+target_include_directories(
+    benchmark_utility
+    PUBLIC ${TOP_DIR}/printemps/
+    PUBLIC ${TOP_DIR}/external/include/
+)
+
+target_link_libraries(
+    benchmark_utility
+    PUBLIC benchmark
+    PUBLIC benchmark_main
+    PUBLIC pthread
+)
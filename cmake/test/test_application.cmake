@@ -0,0 +1,25 @@
+
+file(GLOB TEST_APPLICATION_SOURCE ${TOP_DIR}/test/application/*.cpp)
+
+add_executable(
+    test_application
+    ${TEST_APPLICATION_SOURCE}
+)
+
+target_include_directories(
+    test_application
+    PUBLIC ${TOP_DIR}/printemps/
+    PUBLIC ${TOP_DIR}/external/include/
+)
+
+target_link_libraries(
+    test_application
+    PUBLIC gtest
+    PUBLIC gtest_main
+    PUBLIC pthread
+)
+
+add_test(
+    NAME test_application
+    COMMAND test_application --gtest_output=xml
+)
\ No newline at end of file
@@ -16,6 +16,7 @@ class AbstractMultiArrayElement {
    protected:
     int              m_proxy_index;
     int              m_flat_index;
+    int              m_global_index;
     std::vector<int> m_multi_dimensional_index;
     std::string      m_name;
 
@@ -33,6 +34,7 @@ class AbstractMultiArrayElement {
     void initialize(void) {
         m_proxy_index             = 0;
         m_flat_index              = 0;
+        m_global_index            = 0;
         m_multi_dimensional_index = {0};
         m_name                    = "";
     }
@@ -58,6 +60,16 @@ class AbstractMultiArrayElement {
         return m_flat_index;
     }
 
+    /*************************************************************************/
+    inline constexpr void set_global_index(const int a_GLOBAL_INDEX) {
+        m_global_index = a_GLOBAL_INDEX;
+    }
+
+    /*************************************************************************/
+    inline constexpr int global_index(void) const {
+        return m_global_index;
+    }
+
     /*************************************************************************/
     inline void set_multi_dimensional_index(
         const std::vector<int> &a_MULTI_DIMENSIONAL_INDEX) {
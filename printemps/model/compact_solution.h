@@ -0,0 +1,57 @@
+/*****************************************************************************/
+// Copyright (c) 2020 Yuji KOGUMA
+// Released under the MIT license
+// https://opensource.org/licenses/mit-license.php
+/*****************************************************************************/
+#ifndef PRINTEMPS_MODEL_COMPACT_SOLUTION_H__
+#define PRINTEMPS_MODEL_COMPACT_SOLUTION_H__
+
+#include <vector>
+
+namespace printemps {
+namespace model {
+/*****************************************************************************/
+template <class T_Variable, class T_Expression>
+struct CompactSolution {
+    /**
+     * CompactSolution is a lightweight snapshot of a solution which holds the
+     * values of the decision variables and the violations of the constraints
+     * in plain vectors indexed by their global indices. It is used to store
+     * the incumbent solutions frequently updated in the search, instead of
+     * Solution which contains the values and names of all of the proxies.
+     */
+    std::vector<T_Variable>   variables;
+    std::vector<T_Expression> violations;
+
+    T_Expression objective;
+    T_Expression total_violation;
+    bool         is_feasible;
+
+    /*************************************************************************/
+    CompactSolution(void)
+        : objective(0), total_violation(0), is_feasible(false) {
+        this->initialize();
+    }
+
+    /*************************************************************************/
+    virtual ~CompactSolution(void) {
+        /// nothing to do
+    }
+
+    /*************************************************************************/
+    void initialize(void) {
+        this->variables.clear();
+        this->violations.clear();
+
+        this->objective       = 0;
+        this->total_violation = 0;
+        this->is_feasible     = false;
+    }
+};
+using IPCompactSolution = CompactSolution<int, double>;
+}  // namespace model
+}  // namespace printemps
+#endif
+/*****************************************************************************/
+// END
+/*****************************************************************************/
@@ -31,15 +31,13 @@ class Constraint : public AbstractMultiArrayElement {
      */
 
    public:
+    /**
+     * m_function is used only for nonlinear constraints. Linear constraints
+     * are evaluated via m_expression without indirect calls.
+     */
     std::function<T_Expression(const Move<T_Variable, T_Expression> &)>
         m_function;
 
-    std::function<T_Expression(const Move<T_Variable, T_Expression> &)>
-        m_constraint_function;
-
-    std::function<T_Expression(const Move<T_Variable, T_Expression> &)>
-        m_violation_function;
-
     Expression<T_Variable, T_Expression> m_expression;
     ConstraintSense                      m_sense;
     T_Expression                         m_constraint_value;
@@ -168,14 +166,6 @@ class Constraint : public AbstractMultiArrayElement {
             []([[maybe_unused]] const Move<T_Variable, T_Expression> &a_MOVE) {
                 return static_cast<T_Expression>(0);
             };
-        m_constraint_function =
-            []([[maybe_unused]] const Move<T_Variable, T_Expression> &a_MOVE) {
-                return static_cast<T_Expression>(0);
-            };
-        m_violation_function =
-            []([[maybe_unused]] const Move<T_Variable, T_Expression> &a_MOVE) {
-                return static_cast<T_Expression>(0);
-            };
 
         m_expression.initialize();
         m_sense                      = ConstraintSense::Lower;
@@ -221,40 +211,6 @@ class Constraint : public AbstractMultiArrayElement {
         m_is_enabled       = true;
 
         this->clear_constraint_type();
-
-        m_constraint_function =
-            [this](const Move<T_Variable, T_Expression> &a_MOVE) {
-                return m_function(a_MOVE);
-            };
-
-        switch (m_sense) {
-            case ConstraintSense::Lower: {
-                m_violation_function =
-                    [this](const Move<T_Variable, T_Expression> &a_MOVE) {
-                        return std::max(m_function(a_MOVE),
-                                        static_cast<T_Expression>(0));
-                    };
-                break;
-            }
-            case ConstraintSense::Equal: {
-                m_violation_function =
-                    [this](const Move<T_Variable, T_Expression> &a_MOVE) {
-                        return std::abs(m_function(a_MOVE));
-                    };
-                break;
-            }
-            case ConstraintSense::Upper: {
-                m_violation_function =
-                    [this](const Move<T_Variable, T_Expression> &a_MOVE) {
-                        return std::max(-m_function(a_MOVE),
-                                        static_cast<T_Expression>(0));
-                    };
-                break;
-            }
-            default: {
-                break;
-            }
-        }
     }
 
     /*************************************************************************/
@@ -275,40 +231,6 @@ class Constraint : public AbstractMultiArrayElement {
         this->clear_constraint_type();
 
         m_expression.setup_fixed_sensitivities();
-
-        m_constraint_function =
-            [this](const Move<T_Variable, T_Expression> &a_MOVE) {
-                return m_expression.evaluate(a_MOVE);
-            };
-
-        switch (m_sense) {
-            case ConstraintSense::Lower: {
-                m_violation_function =
-                    [this](const Move<T_Variable, T_Expression> &a_MOVE) {
-                        return std::max(m_expression.evaluate(a_MOVE),
-                                        static_cast<T_Expression>(0));
-                    };
-                break;
-            }
-            case ConstraintSense::Equal: {
-                m_violation_function =
-                    [this](const Move<T_Variable, T_Expression> &a_MOVE) {
-                        return std::abs(m_expression.evaluate(a_MOVE));
-                    };
-                break;
-            }
-            case ConstraintSense::Upper: {
-                m_violation_function =
-                    [this](const Move<T_Variable, T_Expression> &a_MOVE) {
-                        return std::max(-m_expression.evaluate(a_MOVE),
-                                        static_cast<T_Expression>(0));
-                    };
-                break;
-            }
-            default: {
-                break;
-            }
-        }
     }
 
     /*************************************************************************/
@@ -467,30 +389,62 @@ class Constraint : public AbstractMultiArrayElement {
 
     /*************************************************************************/
     inline constexpr T_Expression evaluate_constraint(void) const noexcept {
-        return m_constraint_function({});
+        if (m_is_linear) {
+            return m_expression.evaluate();
+        }
+        return m_function({});
     }
 
     /*************************************************************************/
     inline constexpr T_Expression evaluate_constraint(
         const Move<T_Variable, T_Expression> &a_MOVE) const noexcept {
-        return m_constraint_function(a_MOVE);
+        /**
+         * Linear constraints are evaluated inline, and only nonlinear ones
+         * go through the std::function given by the user.
+         */
+        if (m_is_linear) {
+            return m_expression.evaluate(a_MOVE);
+        }
+        return m_function(a_MOVE);
     }
 
     /*************************************************************************/
     inline constexpr T_Expression evaluate_violation(void) const noexcept {
-        return m_violation_function({});
+        return this->compute_violation(this->evaluate_constraint());
     }
 
     /*************************************************************************/
     inline constexpr T_Expression evaluate_violation(
         const Move<T_Variable, T_Expression> &a_MOVE) const noexcept {
-        return m_violation_function(a_MOVE);
+        return this->compute_violation(this->evaluate_constraint(a_MOVE));
     }
 
     /*************************************************************************/
     inline constexpr T_Expression evaluate_violation_diff(
         const Move<T_Variable, T_Expression> &a_MOVE) const noexcept {
-        return m_violation_function(a_MOVE) - m_violation_value;
+        return this->compute_violation(this->evaluate_constraint(a_MOVE)) -
+               m_violation_value;
+    }
+
+    /*************************************************************************/
+    inline constexpr T_Expression compute_violation(
+        const T_Expression a_CONSTRAINT_VALUE) const noexcept {
+        switch (m_sense) {
+            case ConstraintSense::Lower: {
+                return std::max(a_CONSTRAINT_VALUE,
+                                static_cast<T_Expression>(0));
+            }
+            case ConstraintSense::Equal: {
+                return std::abs(a_CONSTRAINT_VALUE);
+            }
+            case ConstraintSense::Upper: {
+                return std::max(-a_CONSTRAINT_VALUE,
+                                static_cast<T_Expression>(0));
+            }
+            default: {
+                return static_cast<T_Expression>(0);
+            }
+        }
     }
 
     /*************************************************************************/
@@ -500,23 +454,39 @@ class Constraint : public AbstractMultiArrayElement {
          */
         if (m_is_linear) {
             m_expression.update();
+            m_constraint_value = m_expression.value();
+        } else {
+            m_constraint_value = m_function({});
         }
-        m_constraint_value = m_constraint_function({});
-        m_violation_value  = m_violation_function({});
+        m_violation_value = this->compute_violation(m_constraint_value);
     }
 
     /*************************************************************************/
     inline constexpr void update(const Move<T_Variable, T_Expression> &a_MOVE) {
         /**
-         * m_expression must be updated after m_constraint_value and
-         * m_violation.
+         * The value of m_expression is evaluated with the move once and is
+         * shared by the constraint value.
          */
-        m_constraint_value = m_constraint_function(a_MOVE);
-        m_violation_value  = m_violation_function(a_MOVE);
-
         if (m_is_linear) {
-            m_expression.update(a_MOVE);
+            m_constraint_value = m_expression.evaluate(a_MOVE);
+            m_expression.set_value(m_constraint_value);
+        } else {
+            m_constraint_value = m_function(a_MOVE);
         }
+        m_violation_value = this->compute_violation(m_constraint_value);
+    }
+
+    /*************************************************************************/
+    inline constexpr void update_by_value(
+        const T_Expression a_CONSTRAINT_VALUE) noexcept {
+        /**
+         * This method is available only for linear constraints, and the given
+         * value must be the value of m_expression (e.g. computed with the
+         * constraint matrix of the model).
+         */
+        m_expression.set_value(a_CONSTRAINT_VALUE);
+        m_constraint_value = a_CONSTRAINT_VALUE;
+        m_violation_value  = this->compute_violation(a_CONSTRAINT_VALUE);
     }
 
     /*************************************************************************/
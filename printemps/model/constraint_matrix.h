@@ -0,0 +1,412 @@
+/*****************************************************************************/
+// Copyright (c) 2020 Yuji KOGUMA
+// Released under the MIT license
+// https://opensource.org/licenses/mit-license.php
+/*****************************************************************************/
+#ifndef PRINTEMPS_MODEL_CONSTRAINT_MATRIX_H__
+#define PRINTEMPS_MODEL_CONSTRAINT_MATRIX_H__
+
+#include <vector>
+#include <algorithm>
+
+namespace printemps {
+namespace model {
+/*****************************************************************************/
+template <class T_Variable, class T_Expression>
+class Variable;
+
+/*****************************************************************************/
+template <class T_Variable, class T_Expression>
+class Expression;
+
+/*****************************************************************************/
+template <class T_Variable, class T_Expression>
+class Constraint;
+
+/*****************************************************************************/
+template <class T_Variable, class T_Expression>
+struct Move;
+
+/*****************************************************************************/
+template <class T_Variable, class T_Expression>
+class ConstraintMatrix {
+    /**
+     * ConstraintMatrix holds the coefficients of linear constraints in both of
+     * the compressed sparse row (CSR) and the compressed sparse column (CSC)
+     * formats. The rows and the columns are indexed by the global indices of
+     * constraints and variables, which are assigned in
+     * Model::categorize_variables() and Model::categorize_constraints(). The
+     * matrix is frozen once it is built at the end of Model::setup().
+     */
+   private:
+    std::vector<Variable<T_Variable, T_Expression> *>   m_variable_ptrs;
+    std::vector<Constraint<T_Variable, T_Expression> *> m_constraint_ptrs;
+
+    /// CSR
+    std::vector<int>          m_row_begins;
+    std::vector<int>          m_row_variable_indices;
+    std::vector<T_Expression> m_row_coefficients;
+
+    /// CSC
+    std::vector<int>          m_column_begins;
+    std::vector<int>          m_column_constraint_indices;
+    std::vector<T_Expression> m_column_coefficients;
+
+    std::vector<T_Expression> m_constants;
+    std::vector<T_Expression> m_objective_coefficients;
+
+    bool m_is_enabled;
+    bool m_is_enabled_objective;
+
+   public:
+    /*************************************************************************/
+    ConstraintMatrix(void) {
+        this->initialize();
+    }
+
+    /*************************************************************************/
+    virtual ~ConstraintMatrix(void) {
+        /// nothing to do
+    }
+
+    /*************************************************************************/
+    void initialize(void) {
+        m_variable_ptrs.clear();
+        m_constraint_ptrs.clear();
+
+        m_row_begins.clear();
+        m_row_variable_indices.clear();
+        m_row_coefficients.clear();
+
+        m_column_begins.clear();
+        m_column_constraint_indices.clear();
+        m_column_coefficients.clear();
+
+        m_constants.clear();
+        m_objective_coefficients.clear();
+
+        m_is_enabled           = false;
+        m_is_enabled_objective = false;
+    }
+
+    /*************************************************************************/
+    void setup(const std::vector<Variable<T_Variable, T_Expression> *>
+                   &a_VARIABLE_PTRS,
+               const std::vector<Constraint<T_Variable, T_Expression> *>
+                   &                                a_CONSTRAINT_PTRS,
+               const Expression<T_Variable, T_Expression> *a_OBJECTIVE_PTR) {
+        /**
+         * The global indices of the variables and the constraints must be
+         * identical to their positions in the given vectors. If a_OBJECTIVE_PTR
+         * is nullptr, the objective coefficients are not stored.
+         */
+        this->initialize();
+
+        m_variable_ptrs   = a_VARIABLE_PTRS;
+        m_constraint_ptrs = a_CONSTRAINT_PTRS;
+
+        const int VARIABLES_SIZE   = m_variable_ptrs.size();
+        const int CONSTRAINTS_SIZE = m_constraint_ptrs.size();
+
+        /**
+         * Build the CSR format. The variable indices in each row are sorted in
+         * ascending order.
+         */
+        m_row_begins.resize(CONSTRAINTS_SIZE + 1, 0);
+        m_constants.resize(CONSTRAINTS_SIZE, 0);
+
+        std::vector<int> number_of_column_elements(VARIABLES_SIZE, 0);
+        std::vector<std::pair<int, T_Expression>> row_elements;
+
+        for (auto i = 0; i < CONSTRAINTS_SIZE; i++) {
+            const auto &expression = m_constraint_ptrs[i]->expression();
+            row_elements.clear();
+            for (const auto &sensitivity : expression.sensitivities()) {
+                row_elements.emplace_back(sensitivity.first->global_index(),
+                                          sensitivity.second);
+            }
+            std::sort(row_elements.begin(), row_elements.end(),
+                      [](const auto &a_FIRST, const auto &a_SECOND) {
+                          return a_FIRST.first < a_SECOND.first;
+                      });
+
+            for (const auto &element : row_elements) {
+                m_row_variable_indices.push_back(element.first);
+                m_row_coefficients.push_back(element.second);
+                number_of_column_elements[element.first]++;
+            }
+            m_row_begins[i + 1] = m_row_variable_indices.size();
+            m_constants[i]      = expression.constant_value();
+        }
+
+        /**
+         * Build the CSC format by transposing the CSR format. Since the rows
+         * are scanned in ascending order, the constraint indices in each
+         * column are also sorted in ascending order.
+         */
+        m_column_begins.resize(VARIABLES_SIZE + 1, 0);
+        for (auto i = 0; i < VARIABLES_SIZE; i++) {
+            m_column_begins[i + 1] =
+                m_column_begins[i] + number_of_column_elements[i];
+        }
+
+        const int NUMBER_OF_ELEMENTS = m_row_variable_indices.size();
+        m_column_constraint_indices.resize(NUMBER_OF_ELEMENTS);
+        m_column_coefficients.resize(NUMBER_OF_ELEMENTS);
+
+        std::vector<int> positions(m_column_begins.begin(),
+                                   m_column_begins.end() - 1);
+        for (auto i = 0; i < CONSTRAINTS_SIZE; i++) {
+            for (auto j = m_row_begins[i]; j < m_row_begins[i + 1]; j++) {
+                const int POSITION = positions[m_row_variable_indices[j]]++;
+                m_column_constraint_indices[POSITION] = i;
+                m_column_coefficients[POSITION]       = m_row_coefficients[j];
+            }
+        }
+
+        /**
+         * Store the objective coefficients as a dense vector.
+         */
+        if (a_OBJECTIVE_PTR != nullptr) {
+            m_objective_coefficients.resize(VARIABLES_SIZE, 0);
+            for (const auto &sensitivity : a_OBJECTIVE_PTR->sensitivities()) {
+                m_objective_coefficients[sensitivity.first->global_index()] =
+                    sensitivity.second;
+            }
+            m_is_enabled_objective = true;
+        }
+
+        m_is_enabled = true;
+    }
+
+    /*************************************************************************/
+    inline constexpr T_Expression coefficient(const int a_CONSTRAINT_INDEX,
+                                              const int a_VARIABLE_INDEX) const
+        noexcept {
+        /**
+         * The coefficient is searched by binary search on the column.
+         */
+        const auto FIRST = m_column_constraint_indices.begin() +
+                           m_column_begins[a_VARIABLE_INDEX];
+        const auto LAST = m_column_constraint_indices.begin() +
+                          m_column_begins[a_VARIABLE_INDEX + 1];
+
+        const auto POSITION = std::lower_bound(FIRST, LAST, a_CONSTRAINT_INDEX);
+        if (POSITION == LAST || *POSITION != a_CONSTRAINT_INDEX) {
+            return static_cast<T_Expression>(0);
+        }
+        return m_column_coefficients[POSITION -
+                                     m_column_constraint_indices.begin()];
+    }
+
+    /*************************************************************************/
+    inline constexpr T_Expression compute_row_value(
+        const int a_CONSTRAINT_INDEX) const noexcept {
+        T_Expression value = m_constants[a_CONSTRAINT_INDEX];
+        for (auto i = m_row_begins[a_CONSTRAINT_INDEX];
+             i < m_row_begins[a_CONSTRAINT_INDEX + 1]; i++) {
+            value += m_row_coefficients[i] *
+                     m_variable_ptrs[m_row_variable_indices[i]]->value();
+        }
+        return value;
+    }
+
+    /*************************************************************************/
+    inline constexpr T_Expression compute_objective_difference(
+        const Move<T_Variable, T_Expression> &a_MOVE) const noexcept {
+        T_Expression difference = 0;
+        for (const auto &alteration : a_MOVE.alterations) {
+            difference +=
+                m_objective_coefficients[alteration.first->global_index()] *
+                (alteration.second - alteration.first->value());
+        }
+        return difference;
+    }
+
+    /*************************************************************************/
+    template <class T_Function>
+    inline void for_each_constraint_difference(
+        const Move<T_Variable, T_Expression> &a_MOVE,
+        const T_Function &                    a_FUNCTION) const noexcept {
+        /**
+         * This method calls a_FUNCTION(constraint_index, difference) exactly
+         * once for each constraint related to the move, where difference is
+         * the change of the constraint value caused by the move. If the move
+         * has the pre-resolved coefficient list, the list is streamed.
+         * Otherwise, for a move with one alteration, the column of the
+         * altered variable is scanned. For a move with more alterations, the
+         * entries of their columns are collected into a thread-local list
+         * and sorted by the constraint indices, so that the differences to
+         * the same constraint are accumulated in one pass.
+         */
+        if (a_MOVE.coefficients) {
+            this->for_each_constraint_difference_by_coefficients(
+                a_MOVE, *a_MOVE.coefficients, a_FUNCTION);
+            return;
+        }
+
+        const auto &alterations      = a_MOVE.alterations;
+        const int   ALTERATIONS_SIZE = alterations.size();
+
+        if (ALTERATIONS_SIZE == 1) {
+            const auto &variable_ptr   = alterations.front().first;
+            const int   VARIABLE_INDEX = variable_ptr->global_index();
+            const auto  VALUE_DIFFERENCE =
+                alterations.front().second - variable_ptr->value();
+
+            for (auto i = m_column_begins[VARIABLE_INDEX];
+                 i < m_column_begins[VARIABLE_INDEX + 1]; i++) {
+                a_FUNCTION(m_column_constraint_indices[i],
+                           m_column_coefficients[i] * VALUE_DIFFERENCE);
+            }
+            return;
+        }
+
+        thread_local MoveCoefficients<T_Variable, T_Expression> coefficients;
+        coefficients.clear();
+
+        for (auto i = 0; i < ALTERATIONS_SIZE; i++) {
+            const int VARIABLE_INDEX = alterations[i].first->global_index();
+            for (auto j = m_column_begins[VARIABLE_INDEX];
+                 j < m_column_begins[VARIABLE_INDEX + 1]; j++) {
+                coefficients.push_back({m_column_constraint_indices[j], i,
+                                        m_column_coefficients[j]});
+            }
+        }
+        sort_move_coefficients(&coefficients);
+
+        this->for_each_constraint_difference_by_coefficients(
+            a_MOVE, coefficients, a_FUNCTION);
+    }
+
+    /*************************************************************************/
+    template <class T_Function>
+    inline constexpr void for_each_constraint_difference_by_coefficients(
+        const Move<T_Variable, T_Expression> &            a_MOVE,
+        const MoveCoefficients<T_Variable, T_Expression> &a_COEFFICIENTS,
+        const T_Function &a_FUNCTION) const noexcept {
+        /**
+         * This method accumulates the differences of the constraint values
+         * for the coefficient list sorted by the constraint indices in one
+         * pass.
+         */
+        const auto &alterations = a_MOVE.alterations;
+        const int   SIZE        = a_COEFFICIENTS.size();
+
+        int i = 0;
+        while (i < SIZE) {
+            const int    CONSTRAINT_INDEX = a_COEFFICIENTS[i].constraint_index;
+            T_Expression difference       = 0;
+            do {
+                const auto &alteration =
+                    alterations[a_COEFFICIENTS[i].alteration_index];
+                difference += a_COEFFICIENTS[i].coefficient *
+                              (alteration.second - alteration.first->value());
+                i++;
+            } while (i < SIZE &&
+                     a_COEFFICIENTS[i].constraint_index == CONSTRAINT_INDEX);
+            a_FUNCTION(CONSTRAINT_INDEX, difference);
+        }
+    }
+
+    /*************************************************************************/
+    inline constexpr bool has_element(const int a_CONSTRAINT_INDEX,
+                                      const int a_VARIABLE_INDEX) const
+        noexcept {
+        const auto FIRST = m_column_constraint_indices.begin() +
+                           m_column_begins[a_VARIABLE_INDEX];
+        const auto LAST = m_column_constraint_indices.begin() +
+                          m_column_begins[a_VARIABLE_INDEX + 1];
+        return std::binary_search(FIRST, LAST, a_CONSTRAINT_INDEX);
+    }
+
+    /*************************************************************************/
+    inline constexpr const std::vector<Constraint<T_Variable, T_Expression> *>
+        &constraint_ptrs(void) const noexcept {
+        return m_constraint_ptrs;
+    }
+
+    /*************************************************************************/
+    inline constexpr const std::vector<Variable<T_Variable, T_Expression> *>
+        &variable_ptrs(void) const noexcept {
+        return m_variable_ptrs;
+    }
+
+    /*************************************************************************/
+    inline constexpr const std::vector<int> &row_begins(void) const noexcept {
+        return m_row_begins;
+    }
+
+    /*************************************************************************/
+    inline constexpr const std::vector<int> &row_variable_indices(void) const
+        noexcept {
+        return m_row_variable_indices;
+    }
+
+    /*************************************************************************/
+    inline constexpr const std::vector<T_Expression> &row_coefficients(
+        void) const noexcept {
+        return m_row_coefficients;
+    }
+
+    /*************************************************************************/
+    inline constexpr const std::vector<int> &column_begins(void) const
+        noexcept {
+        return m_column_begins;
+    }
+
+    /*************************************************************************/
+    inline constexpr const std::vector<int> &column_constraint_indices(
+        void) const noexcept {
+        return m_column_constraint_indices;
+    }
+
+    /*************************************************************************/
+    inline constexpr const std::vector<T_Expression> &column_coefficients(
+        void) const noexcept {
+        return m_column_coefficients;
+    }
+
+    /*************************************************************************/
+    inline constexpr const std::vector<T_Expression> &constants(void) const
+        noexcept {
+        return m_constants;
+    }
+
+    /*************************************************************************/
+    inline constexpr const std::vector<T_Expression> &objective_coefficients(
+        void) const noexcept {
+        return m_objective_coefficients;
+    }
+
+    /*************************************************************************/
+    inline constexpr int number_of_rows(void) const noexcept {
+        return m_constraint_ptrs.size();
+    }
+
+    /*************************************************************************/
+    inline constexpr int number_of_columns(void) const noexcept {
+        return m_variable_ptrs.size();
+    }
+
+    /*************************************************************************/
+    inline constexpr int number_of_elements(void) const noexcept {
+        return m_row_variable_indices.size();
+    }
+
+    /*************************************************************************/
+    inline constexpr bool is_enabled(void) const noexcept {
+        return m_is_enabled;
+    }
+
+    /*************************************************************************/
+    inline constexpr bool is_enabled_objective(void) const noexcept {
+        return m_is_enabled_objective;
+    }
+};
+}  // namespace model
+}  // namespace printemps
+#endif
+/*****************************************************************************/
+// END
+/*****************************************************************************/
\ No newline at end of file
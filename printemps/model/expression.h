@@ -212,6 +212,11 @@ class Expression : public AbstractMultiArrayElement {
         m_value = this->evaluate(a_MOVE);
     }
 
+    /*************************************************************************/
+    inline constexpr void set_value(const T_Expression a_VALUE) noexcept {
+        m_value = a_VALUE;
+    }
+
     /*************************************************************************/
     inline constexpr T_Expression value(void) const noexcept {
         return m_value;
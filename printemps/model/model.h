@@ -28,8 +28,10 @@
 #include "model_summary.h"
 #include "named_solution.h"
 #include "plain_solution.h"
+#include "compact_solution.h"
 #include "solution_score.h"
 #include "selection.h"
+#include "variable_state.h"
 #include "neighborhood.h"
 
 #include "expression_binary_operator.h"
@@ -38,6 +40,9 @@
 #include "variable_reference.h"
 #include "constraint_reference.h"
 #include "constraint_type_reference.h"
+#include "constraint_matrix.h"
+#include "binary_flip_evaluator.h"
+#include "violative_constraint_set.h"
 
 #include "presolver.h"
 #include "verifier.h"
@@ -84,6 +89,10 @@ class Model {
     ConstraintReference<T_Variable, T_Expression>    m_constraint_reference;
     ConstraintTypeReference<T_Variable, T_Expression>
         m_constraint_type_reference;
+    ConstraintMatrix<T_Variable, T_Expression>       m_constraint_matrix;
+    BinaryFlipEvaluator<T_Variable, T_Expression>    m_binary_flip_evaluator;
+    VariableState<T_Variable, T_Expression>          m_variable_state;
+    ViolativeConstraintSet<T_Variable, T_Expression> m_violative_constraint_set;
 
     Neighborhood<T_Variable, T_Expression> m_neighborhood;
     std::function<void(void)>              m_callback;
@@ -138,6 +147,10 @@ class Model {
         m_variable_reference.initialize();
         m_constraint_reference.initialize();
         m_constraint_type_reference.initialize();
+        m_constraint_matrix.initialize();
+        m_binary_flip_evaluator.initialize();
+        m_variable_state.initialize();
+        m_violative_constraint_set.initialize();
 
         m_neighborhood.initialize();
         m_callback = [](void) {};
@@ -681,6 +694,8 @@ class Model {
 
         this->setup_fixed_sensitivities(a_IS_ENABLED_PRINT);
         this->setup_is_enabled_fast_evaluation();
+        this->setup_constraint_matrix(a_IS_ENABLED_PRINT);
+        this->setup_violative_constraint_set();
     }
 
     /*************************************************************************/
@@ -688,6 +703,7 @@ class Model {
         for (auto &&proxy : m_variable_proxies) {
             for (auto &&variable : proxy.flat_indexed_variables()) {
                 variable.reset_related_constraint_ptrs();
+                variable.reset_related_expression_ptrs();
             }
         }
         for (auto &&proxy : m_constraint_proxies) {
@@ -699,6 +715,14 @@ class Model {
                 }
             }
         }
+        for (auto &&proxy : m_expression_proxies) {
+            for (auto &&expression : proxy.flat_indexed_expressions()) {
+                for (auto &&sensitivity : expression.sensitivities()) {
+                    sensitivity.first->register_related_expression_ptr(
+                        &expression);
+                }
+            }
+        }
     }
 
     /*************************************************************************/
@@ -812,6 +836,8 @@ class Model {
 
         for (auto &&proxy : m_variable_proxies) {
             for (auto &&variable : proxy.flat_indexed_variables()) {
+                variable.set_global_index(
+                    variable_reference.variable_ptrs.size());
                 variable_reference.variable_ptrs.push_back(&variable);
                 if (variable.is_fixed()) {
                     variable_reference.fixed_variable_ptrs.push_back(&variable);
@@ -850,6 +876,8 @@ class Model {
 
         for (auto &&proxy : m_constraint_proxies) {
             for (auto &&constraint : proxy.flat_indexed_constraints()) {
+                constraint.set_global_index(
+                    constraint_reference.constraint_ptrs.size());
                 constraint_reference.constraint_ptrs.push_back(&constraint);
                 if (!constraint.is_enabled()) {
                     constraint_reference.disabled_constraint_ptrs.push_back(
@@ -1107,6 +1135,13 @@ class Model {
         utility::print_single_line(a_IS_ENABLED_PRINT);
         utility::print_message("Detecting the neighborhood structure...",
                                a_IS_ENABLED_PRINT);
+
+        /**
+         * The binary and integer move updaters refer to the variable state
+         * mirror, which must be set up before the updaters.
+         */
+        this->setup_variable_state();
+        m_neighborhood.set_variable_state_ptr(&m_variable_state);
         bool has_fixed_variables = this->number_of_fixed_variables() > 0;
         bool has_selection_variables =
             this->number_of_selection_variables() > 0;
@@ -1155,6 +1190,11 @@ class Model {
         utility::print_message("Done.", a_IS_ENABLED_PRINT);
     }
 
+    /*************************************************************************/
+    constexpr void setup_variable_state(void) {
+        m_variable_state.setup(m_variable_reference.variable_ptrs);
+    }
+
     /*************************************************************************/
     constexpr void setup_fixed_sensitivities(const bool a_IS_ENABLED_PRINT) {
         utility::print_single_line(a_IS_ENABLED_PRINT);
@@ -1174,6 +1214,40 @@ class Model {
         utility::print_message("Done.", a_IS_ENABLED_PRINT);
     }
 
+    /*************************************************************************/
+    constexpr void setup_constraint_matrix(const bool a_IS_ENABLED_PRINT) {
+        /**
+         * The constraint matrix is built only if all of the constraints are
+         * linear and the fast evaluation is available. Otherwise, the
+         * evaluation and update fall back to the expression-based ones.
+         */
+        m_constraint_matrix.initialize();
+        if (!m_is_enabled_fast_evaluation) {
+            return;
+        }
+
+        utility::print_single_line(a_IS_ENABLED_PRINT);
+        utility::print_message("Creating the constraint matrix...",
+                               a_IS_ENABLED_PRINT);
+
+        const Expression<T_Variable, T_Expression> *objective_ptr = nullptr;
+        if (m_is_defined_objective && m_objective.is_linear()) {
+            objective_ptr = &m_objective.expression();
+        }
+
+        m_constraint_matrix.setup(m_variable_reference.variable_ptrs,      //
+                                  m_constraint_reference.constraint_ptrs,  //
+                                  objective_ptr);
+
+        utility::print_message("Done.", a_IS_ENABLED_PRINT);
+    }
+
+    /*************************************************************************/
+    constexpr void setup_violative_constraint_set(void) {
+        m_violative_constraint_set.setup(
+            m_constraint_reference.constraint_ptrs);
+    }
+
     /*************************************************************************/
     constexpr void print_number_of_variables(void) const {
         utility::print_single_line(true);
@@ -1352,6 +1426,25 @@ class Model {
             this, false, false);
     }
 
+    /*************************************************************************/
+    constexpr void import_variable_values(
+        const std::vector<T_Variable> &a_VALUES) {
+        /**
+         * The values are indexed by the global indices of the variables, as
+         * given by export_compact_solution().
+         */
+        for (auto &&variable_ptr : m_variable_reference.variable_ptrs) {
+            variable_ptr->set_value_if_not_fixed(
+                a_VALUES[variable_ptr->global_index()]);
+        }
+        verify_and_correct_selection_variables_initial_values(  //
+            this, false, false);
+        verify_and_correct_binary_variables_initial_values(  //
+            this, false, false);
+        verify_and_correct_integer_variables_initial_values(  //
+            this, false, false);
+    }
+
     /*************************************************************************/
     constexpr void update(void) {
         /**
@@ -1364,9 +1457,18 @@ class Model {
             }
         }
 
-        for (auto &&proxy : m_constraint_proxies) {
-            for (auto &&constraint : proxy.flat_indexed_constraints()) {
-                constraint.update();
+        if (m_constraint_matrix.is_enabled()) {
+            const auto &constraint_ptrs = m_constraint_matrix.constraint_ptrs();
+            const int   CONSTRAINTS_SIZE = constraint_ptrs.size();
+            for (auto i = 0; i < CONSTRAINTS_SIZE; i++) {
+                constraint_ptrs[i]->update_by_value(
+                    m_constraint_matrix.compute_row_value(i));
+            }
+        } else {
+            for (auto &&proxy : m_constraint_proxies) {
+                for (auto &&constraint : proxy.flat_indexed_constraints()) {
+                    constraint.update();
+                }
             }
         }
 
@@ -1374,6 +1476,12 @@ class Model {
             m_objective.update();
         }
 
+        if (m_binary_flip_evaluator.is_setup()) {
+            m_binary_flip_evaluator.update_values(m_constraint_matrix);
+        }
+
+        m_variable_state.update();
+        m_violative_constraint_set.update();
         this->update_feasibility();
     }
 
@@ -1395,16 +1503,62 @@ class Model {
                     }
                 }
             }
+            m_violative_constraint_set.update();
+            if (m_binary_flip_evaluator.is_setup()) {
+                m_binary_flip_evaluator.update_values(m_constraint_matrix);
+            }
+        } else if (m_constraint_matrix.is_enabled()) {
+            /**
+             * The binary flip evaluator (if it is set up) is refreshed only
+             * for the constraints changed by the move.
+             */
+            const auto &constraint_ptrs = m_constraint_matrix.constraint_ptrs();
+            auto &violative_constraint_set = m_violative_constraint_set;
+            auto &binary_flip_evaluator    = m_binary_flip_evaluator;
+            const bool IS_SETUP_BINARY_FLIP_EVALUATOR =
+                m_binary_flip_evaluator.is_setup();
+            m_constraint_matrix.for_each_constraint_difference(
+                a_MOVE,
+                [&constraint_ptrs, &violative_constraint_set,
+                 &binary_flip_evaluator, IS_SETUP_BINARY_FLIP_EVALUATOR](
+                    const int a_INDEX, const T_Expression a_DIFFERENCE) {
+                    auto &constraint_ptr = constraint_ptrs[a_INDEX];
+                    constraint_ptr->update_by_value(
+                        constraint_ptr->constraint_value() + a_DIFFERENCE);
+                    violative_constraint_set.update(constraint_ptr);
+                    if (IS_SETUP_BINARY_FLIP_EVALUATOR) {
+                        binary_flip_evaluator.update_value(a_INDEX,
+                                                           constraint_ptr);
+                    }
+                });
         } else {
             for (auto &&constraint_ptr : a_MOVE.related_constraint_ptrs) {
                 constraint_ptr->update(a_MOVE);
+                m_violative_constraint_set.update(constraint_ptr);
             }
         }
 
-        for (auto &&proxy : m_expression_proxies) {
-            for (auto &&expression : proxy.flat_indexed_expressions()) {
-                if (expression.is_enabled()) {
-                    expression.update(a_MOVE);
+        /**
+         * Only the expressions which include the altered variables are
+         * updated. An expression shared by several alterations is updated
+         * once at the first of them.
+         */
+        const int ALTERATIONS_SIZE = a_MOVE.alterations.size();
+        for (auto i = 0; i < ALTERATIONS_SIZE; i++) {
+            for (auto &&expression_ptr :
+                 a_MOVE.alterations[i].first->related_expression_ptrs()) {
+                bool is_updated = false;
+                for (auto j = 0; j < i; j++) {
+                    const auto &related_expression_ptrs =
+                        a_MOVE.alterations[j].first->related_expression_ptrs();
+                    if (related_expression_ptrs.find(expression_ptr) !=
+                        related_expression_ptrs.end()) {
+                        is_updated = true;
+                        break;
+                    }
+                }
+                if (!is_updated && expression_ptr->is_enabled()) {
+                    expression_ptr->update(a_MOVE);
                 }
             }
         }
@@ -1412,6 +1566,7 @@ class Model {
         for (auto &&alteration : a_MOVE.alterations) {
             alteration.first->set_value_if_not_fixed(alteration.second);
         }
+        m_variable_state.update(a_MOVE);
 
         if (a_MOVE.sense == MoveSense::Selection) {
             a_MOVE.alterations[1].first->select();
@@ -1420,12 +1575,31 @@ class Model {
         this->update_feasibility();
     }
 
+    /*************************************************************************/
+    inline constexpr void set_is_objective_improvable(
+        Variable<T_Variable, T_Expression> *a_variable_ptr,
+        const bool a_IS_OBJECTIVE_IMPROVABLE) noexcept {
+        a_variable_ptr->set_is_objective_improvable(a_IS_OBJECTIVE_IMPROVABLE);
+        m_variable_state.set_is_objective_improvable(
+            a_variable_ptr->global_index(), a_IS_OBJECTIVE_IMPROVABLE);
+    }
+
+    /*************************************************************************/
+    inline constexpr void set_is_feasibility_improvable(
+        Variable<T_Variable, T_Expression> *a_variable_ptr,
+        const bool a_IS_FEASIBILITY_IMPROVABLE) noexcept {
+        a_variable_ptr->set_is_feasibility_improvable(
+            a_IS_FEASIBILITY_IMPROVABLE);
+        m_variable_state.set_is_feasibility_improvable(
+            a_variable_ptr->global_index(), a_IS_FEASIBILITY_IMPROVABLE);
+    }
+
     /*************************************************************************/
     inline constexpr void reset_variable_objective_improvability(
         const std::vector<Variable<T_Variable, T_Expression> *>
             &a_VARIABLE_PTRS) {
         for (auto &&variable_ptr : a_VARIABLE_PTRS) {
-            variable_ptr->set_is_objective_improvable(false);
+            this->set_is_objective_improvable(variable_ptr, false);
         }
     }
 
@@ -1438,23 +1612,23 @@ class Model {
     /*************************************************************************/
     inline constexpr void reset_variable_feasibility_improvability(
         const std::vector<Variable<T_Variable, T_Expression> *>
-            &a_VARIABLE_PTRS) const noexcept {
+            &a_VARIABLE_PTRS) noexcept {
         for (auto &&variable_ptr : a_VARIABLE_PTRS) {
-            variable_ptr->set_is_feasibility_improvable(false);
+            this->set_is_feasibility_improvable(variable_ptr, false);
         }
     }
 
     /*************************************************************************/
     inline constexpr void reset_variable_feasibility_improvability(
         const std::vector<Constraint<T_Variable, T_Expression> *>
-            &a_CONSTRAINT_PTRS) const noexcept {
+            &a_CONSTRAINT_PTRS) noexcept {
         for (const auto &constraint_ptr : a_CONSTRAINT_PTRS) {
             if (!constraint_ptr->is_enabled()) {
                 continue;
             }
             auto &sensitivities = constraint_ptr->expression().sensitivities();
             for (const auto &sensitivity : sensitivities) {
-                sensitivity.first->set_is_feasibility_improvable(false);
+                this->set_is_feasibility_improvable(sensitivity.first, false);
             }
         }
     }
@@ -1474,31 +1648,41 @@ class Model {
     /*************************************************************************/
     constexpr void update_variable_objective_improvability(
         const std::vector<Variable<T_Variable, T_Expression> *>
-            &a_VARIABLE_PTRS) const noexcept {
+            &a_VARIABLE_PTRS) noexcept {
         for (const auto &variable_ptr : a_VARIABLE_PTRS) {
             auto coefficient =
                 variable_ptr->objective_sensitivity() * this->sign();
             if (coefficient > 0 && variable_ptr->has_lower_bound_margin()) {
-                variable_ptr->set_is_objective_improvable(true);
+                this->set_is_objective_improvable(variable_ptr, true);
             } else if (coefficient < 0 &&
                        variable_ptr->has_upper_bound_margin()) {
-                variable_ptr->set_is_objective_improvable(true);
+                this->set_is_objective_improvable(variable_ptr, true);
             } else {
-                variable_ptr->set_is_objective_improvable(false);
+                this->set_is_objective_improvable(variable_ptr, false);
             }
         }
     }
 
     /*************************************************************************/
     inline constexpr void update_variable_feasibility_improvability(void) {
-        this->update_variable_feasibility_improvability(
-            this->constraint_reference().constraint_ptrs);
+        /**
+         * Only the violative constraints can make the variables feasibility
+         * improvable, and they are given by the violative constraint set if
+         * it is available.
+         */
+        if (m_violative_constraint_set.is_enabled()) {
+            this->update_variable_feasibility_improvability(
+                m_violative_constraint_set.constraint_ptrs());
+        } else {
+            this->update_variable_feasibility_improvability(
+                this->constraint_reference().constraint_ptrs);
+        }
     }
 
     /*************************************************************************/
     constexpr void update_variable_feasibility_improvability(
         const std::vector<Constraint<T_Variable, T_Expression> *>
-            &a_CONSTRAINT_PTRS) const noexcept {
+            &a_CONSTRAINT_PTRS) noexcept {
         const int MASK_LOWER_OR_EQUAL = 0b10;
         const int MASK_UPPER_OR_EQUAL = 0b11;
 
@@ -1531,11 +1715,13 @@ class Model {
 
                         if (coefficient > 0 &&
                             variable_ptr->has_lower_bound_margin()) {
-                            variable_ptr->set_is_feasibility_improvable(true);
+                            this->set_is_feasibility_improvable(variable_ptr,
+                                                                true);
 
                         } else if (coefficient < 0 &&
                                    variable_ptr->has_upper_bound_margin()) {
-                            variable_ptr->set_is_feasibility_improvable(true);
+                            this->set_is_feasibility_improvable(variable_ptr,
+                                                                true);
                         }
                     }
                 }
@@ -1555,10 +1741,12 @@ class Model {
 
                         if (coefficient > 0 &&
                             variable_ptr->has_upper_bound_margin()) {
-                            variable_ptr->set_is_feasibility_improvable(true);
+                            this->set_is_feasibility_improvable(variable_ptr,
+                                                                true);
                         } else if (coefficient < 0 &&
                                    variable_ptr->has_lower_bound_margin()) {
-                            variable_ptr->set_is_feasibility_improvable(true);
+                            this->set_is_feasibility_improvable(variable_ptr,
+                                                                true);
                         }
                     }
                 }
@@ -1568,6 +1756,10 @@ class Model {
 
     /*************************************************************************/
     inline constexpr void update_feasibility(void) {
+        if (m_violative_constraint_set.is_enabled()) {
+            m_is_feasible = m_violative_constraint_set.empty();
+            return;
+        }
         for (const auto &proxy : m_constraint_proxies) {
             for (const auto &constraint : proxy.flat_indexed_constraints()) {
                 if (constraint.violation_value() > constant::EPSILON) {
@@ -1662,44 +1854,127 @@ class Model {
         double local_penalty   = a_CURRENT_SCORE.local_penalty;
         double global_penalty  = a_CURRENT_SCORE.global_penalty;
 
-        for (const auto &constraint_ptr : a_MOVE.related_constraint_ptrs) {
-            if (!constraint_ptr->is_enabled()) {
-                continue;
-            }
-            double violation_diff =
-                constraint_ptr->evaluate_violation_diff(a_MOVE);
-            total_violation += violation_diff;
+        if (m_constraint_matrix.is_enabled()) {
+            const auto &constraint_ptrs = m_constraint_matrix.constraint_ptrs();
+            m_constraint_matrix.for_each_constraint_difference(
+                a_MOVE, [&](const int          a_INDEX,
+                            const T_Expression a_DIFFERENCE) {
+                    const auto &constraint_ptr = constraint_ptrs[a_INDEX];
+                    if (!constraint_ptr->is_enabled()) {
+                        return;
+                    }
+                    double violation_diff =
+                        constraint_ptr->compute_violation(
+                            constraint_ptr->constraint_value() +
+                            a_DIFFERENCE) -
+                        constraint_ptr->violation_value();
+                    total_violation += violation_diff;
+
+                    if (violation_diff < 0) {
+                        is_feasibility_improvable = true;
+                    }
 
-            if (violation_diff < 0) {
-                is_feasibility_improvable = true;
-            }
+                    local_penalty +=
+                        violation_diff *
+                        constraint_ptr->local_penalty_coefficient();
+                    global_penalty +=
+                        violation_diff *
+                        constraint_ptr->global_penalty_coefficient();
+                });
+        } else {
+            for (const auto &constraint_ptr : a_MOVE.related_constraint_ptrs) {
+                if (!constraint_ptr->is_enabled()) {
+                    continue;
+                }
+                double violation_diff =
+                    constraint_ptr->evaluate_violation_diff(a_MOVE);
+                total_violation += violation_diff;
 
-            local_penalty +=
-                violation_diff * constraint_ptr->local_penalty_coefficient();
-            global_penalty +=
-                violation_diff * constraint_ptr->global_penalty_coefficient();
+                if (violation_diff < 0) {
+                    is_feasibility_improvable = true;
+                }
+
+                local_penalty += violation_diff *
+                                 constraint_ptr->local_penalty_coefficient();
+                global_penalty += violation_diff *
+                                  constraint_ptr->global_penalty_coefficient();
+            }
         }
 
+        a_score_ptr->total_violation = total_violation;
+        a_score_ptr->local_penalty   = local_penalty;
+        a_score_ptr->global_penalty  = global_penalty;
+        a_score_ptr->is_feasible = !(total_violation > constant::EPSILON);
+        a_score_ptr->is_feasibility_improvable = is_feasibility_improvable;
+
+        this->evaluate_objective(a_score_ptr, a_MOVE);
+    }
+
+    /*************************************************************************/
+    inline void evaluate_objective(
+        SolutionScore *                       a_score_ptr,  //
+        const Move<T_Variable, T_Expression> &a_MOVE) const noexcept {
+        /**
+         * This method computes the objective after the move and completes
+         * the score whose violation and penalties have already been computed.
+         * It is shared by the fast evaluate() and evaluate_binary_flip().
+         */
         double objective             = 0.0;
         double objective_improvement = 0.0;
 
         if (m_is_defined_objective) {
-            objective = m_objective.evaluate(a_MOVE) * this->sign();
+            if (m_constraint_matrix.is_enabled_objective()) {
+                objective =
+                    (m_objective.value() +
+                     m_constraint_matrix.compute_objective_difference(a_MOVE)) *
+                    this->sign();
+            } else {
+                objective = m_objective.evaluate(a_MOVE) * this->sign();
+            }
             objective_improvement =
                 m_objective.value() * this->sign() - objective;
         }
 
-        a_score_ptr->objective                  = objective;
-        a_score_ptr->objective_improvement      = objective_improvement;
-        a_score_ptr->total_violation            = total_violation;
-        a_score_ptr->local_penalty              = local_penalty;
-        a_score_ptr->global_penalty             = global_penalty;
-        a_score_ptr->local_augmented_objective  = objective + local_penalty;
-        a_score_ptr->global_augmented_objective = objective + global_penalty;
-        a_score_ptr->is_feasible = !(total_violation > constant::EPSILON);
+        a_score_ptr->objective             = objective;
+        a_score_ptr->objective_improvement = objective_improvement;
+        a_score_ptr->local_augmented_objective =
+            objective + a_score_ptr->local_penalty;
+        a_score_ptr->global_augmented_objective =
+            objective + a_score_ptr->global_penalty;
         a_score_ptr->is_objective_improvable =
             objective_improvement > constant::EPSILON;
-        a_score_ptr->is_feasibility_improvable = is_feasibility_improvable;
+    }
+
+    /*************************************************************************/
+    inline void setup_binary_flip_evaluation(void) {
+        /**
+         * This method must be called before evaluate_binary_flip() after the
+         * penalty coefficients are changed, i.e., once before the iterations
+         * of each search. Then, the state of the evaluator is kept by
+         * update().
+         */
+        m_binary_flip_evaluator.setup(m_constraint_matrix);
+    }
+
+    /*************************************************************************/
+    inline void evaluate_binary_flip(
+        SolutionScore *                       a_score_ptr,  //
+        const Move<T_Variable, T_Expression> &a_MOVE,       //
+        const SolutionScore &                 a_CURRENT_SCORE) const noexcept {
+        /**
+         * This method is equivalent to the fast evaluate() for a move which
+         * flips one binary variable of a model with the constraint matrix.
+         */
+        m_binary_flip_evaluator.evaluate(a_score_ptr,      //
+                                         a_MOVE,           //
+                                         a_CURRENT_SCORE,  //
+                                         m_constraint_matrix);
+        this->evaluate_objective(a_score_ptr, a_MOVE);
+    }
+
+    /*************************************************************************/
+    inline constexpr bool is_enabled_binary_flip_evaluation(void) const {
+        return m_constraint_matrix.is_enabled();
     }
 
     /*************************************************************************/
@@ -1917,6 +2192,72 @@ class Model {
         return plain_solution;
     }
 
+    /*************************************************************************/
+    std::vector<T_Variable> export_variable_values(void) const {
+        /**
+         * The values are indexed by the global indices of the variables, as
+         * accepted by import_variable_values().
+         */
+        const auto &variable_ptrs  = m_variable_reference.variable_ptrs;
+        const int   VARIABLES_SIZE = variable_ptrs.size();
+
+        std::vector<T_Variable> variable_values(VARIABLES_SIZE);
+        for (auto i = 0; i < VARIABLES_SIZE; i++) {
+            variable_values[i] = variable_ptrs[i]->value();
+        }
+        return variable_values;
+    }
+
+    /*************************************************************************/
+    CompactSolution<T_Variable, T_Expression> export_compact_solution(
+        void) const {
+        /**
+         * This method must be called after the categorization of the
+         * variables and the constraints.
+         */
+        CompactSolution<T_Variable, T_Expression> compact_solution;
+
+        const auto &constraint_ptrs  = m_constraint_reference.constraint_ptrs;
+        const int   CONSTRAINTS_SIZE = constraint_ptrs.size();
+
+        /// Decision variables
+        compact_solution.variables = this->export_variable_values();
+
+        /// Violations
+        T_Expression total_violation = 0;
+        compact_solution.violations.resize(CONSTRAINTS_SIZE);
+        for (auto i = 0; i < CONSTRAINTS_SIZE; i++) {
+            const auto VIOLATION = constraint_ptrs[i]->violation_value();
+            compact_solution.violations[i] = VIOLATION;
+            total_violation += VIOLATION;
+        }
+
+        compact_solution.objective       = m_objective.value();
+        compact_solution.total_violation = total_violation;
+        compact_solution.is_feasible     = this->is_feasible();
+
+        return compact_solution;
+    }
+
+    /*************************************************************************/
+    CompactSolution<T_Variable, T_Expression> export_compact_solution(
+        const SolutionScore &a_SCORE) const {
+        /**
+         * This method exports the values of the variables only, and takes the
+         * total violation and the feasibility from the score of the current
+         * solution. The violations of the constraints are left empty, so that
+         * the cost does not depend on the number of the constraints.
+         */
+        CompactSolution<T_Variable, T_Expression> compact_solution;
+
+        compact_solution.variables       = this->export_variable_values();
+        compact_solution.objective       = m_objective.value();
+        compact_solution.total_violation = a_SCORE.total_violation;
+        compact_solution.is_feasible     = a_SCORE.is_feasible;
+
+        return compact_solution;
+    }
+
     /*************************************************************************/
     PlainSolution<T_Variable, T_Expression> convert_to_plain_solution(
         const Solution<T_Variable, T_Expression> &a_SOLUTION) const {
@@ -2051,6 +2392,24 @@ class Model {
         return m_constraint_type_reference;
     }
 
+    /*************************************************************************/
+    inline constexpr const ConstraintMatrix<T_Variable, T_Expression>
+        &constraint_matrix(void) const {
+        return m_constraint_matrix;
+    }
+
+    /*************************************************************************/
+    inline constexpr const VariableState<T_Variable, T_Expression>
+        &variable_state(void) const {
+        return m_variable_state;
+    }
+
+    /*************************************************************************/
+    inline constexpr const ViolativeConstraintSet<T_Variable, T_Expression>
+        &violative_constraint_set(void) const {
+        return m_violative_constraint_set;
+    }
+
     /*************************************************************************/
     inline constexpr bool is_defined_objective(void) const {
         return m_is_defined_objective;
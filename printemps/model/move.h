@@ -8,6 +8,8 @@
 
 #include <vector>
 #include <unordered_set>
+#include <memory>
+#include <algorithm>
 
 #include "../utility/utility.h"
 
@@ -21,18 +23,60 @@ class Variable;
 template <class T_Variable, class T_Expression>
 class Constraint;
 
+/*****************************************************************************/
+struct MoveConstant {
+    /**
+     * The number of alterations stored without heap allocation. It covers
+     * the moves in the built-in neighborhoods except for Chain moves.
+     */
+    static constexpr int ALTERATIONS_BUFFER_SIZE = 4;
+};
+
 /*****************************************************************************/
 template <class T_Variable, class T_Expression>
 using Alteration = std::pair<Variable<T_Variable, T_Expression> *, T_Variable>;
 
+/*****************************************************************************/
+template <class T_Variable, class T_Expression>
+using Alterations = utility::SmallVector<Alteration<T_Variable, T_Expression>,
+                                         MoveConstant::ALTERATIONS_BUFFER_SIZE>;
+
+/*****************************************************************************/
+template <class T_Variable, class T_Expression>
+struct MoveCoefficient {
+    int          constraint_index;
+    int          alteration_index;
+    T_Expression coefficient;
+};
+
+/*****************************************************************************/
+template <class T_Variable, class T_Expression>
+using MoveCoefficients =
+    std::vector<MoveCoefficient<T_Variable, T_Expression>>;
+
 /*****************************************************************************/
 template <class T_Variable, class T_Expression>
 struct Move {
-    std::vector<Alteration<T_Variable, T_Expression>> alterations;
-    MoveSense                                         sense;
-    std::unordered_set<Constraint<T_Variable, T_Expression> *>
+    /**
+     * The alterations are stored in a small buffer, and the related
+     * constraint pointers are shared among the copies of the move, so that
+     * updating and copying moves do not require heap allocation.
+     */
+    Alterations<T_Variable, T_Expression> alterations;
+    MoveSense                             sense;
+    utility::SharedSet<Constraint<T_Variable, T_Expression> *>
         related_constraint_ptrs;
 
+    /**
+     * The following member is for the static moves whose altered variables
+     * never change after the setup. It holds the constraint coefficients of
+     * the altered variables, sorted by the constraint indices, where
+     * alteration_index refers to the position in alterations. If it is null,
+     * the coefficients are looked up from the constraint matrix.
+     */
+    std::shared_ptr<const MoveCoefficients<T_Variable, T_Expression>>
+        coefficients;
+
     /**
      * The following members are for special neighborhood moves.
      */
@@ -46,13 +90,68 @@ struct Move {
 
     /*************************************************************************/
     Move(void)
-        : is_special_neighborhood_move(false),
+        : sense(MoveSense::UserDefined),
+          is_special_neighborhood_move(false),
           is_available(true),
           overlap_rate(0.0) {
         /// nothing to do
     }
 };
 
+/*****************************************************************************/
+template <class T_Variable, class T_Expression>
+inline void sort_move_coefficients(
+    MoveCoefficients<T_Variable, T_Expression> *a_coefficients) {
+    /**
+     * This function sorts the coefficient list by the constraint indices,
+     * and then by the alteration indices.
+     */
+    std::sort(a_coefficients->begin(), a_coefficients->end(),
+              [](const auto &a_FIRST, const auto &a_SECOND) {
+                  return a_FIRST.constraint_index < a_SECOND.constraint_index ||
+                         (a_FIRST.constraint_index ==
+                              a_SECOND.constraint_index &&
+                          a_FIRST.alteration_index < a_SECOND.alteration_index);
+              });
+}
+
+/*****************************************************************************/
+template <class T_Variable, class T_Expression>
+std::shared_ptr<const MoveCoefficients<T_Variable, T_Expression>>
+create_move_coefficients(
+    const std::vector<Variable<T_Variable, T_Expression> *> &a_VARIABLE_PTRS) {
+    /**
+     * This function creates the coefficient list for a static move whose k-th
+     * alteration alters *a_VARIABLE_PTRS[k]. The global indices of the
+     * constraints must have been assigned. If a related constraint is not
+     * linear, nullptr is returned.
+     */
+    auto coefficients =
+        std::make_shared<MoveCoefficients<T_Variable, T_Expression>>();
+
+    const int VARIABLES_SIZE = a_VARIABLE_PTRS.size();
+    for (auto i = 0; i < VARIABLES_SIZE; i++) {
+        const auto &variable_ptr = a_VARIABLE_PTRS[i];
+        for (const auto &constraint_ptr :
+             variable_ptr->related_constraint_ptrs()) {
+            if (!constraint_ptr->is_linear()) {
+                return nullptr;
+            }
+            const auto &sensitivities =
+                constraint_ptr->expression().sensitivities();
+            const auto SENSITIVITY = sensitivities.find(variable_ptr);
+            if (SENSITIVITY == sensitivities.end()) {
+                continue;
+            }
+            coefficients->push_back({constraint_ptr->global_index(), i,
+                                     SENSITIVITY->second});
+        }
+    }
+
+    sort_move_coefficients(coefficients.get());
+    return coefficients;
+}
+
 /*****************************************************************************/
 template <class T_Variable, class T_Expression>
 constexpr bool has_duplicate_variable(
@@ -72,7 +171,7 @@ constexpr bool has_duplicate_variable(
 /*****************************************************************************/
 template <class T_Variable, class T_Expression>
 constexpr double compute_overlap_rate(
-    const std::vector<Alteration<T_Variable, T_Expression>> &a_ALTERATIONS) {
+    const Alterations<T_Variable, T_Expression> &a_ALTERATIONS) {
     auto union_ptrs =
         a_ALTERATIONS.front().first->related_monic_constraint_ptrs();
     if (union_ptrs.size() == 0) {
@@ -106,7 +205,7 @@ constexpr double compute_overlap_rate(
 /*****************************************************************************/
 template <class T_Variable, class T_Expression>
 constexpr double compute_hash(
-    const std::vector<Alteration<T_Variable, T_Expression>> &a_ALTERATIONS) {
+    const Alterations<T_Variable, T_Expression> &a_ALTERATIONS) {
     /**
      * NOTE: Chain moves will be sorted in descending order by overlap_ratio to
      * apply std::unique()in Neighborhood.deduplicate_chain_move().A hash is
@@ -165,6 +264,11 @@ constexpr Move<T_Variable, T_Expression> operator+(
         a_MOVE_SECOND.related_constraint_ptrs.begin(),
         a_MOVE_SECOND.related_constraint_ptrs.end());
 
+    /**
+     * The coefficient list of the first move does not cover the second one.
+     */
+    result.coefficients.reset();
+
     result.sense                        = MoveSense::Chain;
     result.is_available                 = false;
     result.is_special_neighborhood_move = true;
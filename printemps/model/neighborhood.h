@@ -8,6 +8,7 @@
 
 #include <vector>
 #include <typeinfo>
+#include <unordered_map>
 
 namespace printemps {
 namespace model {
@@ -144,6 +145,8 @@ class Neighborhood {
 
     std::vector<Move<T_Variable, T_Expression> *> m_move_ptrs;
 
+    const VariableState<T_Variable, T_Expression> *m_variable_state_ptr;
+
     bool m_has_fixed_variables;
     bool m_has_selection_variables;
 
@@ -157,6 +160,8 @@ class Neighborhood {
     bool m_is_enabled_chain_move;
     bool m_is_enabled_user_defined_move;
 
+    int m_parallel_size_threshold;
+
    public:
     /*************************************************************************/
     Neighborhood(void) {
@@ -231,6 +236,8 @@ class Neighborhood {
 
         m_move_ptrs.clear();
 
+        m_variable_state_ptr = nullptr;
+
         m_has_fixed_variables     = false;
         m_has_selection_variables = false;
 
@@ -243,6 +250,14 @@ class Neighborhood {
         m_is_enabled_selection_move      = false;
         m_is_enabled_chain_move          = false;
         m_is_enabled_user_defined_move   = false;
+
+        m_parallel_size_threshold = 0;
+    }
+
+    /*************************************************************************/
+    inline constexpr void set_variable_state_ptr(
+        const VariableState<T_Variable, T_Expression> *a_VARIABLE_STATE_PTR) {
+        m_variable_state_ptr = a_VARIABLE_STATE_PTR;
     }
 
     /*************************************************************************/
@@ -280,6 +295,15 @@ class Neighborhood {
         m_binary_moves.resize(VARIABLES_SIZE);
         m_binary_move_flags.resize(VARIABLES_SIZE);
 
+        /**
+         * The flags and the values are read from the structure-of-arrays
+         * mirror of the variable states via the global indices.
+         */
+        std::vector<int> variable_indices(VARIABLES_SIZE);
+        for (auto i = 0; i < VARIABLES_SIZE; i++) {
+            variable_indices[i] = not_fixed_variable_ptrs[i]->global_index();
+        }
+
         for (auto i = 0; i < VARIABLES_SIZE; i++) {
             m_binary_moves[i].sense = MoveSense::Binary;
             m_binary_moves[i].related_constraint_ptrs =
@@ -292,26 +316,30 @@ class Neighborhood {
         }
 
         auto binary_move_updater =  //
-            [this, not_fixed_variable_ptrs, VARIABLES_SIZE](
+            [this, variable_indices, VARIABLES_SIZE](
                 auto *                      a_moves,                          //
                 auto *                      a_flags,                          //
                 const bool                  a_ACCEPT_ALL,                     //
                 const bool                  a_ACCEPT_OBJECTIVE_IMPROVABLE,    //
                 const bool                  a_ACCEPT_FEASIBILITY_IMPROVABLE,  //
                 [[maybe_unused]] const bool a_IS_ENABLED_PARALLEL) {
+                const auto &values = m_variable_state_ptr->values();
+                const auto &is_objective_improvable =
+                    m_variable_state_ptr->is_objective_improvable();
+                const auto &is_feasibility_improvable =
+                    m_variable_state_ptr->is_feasibility_improvable();
 #ifdef _OPENMP
 #pragma omp parallel for if (a_IS_ENABLED_PARALLEL) schedule(static)
 #endif
                 for (auto i = 0; i < VARIABLES_SIZE; i++) {
+                    const int INDEX = variable_indices[i];
                     if (a_ACCEPT_ALL ||
                         (a_ACCEPT_OBJECTIVE_IMPROVABLE &&
-                         not_fixed_variable_ptrs[i]
-                             ->is_objective_improvable()) ||
+                         is_objective_improvable[INDEX]) ||
                         (a_ACCEPT_FEASIBILITY_IMPROVABLE &&
-                         not_fixed_variable_ptrs[i]
-                             ->is_feasibility_improvable())) {
+                         is_feasibility_improvable[INDEX])) {
                         (*a_moves)[i].alterations.front().second =
-                            1 - not_fixed_variable_ptrs[i]->value();
+                            1 - values[INDEX];
                         (*a_flags)[i] = 1;
                     } else {
                         (*a_flags)[i] = 0;
@@ -345,11 +373,23 @@ class Neighborhood {
         m_integer_moves.resize(4 * VARIABLES_SIZE);
         m_integer_move_flags.resize(4 * VARIABLES_SIZE);
 
+        std::vector<int> variable_indices(VARIABLES_SIZE);
+        for (auto i = 0; i < VARIABLES_SIZE; i++) {
+            variable_indices[i] = not_fixed_variable_ptrs[i]->global_index();
+        }
+
         for (auto i = 0; i < VARIABLES_SIZE; i++) {
+            /**
+             * The four moves for a variable share the related constraint
+             * pointers.
+             */
+            const utility::SharedSet<Constraint<T_Variable, T_Expression> *>
+                RELATED_CONSTRAINT_PTRS =
+                    not_fixed_variable_ptrs[i]->related_constraint_ptrs();
             for (auto j = 0; j < 4; j++) {
                 m_integer_moves[4 * i + j].sense = MoveSense::Integer;
                 m_integer_moves[4 * i + j].related_constraint_ptrs =
-                    not_fixed_variable_ptrs[i]->related_constraint_ptrs();
+                    RELATED_CONSTRAINT_PTRS;
                 m_integer_moves[4 * i + j].alterations.emplace_back(
                     not_fixed_variable_ptrs[i], 0);
                 m_integer_moves[4 * i + j].is_special_neighborhood_move = false;
@@ -359,31 +399,35 @@ class Neighborhood {
         }
 
         auto integer_move_updater =  //
-            [this, not_fixed_variable_ptrs, VARIABLES_SIZE](
+            [this, variable_indices, VARIABLES_SIZE](
                 auto *                      a_moves,                          //
                 auto *                      a_flags,                          //
                 const bool                  a_ACCEPT_ALL,                     //
                 const bool                  a_ACCEPT_OBJECTIVE_IMPROVABLE,    //
                 const bool                  a_ACCEPT_FEASIBILITY_IMPROVABLE,  //
                 [[maybe_unused]] const bool a_IS_ENABLED_PARALLEL) {
-                const int DELTA_MAX = 10000;
+                const int   DELTA_MAX    = 10000;
+                const auto &values       = m_variable_state_ptr->values();
+                const auto &lower_bounds = m_variable_state_ptr->lower_bounds();
+                const auto &upper_bounds = m_variable_state_ptr->upper_bounds();
+                const auto &is_objective_improvable =
+                    m_variable_state_ptr->is_objective_improvable();
+                const auto &is_feasibility_improvable =
+                    m_variable_state_ptr->is_feasibility_improvable();
 #ifdef _OPENMP
 #pragma omp parallel for if (a_IS_ENABLED_PARALLEL) schedule(static)
 #endif
                 for (auto i = 0; i < VARIABLES_SIZE; i++) {
-                    const auto value = not_fixed_variable_ptrs[i]->value();
-                    const auto lower_bound =
-                        not_fixed_variable_ptrs[i]->lower_bound();
-                    const auto upper_bound =
-                        not_fixed_variable_ptrs[i]->upper_bound();
+                    const int  INDEX       = variable_indices[i];
+                    const auto value       = values[INDEX];
+                    const auto lower_bound = lower_bounds[INDEX];
+                    const auto upper_bound = upper_bounds[INDEX];
 
                     if (a_ACCEPT_ALL ||
                         (a_ACCEPT_OBJECTIVE_IMPROVABLE &&
-                         not_fixed_variable_ptrs[i]
-                             ->is_objective_improvable()) ||
+                         is_objective_improvable[INDEX]) ||
                         (a_ACCEPT_FEASIBILITY_IMPROVABLE &&
-                         not_fixed_variable_ptrs[i]
-                             ->is_feasibility_improvable())) {
+                         is_feasibility_improvable[INDEX])) {
                         if (value == upper_bound) {
                             (*a_flags)[4 * i] = 0;
                         } else {
@@ -489,6 +533,22 @@ class Neighborhood {
             m_aggregation_moves[4 * i + 1] = m_aggregation_moves[4 * i];
             m_aggregation_moves[4 * i + 2] = m_aggregation_moves[4 * i];
             m_aggregation_moves[4 * i + 3] = m_aggregation_moves[4 * i];
+
+            /**
+             * The moves 4i and 4i+1 alter (x_0, x_1) in this order, and the
+             * moves 4i+2 and 4i+3 alter (x_1, x_0).
+             */
+            const auto COEFFICIENTS_FORWARD = create_move_coefficients(
+                std::vector<Variable<T_Variable, T_Expression> *>(
+                    {variable_ptr_pairs[i][0], variable_ptr_pairs[i][1]}));
+            const auto COEFFICIENTS_BACKWARD = create_move_coefficients(
+                std::vector<Variable<T_Variable, T_Expression> *>(
+                    {variable_ptr_pairs[i][1], variable_ptr_pairs[i][0]}));
+
+            m_aggregation_moves[4 * i].coefficients     = COEFFICIENTS_FORWARD;
+            m_aggregation_moves[4 * i + 1].coefficients = COEFFICIENTS_FORWARD;
+            m_aggregation_moves[4 * i + 2].coefficients = COEFFICIENTS_BACKWARD;
+            m_aggregation_moves[4 * i + 3].coefficients = COEFFICIENTS_BACKWARD;
         }
 
         auto aggregation_move_updater =  //
@@ -619,6 +679,8 @@ class Neighborhood {
                 variable_ptr_pairs[i][0], 0);
             m_precedence_moves[2 * i].alterations.emplace_back(
                 variable_ptr_pairs[i][1], 0);
+            m_precedence_moves[2 * i].coefficients =
+                create_move_coefficients(variable_ptr_pairs[i]);
 
             m_precedence_moves[2 * i + 1] = m_precedence_moves[2 * i];
         }
@@ -753,6 +815,25 @@ class Neighborhood {
             m_variable_bound_moves[4 * i + 1] = m_variable_bound_moves[4 * i];
             m_variable_bound_moves[4 * i + 2] = m_variable_bound_moves[4 * i];
             m_variable_bound_moves[4 * i + 3] = m_variable_bound_moves[4 * i];
+
+            /**
+             * The moves 4i and 4i+1 alter (x_0, x_1) in this order, and the
+             * moves 4i+2 and 4i+3 alter (x_1, x_0).
+             */
+            const auto COEFFICIENTS_FORWARD = create_move_coefficients(
+                std::vector<Variable<T_Variable, T_Expression> *>(
+                    {variable_ptr_pairs[i][0], variable_ptr_pairs[i][1]}));
+            const auto COEFFICIENTS_BACKWARD = create_move_coefficients(
+                std::vector<Variable<T_Variable, T_Expression> *>(
+                    {variable_ptr_pairs[i][1], variable_ptr_pairs[i][0]}));
+
+            m_variable_bound_moves[4 * i].coefficients = COEFFICIENTS_FORWARD;
+            m_variable_bound_moves[4 * i + 1].coefficients =
+                COEFFICIENTS_FORWARD;
+            m_variable_bound_moves[4 * i + 2].coefficients =
+                COEFFICIENTS_BACKWARD;
+            m_variable_bound_moves[4 * i + 3].coefficients =
+                COEFFICIENTS_BACKWARD;
         }
 
         auto variable_bound_move_updater =  //
@@ -967,13 +1048,18 @@ class Neighborhood {
                 variable_ptr->related_constraint_ptrs().begin(),
                 variable_ptr->related_constraint_ptrs().end());
 
+            std::vector<Variable<T_Variable, T_Expression> *>
+                altered_variable_ptrs = {variable_ptr};
             for (auto &&associated_variable_ptr : associated_variable_ptrs) {
                 m_exclusive_moves[move_index].alterations.emplace_back(
                     associated_variable_ptr, 0);
                 m_exclusive_moves[move_index].related_constraint_ptrs.insert(
                     associated_variable_ptr->related_constraint_ptrs().begin(),
                     associated_variable_ptr->related_constraint_ptrs().end());
+                altered_variable_ptrs.push_back(associated_variable_ptr);
             }
+            m_exclusive_moves[move_index].coefficients =
+                create_move_coefficients(altered_variable_ptrs);
 
             move_index++;
         }
@@ -1034,10 +1120,26 @@ class Neighborhood {
         m_selection_moves.resize(VARIABLES_SIZE);
         m_selection_move_flags.resize(VARIABLES_SIZE);
 
+        /**
+         * The moves for the variables in a selection share the related
+         * constraint pointers.
+         */
+        std::unordered_map<
+            Selection<T_Variable, T_Expression> *,
+            utility::SharedSet<Constraint<T_Variable, T_Expression> *>>
+            related_constraint_ptrs_map;
+
         for (auto i = 0; i < VARIABLES_SIZE; i++) {
+            auto selection_ptr = a_VARIABLE_PTRS[i]->selection_ptr();
+            if (related_constraint_ptrs_map.find(selection_ptr) ==
+                related_constraint_ptrs_map.end()) {
+                related_constraint_ptrs_map[selection_ptr] =
+                    selection_ptr->related_constraint_ptrs;
+            }
+
             m_selection_moves[i].sense = MoveSense::Selection;
             m_selection_moves[i].related_constraint_ptrs =
-                a_VARIABLE_PTRS[i]->selection_ptr()->related_constraint_ptrs;
+                related_constraint_ptrs_map[selection_ptr];
             m_selection_moves[i].is_special_neighborhood_move = false;
             m_selection_moves[i].is_available                 = true;
             m_selection_moves[i].overlap_rate                 = 0.0;
@@ -1225,7 +1327,9 @@ class Neighborhood {
                 a_flags->resize(MOVES_SIZE);
 
 #ifdef _OPENMP
-#pragma omp parallel for if (a_IS_ENABLED_PARALLEL) schedule(static)
+#pragma omp parallel for if (a_IS_ENABLED_PARALLEL &&                 \
+                             MOVES_SIZE >= m_parallel_size_threshold) \
+    schedule(static)
 #endif
                 for (auto i = 0; i < MOVES_SIZE; i++) {
                     (*a_flags)[i] = 1;
@@ -1270,6 +1374,12 @@ class Neighborhood {
         const bool                  a_ACCEPT_OBJECTIVE_IMPROVABLE,    //
         const bool                  a_ACCEPT_FEASIBILITY_IMPROVABLE,  //
         [[maybe_unused]] const bool a_IS_ENABLED_PARALLEL) {
+        /**
+         * Each move updater runs in parallel only if a_IS_ENABLED_PARALLEL is
+         * true and the number of its moves is not less than the threshold,
+         * since entering a parallel region costs more than updating a small
+         * neighborhood in serial.
+         */
         auto &binary_moves         = m_binary_moves;
         auto &integer_moves        = m_integer_moves;
         auto &precedence_moves     = m_precedence_moves;
@@ -1306,12 +1416,15 @@ class Neighborhood {
         /// Binary
         if (BINARY_MOVES_SIZE > 0 &&  //
             m_is_enabled_binary_move) {
+            const bool IS_PARALLEL =
+                a_IS_ENABLED_PARALLEL &&
+                BINARY_MOVES_SIZE >= m_parallel_size_threshold;
             m_binary_move_updater(&binary_moves,                    //
                                   &binary_move_flags,               //
                                   a_ACCEPT_ALL,                     //
                                   a_ACCEPT_OBJECTIVE_IMPROVABLE,    //
                                   a_ACCEPT_FEASIBILITY_IMPROVABLE,  //
-                                  a_IS_ENABLED_PARALLEL);
+                                  IS_PARALLEL);
             number_of_candidate_moves +=
                 std::count(binary_move_flags.begin(),  //
                            binary_move_flags.end(), 1);
@@ -1320,12 +1433,15 @@ class Neighborhood {
         /// Integer
         if (INTEGER_MOVES_SIZE > 0 &&  //
             m_is_enabled_integer_move) {
+            const bool IS_PARALLEL =
+                a_IS_ENABLED_PARALLEL &&
+                INTEGER_MOVES_SIZE >= m_parallel_size_threshold;
             m_integer_move_updater(&integer_moves,                   //
                                    &integer_move_flags,              //
                                    a_ACCEPT_ALL,                     //
                                    a_ACCEPT_OBJECTIVE_IMPROVABLE,    //
                                    a_ACCEPT_FEASIBILITY_IMPROVABLE,  //
-                                   a_IS_ENABLED_PARALLEL);
+                                   IS_PARALLEL);
             number_of_candidate_moves +=
                 std::count(integer_move_flags.begin(),  //
                            integer_move_flags.end(), 1);
@@ -1334,12 +1450,15 @@ class Neighborhood {
         /// Aggregation
         if (AGGREGATION_MOVES_SIZE > 0 &&  //
             m_is_enabled_aggregation_move) {
+            const bool IS_PARALLEL =
+                a_IS_ENABLED_PARALLEL &&
+                AGGREGATION_MOVES_SIZE >= m_parallel_size_threshold;
             m_aggregation_move_updater(&aggregation_moves,               //
                                        &aggregation_move_flags,          //
                                        a_ACCEPT_ALL,                     //
                                        a_ACCEPT_OBJECTIVE_IMPROVABLE,    //
                                        a_ACCEPT_FEASIBILITY_IMPROVABLE,  //
-                                       a_IS_ENABLED_PARALLEL);
+                                       IS_PARALLEL);
             number_of_candidate_moves +=
                 std::count(aggregation_move_flags.begin(),  //
                            aggregation_move_flags.end(), 1);
@@ -1348,12 +1467,15 @@ class Neighborhood {
         /// Precedence
         if (PRECEDENCE_MOVES_SIZE > 0 &&  //
             m_is_enabled_precedence_move) {
+            const bool IS_PARALLEL =
+                a_IS_ENABLED_PARALLEL &&
+                PRECEDENCE_MOVES_SIZE >= m_parallel_size_threshold;
             m_precedence_move_updater(&precedence_moves,                //
                                       &precedence_move_flags,           //
                                       a_ACCEPT_ALL,                     //
                                       a_ACCEPT_OBJECTIVE_IMPROVABLE,    //
                                       a_ACCEPT_FEASIBILITY_IMPROVABLE,  //
-                                      a_IS_ENABLED_PARALLEL);
+                                      IS_PARALLEL);
             number_of_candidate_moves +=
                 std::count(precedence_move_flags.begin(),  //
                            precedence_move_flags.end(), 1);
@@ -1362,12 +1484,15 @@ class Neighborhood {
         /// Variable Bound
         if (VARIABLE_BOUND_MOVES_SIZE > 0 &&  //
             m_is_enabled_variable_bound_move) {
+            const bool IS_PARALLEL =
+                a_IS_ENABLED_PARALLEL &&
+                VARIABLE_BOUND_MOVES_SIZE >= m_parallel_size_threshold;
             m_variable_bound_move_updater(&variable_bound_moves,            //
                                           &variable_bound_move_flags,       //
                                           a_ACCEPT_ALL,                     //
                                           a_ACCEPT_OBJECTIVE_IMPROVABLE,    //
                                           a_ACCEPT_FEASIBILITY_IMPROVABLE,  //
-                                          a_IS_ENABLED_PARALLEL);
+                                          IS_PARALLEL);
             number_of_candidate_moves +=
                 std::count(variable_bound_move_flags.begin(),  //
                            variable_bound_move_flags.end(), 1);
@@ -1376,12 +1501,15 @@ class Neighborhood {
         /// Exclusive
         if (EXCLUSIVE_MOVES_SIZE > 0 &&  //
             m_is_enabled_exclusive_move) {
+            const bool IS_PARALLEL =
+                a_IS_ENABLED_PARALLEL &&
+                EXCLUSIVE_MOVES_SIZE >= m_parallel_size_threshold;
             m_exclusive_move_updater(&exclusive_moves,                 //
                                      &exclusive_move_flags,            //
                                      a_ACCEPT_ALL,                     //
                                      a_ACCEPT_OBJECTIVE_IMPROVABLE,    //
                                      a_ACCEPT_FEASIBILITY_IMPROVABLE,  //
-                                     a_IS_ENABLED_PARALLEL);
+                                     IS_PARALLEL);
             number_of_candidate_moves +=
                 std::count(exclusive_move_flags.begin(),  //
                            exclusive_move_flags.end(), 1);
@@ -1390,12 +1518,15 @@ class Neighborhood {
         /// Selection
         if (SELECTION_MOVES_SIZE > 0 &&  //
             m_is_enabled_selection_move) {
+            const bool IS_PARALLEL =
+                a_IS_ENABLED_PARALLEL &&
+                SELECTION_MOVES_SIZE >= m_parallel_size_threshold;
             m_selection_move_updater(&selection_moves,                 //
                                      &selection_move_flags,            //
                                      a_ACCEPT_ALL,                     //
                                      a_ACCEPT_OBJECTIVE_IMPROVABLE,    //
                                      a_ACCEPT_FEASIBILITY_IMPROVABLE,  //
-                                     a_IS_ENABLED_PARALLEL);
+                                     IS_PARALLEL);
             number_of_candidate_moves +=
                 std::count(selection_move_flags.begin(),  //
                            selection_move_flags.end(), 1);
@@ -1403,12 +1534,15 @@ class Neighborhood {
 
         /// Chain
         if (m_is_enabled_chain_move) {
+            const bool IS_PARALLEL =
+                a_IS_ENABLED_PARALLEL &&
+                CHAIN_MOVES_SIZE >= m_parallel_size_threshold;
             m_chain_move_updater(&chain_moves,                     //
                                  &chain_move_flags,                //
                                  a_ACCEPT_ALL,                     //
                                  a_ACCEPT_OBJECTIVE_IMPROVABLE,    //
                                  a_ACCEPT_FEASIBILITY_IMPROVABLE,  //
-                                 a_IS_ENABLED_PARALLEL);
+                                 IS_PARALLEL);
 
             number_of_candidate_moves +=
                 std::count(chain_move_flags.begin(),  //
@@ -1629,6 +1763,17 @@ class Neighborhood {
         return m_has_selection_variables;
     }
 
+    /*************************************************************************/
+    inline constexpr void set_parallel_size_threshold(
+        const int a_PARALLEL_SIZE_THRESHOLD) {
+        m_parallel_size_threshold = a_PARALLEL_SIZE_THRESHOLD;
+    }
+
+    /*************************************************************************/
+    inline constexpr int parallel_size_threshold(void) const {
+        return m_parallel_size_threshold;
+    }
+
     /*************************************************************************/
     inline constexpr bool is_enabled_binary_move(void) const {
         return m_is_enabled_binary_move;
@@ -1809,6 +1954,43 @@ class Neighborhood {
         return false;
     }
 
+    /*************************************************************************/
+    inline constexpr int number_of_enabled_moves(void) const {
+        /**
+         * This method returns the total number of the moves in the enabled
+         * neighborhoods, which are to be updated by update_moves(). The
+         * user-defined moves are counted by the size of the last update.
+         */
+        int number_of_moves = 0;
+        if (m_is_enabled_binary_move) {
+            number_of_moves += m_binary_moves.size();
+        }
+        if (m_is_enabled_integer_move) {
+            number_of_moves += m_integer_moves.size();
+        }
+        if (m_is_enabled_aggregation_move) {
+            number_of_moves += m_aggregation_moves.size();
+        }
+        if (m_is_enabled_precedence_move) {
+            number_of_moves += m_precedence_moves.size();
+        }
+        if (m_is_enabled_variable_bound_move) {
+            number_of_moves += m_variable_bound_moves.size();
+        }
+        if (m_is_enabled_exclusive_move) {
+            number_of_moves += m_exclusive_moves.size();
+        }
+        if (m_is_enabled_selection_move) {
+            number_of_moves += m_selection_moves.size();
+        }
+        if (m_is_enabled_chain_move) {
+            number_of_moves += m_chain_moves.size();
+        }
+        if (m_is_enabled_user_defined_move) {
+            number_of_moves += m_user_defined_moves.size();
+        }
+        return number_of_moves;
+    }
 };  // namespace model
 }  // namespace model
 }  // namespace printemps
@@ -55,6 +55,9 @@ class Variable : public AbstractMultiArrayElement {
     std::unordered_set<Constraint<T_Variable, T_Expression> *>
         m_related_monic_constraint_ptrs;
 
+    std::unordered_set<Expression<T_Variable, T_Expression> *>
+        m_related_expression_ptrs;
+
     std::unordered_map<Constraint<T_Variable, T_Expression> *, T_Expression>
                  m_constraint_sensitivities;
     T_Expression m_objective_sensitivity;
@@ -119,6 +122,7 @@ class Variable : public AbstractMultiArrayElement {
         m_sense         = VariableSense::Integer;
         m_selection_ptr = nullptr;
         m_related_constraint_ptrs.clear();
+        m_related_expression_ptrs.clear();
         m_constraint_sensitivities.clear();
         m_objective_sensitivity = 0.0;
     }
@@ -319,6 +323,30 @@ class Variable : public AbstractMultiArrayElement {
         return m_related_constraint_ptrs;
     }
 
+    /*************************************************************************/
+    inline constexpr void register_related_expression_ptr(
+        Expression<T_Variable, T_Expression> *a_expression_ptr) {
+        m_related_expression_ptrs.insert(a_expression_ptr);
+    }
+
+    /*************************************************************************/
+    inline constexpr void reset_related_expression_ptrs(void) {
+        m_related_expression_ptrs.clear();
+    }
+
+    /*************************************************************************/
+    inline constexpr std::unordered_set<Expression<T_Variable, T_Expression> *>
+        &related_expression_ptrs(void) {
+        return m_related_expression_ptrs;
+    }
+
+    /*************************************************************************/
+    inline constexpr const std::unordered_set<
+        Expression<T_Variable, T_Expression> *>
+        &related_expression_ptrs(void) const {
+        return m_related_expression_ptrs;
+    }
+
     /*************************************************************************/
     inline constexpr void setup_related_monic_constraint_ptrs(void) {
         /**
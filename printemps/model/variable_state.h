@@ -0,0 +1,216 @@
+/*****************************************************************************/
+// Copyright (c) 2020 Yuji KOGUMA
+// Released under the MIT license
+// https://opensource.org/licenses/mit-license.php
+/*****************************************************************************/
+#ifndef PRINTEMPS_MODEL_VARIABLE_STATE_H__
+#define PRINTEMPS_MODEL_VARIABLE_STATE_H__
+
+#include <vector>
+#include <cstdint>
+
+namespace printemps {
+namespace model {
+/*****************************************************************************/
+template <class T_Variable, class T_Expression>
+class Variable;
+
+/*****************************************************************************/
+template <class T_Variable, class T_Expression>
+struct Move;
+
+/*****************************************************************************/
+template <class T_Variable, class T_Expression>
+class VariableState {
+    /**
+     * VariableState is a structure-of-arrays mirror of the states of decision
+     * variables which are frequently accessed in the search loop. The arrays
+     * are indexed by the global indices of the variables. The Variable objects
+     * remain the master data, and the mirror is synchronized by Model in
+     * update(), update(move) and the improvability updating methods.
+     */
+   private:
+    std::vector<Variable<T_Variable, T_Expression> *> m_variable_ptrs;
+
+    std::vector<T_Variable>    m_values;
+    std::vector<T_Variable>    m_lower_bounds;
+    std::vector<T_Variable>    m_upper_bounds;
+    std::vector<VariableSense> m_senses;
+
+    std::vector<std::uint8_t> m_is_fixed;
+    std::vector<std::uint8_t> m_is_objective_improvable;
+    std::vector<std::uint8_t> m_is_feasibility_improvable;
+
+    bool m_is_enabled;
+
+   public:
+    /*************************************************************************/
+    VariableState(void) {
+        this->initialize();
+    }
+
+    /*************************************************************************/
+    virtual ~VariableState(void) {
+        /// nothing to do
+    }
+
+    /*************************************************************************/
+    void initialize(void) {
+        m_variable_ptrs.clear();
+
+        m_values.clear();
+        m_lower_bounds.clear();
+        m_upper_bounds.clear();
+        m_senses.clear();
+
+        m_is_fixed.clear();
+        m_is_objective_improvable.clear();
+        m_is_feasibility_improvable.clear();
+
+        m_is_enabled = false;
+    }
+
+    /*************************************************************************/
+    void setup(const std::vector<Variable<T_Variable, T_Expression> *>
+                   &a_VARIABLE_PTRS) {
+        /**
+         * The global indices of the variables must be identical to their
+         * positions in the given vector.
+         */
+        this->initialize();
+        m_variable_ptrs = a_VARIABLE_PTRS;
+
+        const int VARIABLES_SIZE = m_variable_ptrs.size();
+
+        m_values.resize(VARIABLES_SIZE);
+        m_lower_bounds.resize(VARIABLES_SIZE);
+        m_upper_bounds.resize(VARIABLES_SIZE);
+        m_senses.resize(VARIABLES_SIZE);
+
+        m_is_fixed.resize(VARIABLES_SIZE);
+        m_is_objective_improvable.resize(VARIABLES_SIZE);
+        m_is_feasibility_improvable.resize(VARIABLES_SIZE);
+
+        m_is_enabled = true;
+        this->update();
+    }
+
+    /*************************************************************************/
+    inline constexpr void update(void) noexcept {
+        if (!m_is_enabled) {
+            return;
+        }
+
+        const int VARIABLES_SIZE = m_variable_ptrs.size();
+        for (auto i = 0; i < VARIABLES_SIZE; i++) {
+            const auto &variable_ptr = m_variable_ptrs[i];
+
+            m_values[i]       = variable_ptr->value();
+            m_lower_bounds[i] = variable_ptr->lower_bound();
+            m_upper_bounds[i] = variable_ptr->upper_bound();
+            m_senses[i]       = variable_ptr->sense();
+
+            m_is_fixed[i] = variable_ptr->is_fixed();
+            m_is_objective_improvable[i] =
+                variable_ptr->is_objective_improvable();
+            m_is_feasibility_improvable[i] =
+                variable_ptr->is_feasibility_improvable();
+        }
+    }
+
+    /*************************************************************************/
+    inline constexpr void update(
+        const Move<T_Variable, T_Expression> &a_MOVE) noexcept {
+        /**
+         * This method must be called after the values of the variables are
+         * altered by the move.
+         */
+        if (!m_is_enabled) {
+            return;
+        }
+        for (const auto &alteration : a_MOVE.alterations) {
+            m_values[alteration.first->global_index()] =
+                alteration.first->value();
+        }
+    }
+
+    /*************************************************************************/
+    inline constexpr void set_is_objective_improvable(
+        const int a_INDEX, const bool a_IS_OBJECTIVE_IMPROVABLE) noexcept {
+        if (m_is_enabled) {
+            m_is_objective_improvable[a_INDEX] = a_IS_OBJECTIVE_IMPROVABLE;
+        }
+    }
+
+    /*************************************************************************/
+    inline constexpr void set_is_feasibility_improvable(
+        const int a_INDEX, const bool a_IS_FEASIBILITY_IMPROVABLE) noexcept {
+        if (m_is_enabled) {
+            m_is_feasibility_improvable[a_INDEX] = a_IS_FEASIBILITY_IMPROVABLE;
+        }
+    }
+
+    /*************************************************************************/
+    inline constexpr const std::vector<Variable<T_Variable, T_Expression> *>
+        &variable_ptrs(void) const noexcept {
+        return m_variable_ptrs;
+    }
+
+    /*************************************************************************/
+    inline constexpr const std::vector<T_Variable> &values(void) const
+        noexcept {
+        return m_values;
+    }
+
+    /*************************************************************************/
+    inline constexpr const std::vector<T_Variable> &lower_bounds(void) const
+        noexcept {
+        return m_lower_bounds;
+    }
+
+    /*************************************************************************/
+    inline constexpr const std::vector<T_Variable> &upper_bounds(void) const
+        noexcept {
+        return m_upper_bounds;
+    }
+
+    /*************************************************************************/
+    inline constexpr const std::vector<VariableSense> &senses(void) const
+        noexcept {
+        return m_senses;
+    }
+
+    /*************************************************************************/
+    inline constexpr const std::vector<std::uint8_t> &is_fixed(void) const
+        noexcept {
+        return m_is_fixed;
+    }
+
+    /*************************************************************************/
+    inline constexpr const std::vector<std::uint8_t> &is_objective_improvable(
+        void) const noexcept {
+        return m_is_objective_improvable;
+    }
+
+    /*************************************************************************/
+    inline constexpr const std::vector<std::uint8_t>
+        &is_feasibility_improvable(void) const noexcept {
+        return m_is_feasibility_improvable;
+    }
+
+    /*************************************************************************/
+    inline constexpr int size(void) const noexcept {
+        return m_variable_ptrs.size();
+    }
+
+    /*************************************************************************/
+    inline constexpr bool is_enabled(void) const noexcept {
+        return m_is_enabled;
+    }
+};
+}  // namespace model
+}  // namespace printemps
+#endif
+/*****************************************************************************/
+// END
+/*****************************************************************************/
\ No newline at end of file
@@ -0,0 +1,149 @@
+/*****************************************************************************/
+// Copyright (c) 2020 Yuji KOGUMA
+// Released under the MIT license
+// https://opensource.org/licenses/mit-license.php
+/*****************************************************************************/
+#ifndef PRINTEMPS_MODEL_VIOLATIVE_CONSTRAINT_SET_H__
+#define PRINTEMPS_MODEL_VIOLATIVE_CONSTRAINT_SET_H__
+
+#include <vector>
+
+namespace printemps {
+namespace model {
+/*****************************************************************************/
+template <class T_Variable, class T_Expression>
+class Constraint;
+
+/*****************************************************************************/
+template <class T_Variable, class T_Expression>
+class ViolativeConstraintSet {
+    /**
+     * ViolativeConstraintSet keeps the constraints whose violation values
+     * exceed the tolerance. The membership is maintained incrementally for
+     * the constraints updated by a move, so that the feasibility of the
+     * model can be checked in O(1). The positions of the members are indexed
+     * by the global indices of the constraints, and a member is removed by
+     * swapping it with the last one.
+     */
+   private:
+    std::vector<Constraint<T_Variable, T_Expression> *> m_constraint_ptrs;
+    std::vector<Constraint<T_Variable, T_Expression> *>
+                     m_violative_constraint_ptrs;
+    std::vector<int> m_positions;
+
+    bool m_is_enabled;
+
+   public:
+    /*************************************************************************/
+    ViolativeConstraintSet(void) {
+        this->initialize();
+    }
+
+    /*************************************************************************/
+    virtual ~ViolativeConstraintSet(void) {
+        /// nothing to do
+    }
+
+    /*************************************************************************/
+    void initialize(void) {
+        m_constraint_ptrs.clear();
+        m_violative_constraint_ptrs.clear();
+        m_positions.clear();
+
+        m_is_enabled = false;
+    }
+
+    /*************************************************************************/
+    void setup(const std::vector<Constraint<T_Variable, T_Expression> *>
+                   &a_CONSTRAINT_PTRS) {
+        /**
+         * The global indices of the constraints must be identical to their
+         * positions in the given vector.
+         */
+        this->initialize();
+        m_constraint_ptrs = a_CONSTRAINT_PTRS;
+        m_violative_constraint_ptrs.reserve(m_constraint_ptrs.size());
+        m_positions.resize(m_constraint_ptrs.size(), -1);
+
+        m_is_enabled = true;
+        this->update();
+    }
+
+    /*************************************************************************/
+    inline constexpr void update(void) noexcept {
+        if (!m_is_enabled) {
+            return;
+        }
+
+        m_violative_constraint_ptrs.clear();
+        const int CONSTRAINTS_SIZE = m_constraint_ptrs.size();
+        for (auto i = 0; i < CONSTRAINTS_SIZE; i++) {
+            m_positions[i] = -1;
+            this->update(m_constraint_ptrs[i]);
+        }
+    }
+
+    /*************************************************************************/
+    inline constexpr void update(
+        Constraint<T_Variable, T_Expression> *a_constraint_ptr) noexcept {
+        /**
+         * This method must be called after the violation value of the
+         * constraint is updated.
+         */
+        if (!m_is_enabled) {
+            return;
+        }
+
+        const bool IS_VIOLATIVE =
+            a_constraint_ptr->violation_value() > constant::EPSILON;
+
+        const int INDEX    = a_constraint_ptr->global_index();
+        const int POSITION = m_positions[INDEX];
+
+        if (IS_VIOLATIVE && POSITION < 0) {
+            m_positions[INDEX] = m_violative_constraint_ptrs.size();
+            m_violative_constraint_ptrs.push_back(a_constraint_ptr);
+        } else if (!IS_VIOLATIVE && POSITION >= 0) {
+            auto last_ptr = m_violative_constraint_ptrs.back();
+
+            m_violative_constraint_ptrs[POSITION] = last_ptr;
+            m_positions[last_ptr->global_index()] = POSITION;
+            m_positions[INDEX]                    = -1;
+            m_violative_constraint_ptrs.pop_back();
+        }
+    }
+
+    /*************************************************************************/
+    inline constexpr bool contains(
+        const Constraint<T_Variable, T_Expression> *a_CONSTRAINT_PTR) const
+        noexcept {
+        return m_positions[a_CONSTRAINT_PTR->global_index()] >= 0;
+    }
+
+    /*************************************************************************/
+    inline constexpr const std::vector<Constraint<T_Variable, T_Expression> *>
+        &constraint_ptrs(void) const noexcept {
+        return m_violative_constraint_ptrs;
+    }
+
+    /*************************************************************************/
+    inline constexpr int size(void) const noexcept {
+        return m_violative_constraint_ptrs.size();
+    }
+
+    /*************************************************************************/
+    inline constexpr bool empty(void) const noexcept {
+        return m_violative_constraint_ptrs.empty();
+    }
+
+    /*************************************************************************/
+    inline constexpr bool is_enabled(void) const noexcept {
+        return m_is_enabled;
+    }
+};
+}  // namespace model
+}  // namespace printemps
+#endif
+/*****************************************************************************/
+// END
+/*****************************************************************************/
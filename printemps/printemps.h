@@ -9,6 +9,7 @@
 #include "constant.h"
 #include "model/model.h"
 #include "solver/solver.h"
+#include "solver/multi_start/multi_start.h"
 #include "utility/utility.h"
 #endif
 
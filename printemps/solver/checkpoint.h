@@ -0,0 +1,688 @@
+/*****************************************************************************/
+// Copyright (c) 2020 Yuji KOGUMA
+// Released under the MIT license
+// https://opensource.org/licenses/mit-license.php
+/*****************************************************************************/
+#ifndef PRINTEMPS_SOLVER_CHECKPOINT_H__
+#define PRINTEMPS_SOLVER_CHECKPOINT_H__
+
+#include <cstdint>
+#include <cstdio>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <random>
+#include <stdexcept>
+
+#include "../model/model.h"
+#include "memory.h"
+
+namespace printemps {
+namespace solver {
+/*****************************************************************************/
+struct CheckpointConstant {
+    static constexpr std::uint32_t MAGIC_NUMBER   = 0x50435053;  // "SPCP"
+    static constexpr std::uint32_t FORMAT_VERSION = 1;
+};
+
+/*****************************************************************************/
+template <class T_Variable, class T_Expression>
+struct Checkpoint {
+    /**
+     * Checkpoint holds the state of the outer loop of the solver at the end
+     * of a tabu search loop: the incumbent, current, and previous solutions,
+     * the local penalty coefficients, the memory, the chain moves and the
+     * states of the special neighborhoods, the parameters adjusted in the
+     * loop, the iteration counters, and the state of the random generator.
+     * The solutions are held as compact ones indexed by the global indices,
+     * so that the checkpoint is written to a binary file with a few
+     * sequential writes. The solver restores the state for the same model
+     * and resumes the tabu search loops. The historical feasible solutions
+     * and the profile are not included.
+     */
+    using Solution_T = model::CompactSolution<T_Variable, T_Expression>;
+
+    int number_of_variables;
+    int number_of_constraints;
+
+    bool                 is_found_feasible_solution;
+    Solution_T           global_augmented_incumbent_solution;
+    model::SolutionScore global_augmented_incumbent_score;
+    Solution_T           feasible_incumbent_solution;
+    model::SolutionScore feasible_incumbent_score;
+
+    Solution_T           current_solution;
+    model::SolutionScore current_solution_score;
+    Solution_T           previous_solution;
+    model::SolutionScore previous_solution_score;
+
+    std::vector<double> local_penalty_coefficients;
+
+    std::vector<int> last_update_iterations;
+    std::vector<int> update_counts;
+    long             total_update_counts;
+
+    std::vector<int>        chain_move_begins;
+    std::vector<int>        chain_move_variable_indices;
+    std::vector<T_Variable> chain_move_values;
+
+    bool is_enabled_aggregation_move;
+    bool is_enabled_precedence_move;
+    bool is_enabled_variable_bound_move;
+    bool is_enabled_exclusive_move;
+    bool is_enabled_chain_move;
+
+    int    iteration;
+    int    no_global_augmented_incumbent_update_count;
+    int    no_update_count;
+    int    termination_status;
+    bool   penalty_coefficient_reset_flag;
+    int    initial_tabu_tenure;
+    double pruning_rate_threshold;
+    int    number_of_initial_modification;
+    int    iteration_max;
+    int    improvability_screening_mode;
+
+    int number_of_lagrange_dual_iterations;
+    int number_of_local_search_iterations;
+    int number_of_tabu_search_iterations;
+    int number_of_tabu_search_loops;
+
+    double      elapsed_time;
+    std::string random_generator_state;
+
+    /*************************************************************************/
+    Checkpoint(void) {
+        this->initialize();
+    }
+
+    /*************************************************************************/
+    virtual ~Checkpoint(void) {
+        /// nothing to do
+    }
+
+    /*************************************************************************/
+    void initialize(void) {
+        this->number_of_variables   = 0;
+        this->number_of_constraints = 0;
+
+        this->is_found_feasible_solution = false;
+        this->global_augmented_incumbent_solution.initialize();
+        this->global_augmented_incumbent_score = model::SolutionScore();
+        this->feasible_incumbent_solution.initialize();
+        this->feasible_incumbent_score = model::SolutionScore();
+
+        this->current_solution.initialize();
+        this->current_solution_score = model::SolutionScore();
+        this->previous_solution.initialize();
+        this->previous_solution_score = model::SolutionScore();
+
+        this->local_penalty_coefficients.clear();
+
+        this->last_update_iterations.clear();
+        this->update_counts.clear();
+        this->total_update_counts = 0;
+
+        this->chain_move_begins.assign(1, 0);
+        this->chain_move_variable_indices.clear();
+        this->chain_move_values.clear();
+
+        this->is_enabled_aggregation_move    = false;
+        this->is_enabled_precedence_move     = false;
+        this->is_enabled_variable_bound_move = false;
+        this->is_enabled_exclusive_move      = false;
+        this->is_enabled_chain_move          = false;
+
+        this->iteration                                  = 0;
+        this->no_global_augmented_incumbent_update_count = 0;
+        this->no_update_count                            = 0;
+        this->termination_status                         = 0;
+        this->penalty_coefficient_reset_flag             = false;
+        this->initial_tabu_tenure                        = 0;
+        this->pruning_rate_threshold                     = 0.0;
+        this->number_of_initial_modification             = 0;
+        this->iteration_max                              = 0;
+        this->improvability_screening_mode               = 0;
+
+        this->number_of_lagrange_dual_iterations = 0;
+        this->number_of_local_search_iterations  = 0;
+        this->number_of_tabu_search_iterations   = 0;
+        this->number_of_tabu_search_loops        = 0;
+
+        this->elapsed_time = 0.0;
+        this->random_generator_state.clear();
+    }
+
+    /*************************************************************************/
+    inline void export_model_state(
+        model::Model<T_Variable, T_Expression> *a_model) {
+        /**
+         * This method copies the local penalty coefficients, the chain moves,
+         * and the states of the special neighborhoods from the model.
+         */
+        const auto &variable_ptrs = a_model->variable_reference().variable_ptrs;
+        const auto &constraint_ptrs =
+            a_model->constraint_reference().constraint_ptrs;
+
+        this->number_of_variables   = variable_ptrs.size();
+        this->number_of_constraints = constraint_ptrs.size();
+
+        this->local_penalty_coefficients.resize(this->number_of_constraints);
+        for (auto i = 0; i < this->number_of_constraints; i++) {
+            this->local_penalty_coefficients[i] =
+                constraint_ptrs[i]->local_penalty_coefficient();
+        }
+
+        auto &neighborhood = a_model->neighborhood();
+
+        this->chain_move_begins.assign(1, 0);
+        this->chain_move_variable_indices.clear();
+        this->chain_move_values.clear();
+        for (const auto &move : neighborhood.chain_moves()) {
+            for (const auto &alteration : move.alterations) {
+                this->chain_move_variable_indices.push_back(
+                    alteration.first->global_index());
+                this->chain_move_values.push_back(alteration.second);
+            }
+            this->chain_move_begins.push_back(
+                this->chain_move_variable_indices.size());
+        }
+
+        this->is_enabled_aggregation_move =
+            neighborhood.is_enabled_aggregation_move();
+        this->is_enabled_precedence_move =
+            neighborhood.is_enabled_precedence_move();
+        this->is_enabled_variable_bound_move =
+            neighborhood.is_enabled_variable_bound_move();
+        this->is_enabled_exclusive_move =
+            neighborhood.is_enabled_exclusive_move();
+        this->is_enabled_chain_move = neighborhood.is_enabled_chain_move();
+    }
+
+    /*************************************************************************/
+    inline void import_model_state(
+        model::Model<T_Variable, T_Expression> *a_model) const {
+        /**
+         * This method restores the local penalty coefficients, the chain
+         * moves, and the states of the special neighborhoods to the model.
+         * The chain moves are rebuilt by concatenating single-variable moves
+         * as they are created in the tabu search, so that their related
+         * constraints and overlap rates refer to the current model.
+         */
+        using Move_T = model::Move<T_Variable, T_Expression>;
+
+        const auto &variable_ptrs = a_model->variable_reference().variable_ptrs;
+        const auto &constraint_ptrs =
+            a_model->constraint_reference().constraint_ptrs;
+
+        if (static_cast<int>(variable_ptrs.size()) !=
+                this->number_of_variables ||
+            static_cast<int>(constraint_ptrs.size()) !=
+                this->number_of_constraints) {
+            throw std::logic_error(utility::format_error_location(
+                __FILE__, __LINE__, __func__,
+                "The checkpoint does not match the model."));
+        }
+
+        if (!this->is_consistent_model_state()) {
+            throw std::logic_error(utility::format_error_location(
+                __FILE__, __LINE__, __func__, "The checkpoint is broken."));
+        }
+
+        for (auto i = 0; i < this->number_of_constraints; i++) {
+            constraint_ptrs[i]->local_penalty_coefficient() =
+                this->local_penalty_coefficients[i];
+        }
+
+        auto &neighborhood = a_model->neighborhood();
+        neighborhood.clear_chain_moves();
+
+        const int CHAIN_MOVES_SIZE =
+            static_cast<int>(this->chain_move_begins.size()) - 1;
+        for (auto i = 0; i < CHAIN_MOVES_SIZE; i++) {
+            Move_T chain_move;
+            for (auto j = this->chain_move_begins[i];
+                 j < this->chain_move_begins[i + 1]; j++) {
+                auto variable_ptr =
+                    variable_ptrs[this->chain_move_variable_indices[j]];
+
+                Move_T move;
+                move.sense = model::MoveSense::Chain;
+                move.alterations.emplace_back(variable_ptr,
+                                              this->chain_move_values[j]);
+                move.related_constraint_ptrs =
+                    variable_ptr->related_constraint_ptrs();
+
+                chain_move = (j == this->chain_move_begins[i])
+                                 ? move
+                                 : chain_move + move;
+            }
+            neighborhood.register_chain_move(chain_move);
+        }
+
+        if (this->is_enabled_aggregation_move) {
+            neighborhood.enable_aggregation_move();
+        } else {
+            neighborhood.disable_aggregation_move();
+        }
+        if (this->is_enabled_precedence_move) {
+            neighborhood.enable_precedence_move();
+        } else {
+            neighborhood.disable_precedence_move();
+        }
+        if (this->is_enabled_variable_bound_move) {
+            neighborhood.enable_variable_bound_move();
+        } else {
+            neighborhood.disable_variable_bound_move();
+        }
+        if (this->is_enabled_exclusive_move) {
+            neighborhood.enable_exclusive_move();
+        } else {
+            neighborhood.disable_exclusive_move();
+        }
+        if (this->is_enabled_chain_move) {
+            neighborhood.enable_chain_move();
+        } else {
+            neighborhood.disable_chain_move();
+        }
+
+        if (neighborhood.is_enabled_special_neighborhood_move()) {
+            neighborhood.reset_special_neighborhood_moves_availability();
+        }
+    }
+
+    /*************************************************************************/
+    inline bool is_consistent(void) const {
+        /**
+         * This method checks that the lengths of the stored vectors match the
+         * numbers of the variables and the constraints, and that the chain
+         * moves refer only to existing variables. The solutions other than
+         * the feasible incumbent must be complete; the feasible incumbent may
+         * be empty if no feasible solution has been found.
+         */
+        if (!this->is_consistent_model_state()) {
+            return false;
+        }
+
+        if (!this->is_consistent_solution(
+                this->global_augmented_incumbent_solution, false) ||
+            !this->is_consistent_solution(
+                this->feasible_incumbent_solution,
+                !this->is_found_feasible_solution) ||
+            !this->is_consistent_solution(this->current_solution, false) ||
+            !this->is_consistent_solution(this->previous_solution, false)) {
+            return false;
+        }
+
+        if (static_cast<int>(this->last_update_iterations.size()) !=
+                this->number_of_variables ||
+            static_cast<int>(this->update_counts.size()) !=
+                this->number_of_variables) {
+            return false;
+        }
+        return true;
+    }
+
+    /*************************************************************************/
+    inline bool is_consistent_model_state(void) const {
+        /**
+         * This method checks the part of the checkpoint restored by
+         * import_model_state().
+         */
+        if (this->number_of_variables < 0 || this->number_of_constraints < 0) {
+            return false;
+        }
+
+        if (static_cast<int>(this->local_penalty_coefficients.size()) !=
+            this->number_of_constraints) {
+            return false;
+        }
+
+        /**
+         * The beginnings of the chain moves must start with 0, be monotone,
+         * and end with the number of the stored alterations.
+         */
+        const int ALTERATIONS_SIZE = this->chain_move_variable_indices.size();
+        if (this->chain_move_begins.empty() ||
+            this->chain_move_begins.front() != 0 ||
+            this->chain_move_begins.back() != ALTERATIONS_SIZE ||
+            static_cast<int>(this->chain_move_values.size()) !=
+                ALTERATIONS_SIZE) {
+            return false;
+        }
+
+        const int CHAIN_MOVES_SIZE =
+            static_cast<int>(this->chain_move_begins.size()) - 1;
+        for (auto i = 0; i < CHAIN_MOVES_SIZE; i++) {
+            if (this->chain_move_begins[i] > this->chain_move_begins[i + 1]) {
+                return false;
+            }
+        }
+
+        for (const auto &index : this->chain_move_variable_indices) {
+            if (index < 0 || index >= this->number_of_variables) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    /*************************************************************************/
+    inline void export_memory(const Memory &a_MEMORY) {
+        this->last_update_iterations = a_MEMORY.last_update_iterations();
+        this->update_counts          = a_MEMORY.update_counts();
+        this->total_update_counts    = a_MEMORY.total_update_counts();
+    }
+
+    /*************************************************************************/
+    inline void import_memory(Memory *a_memory) const {
+        a_memory->import_values(this->last_update_iterations,
+                                this->update_counts,
+                                this->total_update_counts);
+    }
+
+    /*************************************************************************/
+    inline void export_random_generator(const std::mt19937 &a_GET_RAND_MT) {
+        std::ostringstream oss;
+        oss << a_GET_RAND_MT;
+        this->random_generator_state = oss.str();
+    }
+
+    /*************************************************************************/
+    inline void import_random_generator(std::mt19937 *a_get_rand_mt) const {
+        std::istringstream iss(this->random_generator_state);
+        iss >> *a_get_rand_mt;
+    }
+
+    /*************************************************************************/
+    inline bool write(const std::string &a_FILE_NAME) const {
+        /**
+         * This method writes the checkpoint to a temporary file and renames
+         * it to the specified file, so that an interruption while writing
+         * does not break the last checkpoint. It returns false if the file
+         * could not be written.
+         */
+        const std::string TEMPORARY_FILE_NAME = a_FILE_NAME + ".tmp";
+        {
+            std::ofstream ofs(TEMPORARY_FILE_NAME.c_str(),
+                              std::ios::binary | std::ios::trunc);
+            if (!ofs) {
+                return false;
+            }
+
+            write_value(&ofs, static_cast<std::uint32_t>(
+                                  CheckpointConstant::MAGIC_NUMBER));
+            write_value(&ofs, static_cast<std::uint32_t>(
+                                  CheckpointConstant::FORMAT_VERSION));
+            write_value(&ofs, static_cast<std::uint32_t>(sizeof(T_Variable)));
+            write_value(&ofs,
+                        static_cast<std::uint32_t>(sizeof(T_Expression)));
+
+            write_value(&ofs, this->number_of_variables);
+            write_value(&ofs, this->number_of_constraints);
+
+            write_value(&ofs, this->is_found_feasible_solution);
+            write_solution(&ofs, this->global_augmented_incumbent_solution);
+            write_value(&ofs, this->global_augmented_incumbent_score);
+            write_solution(&ofs, this->feasible_incumbent_solution);
+            write_value(&ofs, this->feasible_incumbent_score);
+
+            write_solution(&ofs, this->current_solution);
+            write_value(&ofs, this->current_solution_score);
+            write_solution(&ofs, this->previous_solution);
+            write_value(&ofs, this->previous_solution_score);
+
+            write_vector(&ofs, this->local_penalty_coefficients);
+
+            write_vector(&ofs, this->last_update_iterations);
+            write_vector(&ofs, this->update_counts);
+            write_value(&ofs, this->total_update_counts);
+
+            write_vector(&ofs, this->chain_move_begins);
+            write_vector(&ofs, this->chain_move_variable_indices);
+            write_vector(&ofs, this->chain_move_values);
+
+            write_value(&ofs, this->is_enabled_aggregation_move);
+            write_value(&ofs, this->is_enabled_precedence_move);
+            write_value(&ofs, this->is_enabled_variable_bound_move);
+            write_value(&ofs, this->is_enabled_exclusive_move);
+            write_value(&ofs, this->is_enabled_chain_move);
+
+            write_value(&ofs, this->iteration);
+            write_value(&ofs, this->no_global_augmented_incumbent_update_count);
+            write_value(&ofs, this->no_update_count);
+            write_value(&ofs, this->termination_status);
+            write_value(&ofs, this->penalty_coefficient_reset_flag);
+            write_value(&ofs, this->initial_tabu_tenure);
+            write_value(&ofs, this->pruning_rate_threshold);
+            write_value(&ofs, this->number_of_initial_modification);
+            write_value(&ofs, this->iteration_max);
+            write_value(&ofs, this->improvability_screening_mode);
+
+            write_value(&ofs, this->number_of_lagrange_dual_iterations);
+            write_value(&ofs, this->number_of_local_search_iterations);
+            write_value(&ofs, this->number_of_tabu_search_iterations);
+            write_value(&ofs, this->number_of_tabu_search_loops);
+
+            write_value(&ofs, this->elapsed_time);
+            write_string(&ofs, this->random_generator_state);
+
+            ofs.close();
+            if (!ofs) {
+                return false;
+            }
+        }
+        return std::rename(TEMPORARY_FILE_NAME.c_str(), a_FILE_NAME.c_str()) ==
+               0;
+    }
+
+    /*************************************************************************/
+    inline void read(const std::string &a_FILE_NAME) {
+        std::ifstream ifs(a_FILE_NAME.c_str(), std::ios::binary);
+        if (!ifs) {
+            throw std::logic_error(utility::format_error_location(
+                __FILE__, __LINE__, __func__,
+                "The checkpoint file " + a_FILE_NAME + " cannot be opened."));
+        }
+
+        this->initialize();
+
+        std::uint32_t magic_number        = 0;
+        std::uint32_t format_version      = 0;
+        std::uint32_t variable_type_size   = 0;
+        std::uint32_t expression_type_size = 0;
+        read_value(&ifs, &magic_number);
+        read_value(&ifs, &format_version);
+        read_value(&ifs, &variable_type_size);
+        read_value(&ifs, &expression_type_size);
+
+        if (magic_number != CheckpointConstant::MAGIC_NUMBER ||
+            format_version != CheckpointConstant::FORMAT_VERSION ||
+            variable_type_size != sizeof(T_Variable) ||
+            expression_type_size != sizeof(T_Expression)) {
+            throw std::logic_error(utility::format_error_location(
+                __FILE__, __LINE__, __func__,
+                "The file " + a_FILE_NAME + " is not a valid checkpoint."));
+        }
+
+        read_value(&ifs, &this->number_of_variables);
+        read_value(&ifs, &this->number_of_constraints);
+
+        read_value(&ifs, &this->is_found_feasible_solution);
+        read_solution(&ifs, &this->global_augmented_incumbent_solution);
+        read_value(&ifs, &this->global_augmented_incumbent_score);
+        read_solution(&ifs, &this->feasible_incumbent_solution);
+        read_value(&ifs, &this->feasible_incumbent_score);
+
+        read_solution(&ifs, &this->current_solution);
+        read_value(&ifs, &this->current_solution_score);
+        read_solution(&ifs, &this->previous_solution);
+        read_value(&ifs, &this->previous_solution_score);
+
+        read_vector(&ifs, &this->local_penalty_coefficients);
+
+        read_vector(&ifs, &this->last_update_iterations);
+        read_vector(&ifs, &this->update_counts);
+        read_value(&ifs, &this->total_update_counts);
+
+        read_vector(&ifs, &this->chain_move_begins);
+        read_vector(&ifs, &this->chain_move_variable_indices);
+        read_vector(&ifs, &this->chain_move_values);
+
+        read_value(&ifs, &this->is_enabled_aggregation_move);
+        read_value(&ifs, &this->is_enabled_precedence_move);
+        read_value(&ifs, &this->is_enabled_variable_bound_move);
+        read_value(&ifs, &this->is_enabled_exclusive_move);
+        read_value(&ifs, &this->is_enabled_chain_move);
+
+        read_value(&ifs, &this->iteration);
+        read_value(&ifs, &this->no_global_augmented_incumbent_update_count);
+        read_value(&ifs, &this->no_update_count);
+        read_value(&ifs, &this->termination_status);
+        read_value(&ifs, &this->penalty_coefficient_reset_flag);
+        read_value(&ifs, &this->initial_tabu_tenure);
+        read_value(&ifs, &this->pruning_rate_threshold);
+        read_value(&ifs, &this->number_of_initial_modification);
+        read_value(&ifs, &this->iteration_max);
+        read_value(&ifs, &this->improvability_screening_mode);
+
+        read_value(&ifs, &this->number_of_lagrange_dual_iterations);
+        read_value(&ifs, &this->number_of_local_search_iterations);
+        read_value(&ifs, &this->number_of_tabu_search_iterations);
+        read_value(&ifs, &this->number_of_tabu_search_loops);
+
+        read_value(&ifs, &this->elapsed_time);
+        read_string(&ifs, &this->random_generator_state);
+
+        if (!ifs || !this->is_consistent()) {
+            throw std::logic_error(utility::format_error_location(
+                __FILE__, __LINE__, __func__,
+                "The checkpoint file " + a_FILE_NAME + " is broken."));
+        }
+    }
+
+   private:
+    /*************************************************************************/
+    inline bool is_consistent_solution(const Solution_T &a_SOLUTION,
+                                       const bool        a_ACCEPT_EMPTY) const {
+        if (a_ACCEPT_EMPTY && a_SOLUTION.variables.empty() &&
+            a_SOLUTION.violations.empty()) {
+            return true;
+        }
+        return static_cast<int>(a_SOLUTION.variables.size()) ==
+                   this->number_of_variables &&
+               static_cast<int>(a_SOLUTION.violations.size()) ==
+                   this->number_of_constraints;
+    }
+
+    /*************************************************************************/
+    template <class T>
+    inline static void write_value(std::ofstream *a_ofs, const T &a_VALUE) {
+        a_ofs->write(reinterpret_cast<const char *>(&a_VALUE), sizeof(T));
+    }
+
+    /*************************************************************************/
+    template <class T>
+    inline static void write_vector(std::ofstream *       a_ofs,
+                                    const std::vector<T> &a_VALUES) {
+        const std::uint64_t SIZE = a_VALUES.size();
+        write_value(a_ofs, SIZE);
+        if (SIZE > 0) {
+            a_ofs->write(reinterpret_cast<const char *>(a_VALUES.data()),
+                         sizeof(T) * SIZE);
+        }
+    }
+
+    /*************************************************************************/
+    inline static void write_string(std::ofstream *    a_ofs,
+                                    const std::string &a_VALUE) {
+        const std::uint64_t SIZE = a_VALUE.size();
+        write_value(a_ofs, SIZE);
+        a_ofs->write(a_VALUE.data(), SIZE);
+    }
+
+    /*************************************************************************/
+    inline static void write_solution(std::ofstream *   a_ofs,
+                                      const Solution_T &a_SOLUTION) {
+        write_vector(a_ofs, a_SOLUTION.variables);
+        write_vector(a_ofs, a_SOLUTION.violations);
+        write_value(a_ofs, a_SOLUTION.objective);
+        write_value(a_ofs, a_SOLUTION.total_violation);
+        write_value(a_ofs, a_SOLUTION.is_feasible);
+    }
+
+    /*************************************************************************/
+    template <class T>
+    inline static void read_value(std::ifstream *a_ifs, T *a_value) {
+        a_ifs->read(reinterpret_cast<char *>(a_value), sizeof(T));
+    }
+
+    /*************************************************************************/
+    inline static std::uint64_t remaining_size(std::ifstream *a_ifs) {
+        const auto POSITION = a_ifs->tellg();
+        a_ifs->seekg(0, std::ios::end);
+        const auto END = a_ifs->tellg();
+        a_ifs->seekg(POSITION);
+        return static_cast<std::uint64_t>(END - POSITION);
+    }
+
+    /*************************************************************************/
+    template <class T>
+    inline static void read_vector(std::ifstream *a_ifs,
+                                   std::vector<T> *a_values) {
+        /**
+         * The size read from the file is checked against the remaining size
+         * of the file before the allocation, so that a broken checkpoint
+         * fails the stream instead of allocating an arbitrary size.
+         */
+        std::uint64_t size = 0;
+        read_value(a_ifs, &size);
+        if (!*a_ifs) {
+            return;
+        }
+        if (size > remaining_size(a_ifs) / sizeof(T)) {
+            a_ifs->setstate(std::ios::failbit);
+            return;
+        }
+        a_values->resize(size);
+        if (size > 0) {
+            a_ifs->read(reinterpret_cast<char *>(a_values->data()),
+                        sizeof(T) * size);
+        }
+    }
+
+    /*************************************************************************/
+    inline static void read_string(std::ifstream *a_ifs,
+                                   std::string *  a_value) {
+        std::uint64_t size = 0;
+        read_value(a_ifs, &size);
+        if (!*a_ifs) {
+            return;
+        }
+        if (size > remaining_size(a_ifs)) {
+            a_ifs->setstate(std::ios::failbit);
+            return;
+        }
+        a_value->resize(size);
+        if (size > 0) {
+            a_ifs->read(&(*a_value)[0], size);
+        }
+    }
+
+    /*************************************************************************/
+    inline static void read_solution(std::ifstream *a_ifs,
+                                     Solution_T *   a_solution) {
+        read_vector(a_ifs, &a_solution->variables);
+        read_vector(a_ifs, &a_solution->violations);
+        read_value(a_ifs, &a_solution->objective);
+        read_value(a_ifs, &a_solution->total_violation);
+        read_value(a_ifs, &a_solution->is_feasible);
+    }
+};
+}  // namespace solver
+}  // namespace printemps
+
+#endif
+/*****************************************************************************/
+// END
+/*****************************************************************************/
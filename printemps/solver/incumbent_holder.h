@@ -6,6 +6,7 @@
 #ifndef PRINTEMPS_SOLVER_INCUMBENT_HOLDER_H__
 #define PRINTEMPS_SOLVER_INCUMBENT_HOLDER_H__
 
+#include <array>
 #include <unordered_map>
 #include <string>
 
@@ -27,12 +28,13 @@ class IncumbentHolder {
    private:
     bool m_is_found_feasible_solution;
 
-    model::Solution<T_Variable, T_Expression>
+    model::CompactSolution<T_Variable, T_Expression>
         m_local_augmented_incumbent_solution;
-    model::Solution<T_Variable, T_Expression>
+    model::CompactSolution<T_Variable, T_Expression>
         m_global_augmented_incumbent_solution;
 
-    model::Solution<T_Variable, T_Expression> m_feasible_incumbent_solution;
+    model::CompactSolution<T_Variable, T_Expression>
+        m_feasible_incumbent_solution;
 
     /**
      * following double-type members contain incumbent objective values as
@@ -74,8 +76,8 @@ class IncumbentHolder {
 
     /*************************************************************************/
     constexpr int try_update_incumbent(
-        const model::Solution<T_Variable, T_Expression> &a_SOLUTION,
-        const model::SolutionScore &                     a_SCORE) {
+        const model::CompactSolution<T_Variable, T_Expression> &a_SOLUTION,
+        const model::SolutionScore &                            a_SCORE) {
         int status = IncumbentHolderConstant::STATUS_NO_UPDATED;
 
         /**
@@ -123,8 +125,15 @@ class IncumbentHolder {
     constexpr int try_update_incumbent(
         model::Model<T_Variable, T_Expression> *a_model,
         const model::SolutionScore &            a_SCORE) {
+        /**
+         * The solution is exported without the violations of the constraints
+         * since the incumbents are updated frequently in the search; the
+         * total violation and the feasibility are taken from a_SCORE. The
+         * violations are filled by fill_violations() at the end of the
+         * search.
+         */
         /// solution here defined is not substituted when no improvement
-        model::Solution<T_Variable, T_Expression> solution;
+        model::CompactSolution<T_Variable, T_Expression> solution;
 
         bool is_solution_updated = false;
 
@@ -135,7 +144,7 @@ class IncumbentHolder {
                 STATUS_LOCAL_AUGMENTED_INCUMBENT_UPDATE;
 
             if (!is_solution_updated) {
-                solution            = a_model->export_solution();
+                solution            = a_model->export_compact_solution(a_SCORE);
                 is_solution_updated = true;
             }
 
@@ -151,7 +160,7 @@ class IncumbentHolder {
                 STATUS_GLOBAL_AUGMENTED_INCUMBENT_UPDATE;
 
             if (!is_solution_updated) {
-                solution            = a_model->export_solution();
+                solution            = a_model->export_compact_solution(a_SCORE);
                 is_solution_updated = true;
             }
 
@@ -170,7 +179,8 @@ class IncumbentHolder {
                     IncumbentHolderConstant::STATUS_FEASIBLE_INCUMBENT_UPDATE;
 
                 if (!is_solution_updated) {
-                    solution            = a_model->export_solution();
+                    solution            =
+                        a_model->export_compact_solution(a_SCORE);
                     is_solution_updated = true;
                 }
 
@@ -182,6 +192,48 @@ class IncumbentHolder {
         return status;
     }
 
+    /*************************************************************************/
+    void fill_violations(model::Model<T_Variable, T_Expression> *a_model) {
+        /**
+         * This method fills the violations of the incumbent solutions stored
+         * without them, by evaluating the solutions with the model. The
+         * variable values of the model are restored after the evaluation.
+         */
+        const int CONSTRAINTS_SIZE =
+            a_model->constraint_reference().constraint_ptrs.size();
+
+        std::array<model::CompactSolution<T_Variable, T_Expression> *, 3>
+            solution_ptrs = {&m_local_augmented_incumbent_solution,
+                             &m_global_augmented_incumbent_solution,
+                             &m_feasible_incumbent_solution};
+
+        auto is_required = [CONSTRAINTS_SIZE](const auto &a_SOLUTION_PTR) {
+            return !a_SOLUTION_PTR->variables.empty() &&
+                   static_cast<int>(a_SOLUTION_PTR->violations.size()) !=
+                       CONSTRAINTS_SIZE;
+        };
+
+        if (std::none_of(solution_ptrs.begin(), solution_ptrs.end(),
+                         is_required)) {
+            return;
+        }
+
+        const auto VARIABLE_VALUES = a_model->export_variable_values();
+
+        for (auto &&solution_ptr : solution_ptrs) {
+            if (!is_required(solution_ptr)) {
+                continue;
+            }
+            a_model->import_variable_values(solution_ptr->variables);
+            a_model->update();
+            solution_ptr->violations =
+                a_model->export_compact_solution().violations;
+        }
+
+        a_model->import_variable_values(VARIABLE_VALUES);
+        a_model->update();
+    }
+
     /*************************************************************************/
     inline constexpr void reset_local_augmented_incumbent(void) {
         m_local_augmented_incumbent_objective =
@@ -194,19 +246,19 @@ class IncumbentHolder {
     }
 
     /*************************************************************************/
-    inline constexpr const model::Solution<T_Variable, T_Expression>
+    inline constexpr const model::CompactSolution<T_Variable, T_Expression>
         &local_augmented_incumbent_solution(void) const {
         return m_local_augmented_incumbent_solution;
     }
 
     /*************************************************************************/
-    inline constexpr const model::Solution<T_Variable, T_Expression>
+    inline constexpr const model::CompactSolution<T_Variable, T_Expression>
         &global_augmented_incumbent_solution(void) const {
         return m_global_augmented_incumbent_solution;
     }
 
     /*************************************************************************/
-    inline constexpr const model::Solution<T_Variable, T_Expression>
+    inline constexpr const model::CompactSolution<T_Variable, T_Expression>
         &feasible_incumbent_solution(void) const {
         return m_feasible_incumbent_solution;
     }
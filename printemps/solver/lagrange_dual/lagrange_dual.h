@@ -6,6 +6,9 @@
 #ifndef PRINTEMPS_SOLVER_LAGRANGE_DUAL_LAGRANGE_DUAL_H__
 #define PRINTEMPS_SOLVER_LAGRANGE_DUAL_LAGRANGE_DUAL_H__
 
+#include "../profiler.h"
+#include "../trace_writer.h"
+#include "lagrange_dual_engine.h"
 #include "lagrange_dual_option.h"
 #include "lagrange_dual_print.h"
 #include "lagrange_dual_result.h"
@@ -22,47 +25,13 @@ class IncumbentHolder;
 struct Option;
 
 namespace lagrange_dual {
-/*****************************************************************************/
-template <class T_Variable, class T_Expression>
-void bound_dual(model::Model<T_Variable, T_Expression>* a_model,
-                std::vector<model::ValueProxy<double>>* a_dual_value_proxies) {
-    for (auto&& proxy : a_model->constraint_proxies()) {
-        for (auto&& constraint : proxy.flat_indexed_constraints()) {
-            int proxy_index = constraint.proxy_index();
-            int flat_index  = constraint.flat_index();
-
-            auto& lagrange_multiplier =
-                (*a_dual_value_proxies)[proxy_index].flat_indexed_values(
-                    flat_index);
-
-            switch (constraint.sense()) {
-                case model::ConstraintSense::Lower: {
-                    lagrange_multiplier = std::max(lagrange_multiplier, 0.0);
-                    break;
-                }
-                case model::ConstraintSense::Upper: {
-                    lagrange_multiplier = std::min(lagrange_multiplier, 0.0);
-                    break;
-                }
-                case model::ConstraintSense::Equal: {
-                    /// nothing to do
-                    break;
-                }
-                default: {
-                    /// nothing to do
-                }
-            }
-        }
-    }
-}
-
 /*****************************************************************************/
 template <class T_Variable, class T_Expression>
 LagrangeDualResult<T_Variable, T_Expression> solve(
     model::Model<T_Variable, T_Expression>* a_model,   //
     const Option&                           a_OPTION,  //
-    const std::vector<model::ValueProxy<T_Variable>>&  //
-        a_INITIAL_VARIABLE_VALUE_PROXIES,              //
+    const std::vector<T_Variable>&                     //
+        a_INITIAL_VARIABLE_VALUES,                     //
     const IncumbentHolder<T_Variable, T_Expression>&   //
         a_INCUMBENT_HOLDER) {
     /**
@@ -71,6 +40,7 @@ LagrangeDualResult<T_Variable, T_Expression> solve(
     using Model_T           = model::Model<T_Variable, T_Expression>;
     using Result_T          = LagrangeDualResult<T_Variable, T_Expression>;
     using IncumbentHolder_T = IncumbentHolder<T_Variable, T_Expression>;
+    using Engine_T          = LagrangeDualEngine<T_Variable, T_Expression>;
 
     /**
      * Start to measure computational time.
@@ -90,7 +60,7 @@ LagrangeDualResult<T_Variable, T_Expression> solve(
      */
     incumbent_holder.reset_local_augmented_incumbent();
 
-    model->import_variable_values(a_INITIAL_VARIABLE_VALUE_PROXIES);
+    model->import_variable_values(a_INITIAL_VARIABLE_VALUES);
     model->update();
 
     /**
@@ -105,16 +75,16 @@ LagrangeDualResult<T_Variable, T_Expression> solve(
     /**
      * Prepare the primal solution.
      */
-    auto primal_incumbent = model->export_solution();
+    auto primal_incumbent = model->export_compact_solution();
 
     /**
-     * Prepare the dual solution as lagrange multipliers.
+     * Prepare the engine of the subgradient iterations, which holds the
+     * primal solution and the dual solution as lagrange multipliers.
      */
-    std::vector<model::ValueProxy<double>> dual_value_proxies =
-        model->generate_constraint_parameter_proxies(0.0);
-    bound_dual(model, &dual_value_proxies);
+    Engine_T engine;
+    engine.setup(model);
 
-    auto dual_value_proxies_incumbent = dual_value_proxies;
+    auto dual_values_incumbent = engine.dual_values();
 
     /**
      * Prepare the lagrangian incumbent and its queue.
@@ -128,6 +98,25 @@ LagrangeDualResult<T_Variable, T_Expression> solve(
      */
     double step_size = 1.0 / model->number_of_variables();
 
+    /**
+     * Prepare the center of the volume algorithm (optional). The center is
+     * initialized by the dual values 0, and the primal estimate is
+     * initialized by the primal solution which minimizes the lagrangian for
+     * them.
+     */
+    const bool IS_ENABLED_VOLUME =
+        option.lagrange_dual.method == LagrangeDualMethod::Volume;
+    double center_lagrangian = -HUGE_VALF;
+
+    if (IS_ENABLED_VOLUME) {
+        engine.update_primal(option.is_enabled_parallel_evaluation);
+        engine.update_average(1.0, option.is_enabled_parallel_evaluation);
+        center_lagrangian     = engine.lagrangian();
+        lagrangian_incumbent  = center_lagrangian;
+        primal_incumbent      = engine.export_compact_solution();
+        dual_values_incumbent = engine.dual_values();
+    }
+
     /**
      * Prepare historical solutions holder.
      */
@@ -160,8 +149,15 @@ LagrangeDualResult<T_Variable, T_Expression> solve(
      */
     int iteration = 0;
 
-    auto variable_ptrs   = model->variable_reference().variable_ptrs;
-    auto constraint_ptrs = model->constraint_reference().constraint_ptrs;
+    /**
+     * Prepare the profiler of the phases and the trace writer (optional).
+     */
+    Profiler profiler;
+    profiler.setup(option.is_enabled_profile ||
+                   option.trace_mode != TraceMode::None);
+
+    TraceWriter trace_writer;
+    trace_writer.open(option.trace_file_name, option.trace_mode);
 
     while (true) {
         /**
@@ -186,84 +182,81 @@ LagrangeDualResult<T_Variable, T_Expression> solve(
             break;
         }
 
-        /**
-         * Update the dual solution.
-         */
-        const int CONSTRAINTS_SIZE = constraint_ptrs.size();
-#ifdef _OPENMP
-#pragma omp parallel for if (option.is_enabled_parallel_evaluation) \
-    schedule(static)
-#endif
-        for (auto i = 0; i < CONSTRAINTS_SIZE; i++) {
-            double constraint_value = constraint_ptrs[i]->constraint_value();
-            int    proxy_index      = constraint_ptrs[i]->proxy_index();
-            int    flat_index       = constraint_ptrs[i]->flat_index();
-
-            dual_value_proxies[proxy_index].flat_indexed_values(flat_index) +=
-                step_size * constraint_value;
-        }
+        profiler.start_iteration();
 
         /**
-         * Bound the values of dual solution.
+         * Update the dual solution. The volume algorithm moves the dual
+         * solution from the center along the averaged subgradient.
          */
-        bound_dual(model, &dual_value_proxies);
+        profiler.start();
+        if (IS_ENABLED_VOLUME) {
+            engine.update_dual_from_center(
+                step_size, option.is_enabled_parallel_evaluation);
+        } else {
+            engine.update_dual(step_size,
+                               option.is_enabled_parallel_evaluation);
+        }
+        profiler.stop(ProfilePhase::DualUpdate);
 
         /**
          * Update the primal optimal solution so that it minimizes lagrangian
          * for the updated dual solution.
          */
-        const int VARIABLES_SIZE = variable_ptrs.size();
-#ifdef _OPENMP
-#pragma omp parallel for if (option.is_enabled_parallel_evaluation) \
-    schedule(static)
-#endif
-        for (auto i = 0; i < VARIABLES_SIZE; i++) {
-            if (variable_ptrs[i]->is_fixed()) {
-                continue;
-            }
-            double coefficient = variable_ptrs[i]->objective_sensitivity();
-
-            for (auto&& item : variable_ptrs[i]->constraint_sensitivities()) {
-                const auto& constraint_ptr = item.first;
-                double      sensitivity    = item.second;
-
-                int proxy_index = constraint_ptr->proxy_index();
-                int flat_index  = constraint_ptr->flat_index();
+        profiler.start();
+        engine.update_primal(option.is_enabled_parallel_evaluation);
+        profiler.stop(ProfilePhase::PrimalUpdate);
 
-                coefficient +=
-                    dual_value_proxies[proxy_index].flat_indexed_values(
-                        flat_index) *
-                    sensitivity * model->sign();
-            }
+        /**
+         * Compute the lagrangian value.
+         */
+        double lagrangian = engine.lagrangian();
 
-            if (coefficient > 0) {
-                if (model->is_minimization()) {
-                    variable_ptrs[i]->set_value_if_not_fixed(
-                        variable_ptrs[i]->lower_bound());
-                } else {
-                    variable_ptrs[i]->set_value_if_not_fixed(
-                        variable_ptrs[i]->upper_bound());
-                }
-
-            } else {
-                if (model->is_minimization()) {
-                    variable_ptrs[i]->set_value_if_not_fixed(
-                        variable_ptrs[i]->upper_bound());
-                } else {
-                    variable_ptrs[i]->set_value_if_not_fixed(
-                        variable_ptrs[i]->lower_bound());
-                }
+        /**
+         * Update the primal estimate and the center of the volume algorithm
+         * (optional). The center moves only if the lagrangian is improved.
+         */
+        bool is_improved_center = false;
+        if (IS_ENABLED_VOLUME) {
+            profiler.start();
+            const double AVERAGING_RATE = engine.compute_averaging_rate(
+                option.lagrange_dual.volume_averaging_rate_max,
+                option.is_enabled_parallel_evaluation);
+            engine.update_average(AVERAGING_RATE,
+                                  option.is_enabled_parallel_evaluation);
+            if (lagrangian > center_lagrangian) {
+                engine.update_center();
+                center_lagrangian  = lagrangian;
+                is_improved_center = true;
             }
+            profiler.stop(ProfilePhase::Averaging);
         }
 
         /**
-         * Update the model.
+         * Evaluate the primal solution. The model is updated only if its
+         * solution is required for the incumbent or the historical data.
          */
-        model->update();
-        solution_score = model->evaluate({});
+        profiler.start();
+        solution_score = engine.evaluate();
+
+        const bool IS_REQUIRED_MODEL_UPDATE =
+            solution_score.local_augmented_objective + constant::EPSILON <
+                incumbent_holder.local_augmented_incumbent_objective() ||
+            solution_score.global_augmented_objective + constant::EPSILON <
+                incumbent_holder.global_augmented_incumbent_objective() ||
+            solution_score.is_feasible;
+
+        if (IS_REQUIRED_MODEL_UPDATE) {
+            engine.export_to_model(model);
+            solution_score = model->evaluate({});
+        }
+        profiler.stop(ProfilePhase::ModelUpdate);
 
-        update_status =
-            incumbent_holder.try_update_incumbent(model, solution_score);
+        profiler.start();
+        update_status = IncumbentHolderConstant::STATUS_NO_UPDATED;
+        if (IS_REQUIRED_MODEL_UPDATE) {
+            update_status =
+                incumbent_holder.try_update_incumbent(model, solution_score);
+        }
         total_update_status = update_status || total_update_status;
 
         /**
@@ -273,20 +266,15 @@ LagrangeDualResult<T_Variable, T_Expression> solve(
             historical_feasible_solutions.push_back(
                 model->export_plain_solution());
         }
-
-        /**
-         * Compute the lagrangian value.
-         */
-        double lagrangian =
-            model->compute_lagrangian(dual_value_proxies) * model->sign();
+        profiler.stop(ProfilePhase::IncumbentUpdate);
 
         /**
          * Update the lagrangian incumbent.
          */
         if (lagrangian > lagrangian_incumbent) {
-            lagrangian_incumbent         = lagrangian;
-            auto primal_incumbent        = model->export_solution();
-            dual_value_proxies_incumbent = dual_value_proxies;
+            lagrangian_incumbent  = lagrangian;
+            primal_incumbent      = engine.export_compact_solution();
+            dual_values_incumbent = engine.dual_values();
         }
 
         /**
@@ -297,9 +285,14 @@ LagrangeDualResult<T_Variable, T_Expression> solve(
         double queue_max     = queue.max();
 
         /**
-         * Adjust the step size.
+         * Adjust the step size. The volume algorithm extends the step size
+         * if the center moved, and reduces it otherwise.
          */
-        if (queue.size() > 0) {
+        if (IS_ENABLED_VOLUME) {
+            step_size *= is_improved_center
+                             ? option.lagrange_dual.step_size_extend_rate
+                             : option.lagrange_dual.step_size_reduce_rate;
+        } else if (queue.size() > 0) {
             if (lagrangian > queue_average) {
                 step_size *= option.lagrange_dual.step_size_extend_rate;
             }
@@ -323,6 +316,19 @@ LagrangeDualResult<T_Variable, T_Expression> solve(
                              option.verbose >= Verbose::Full);
         }
 
+        /**
+         * Write the trace of the iteration (optional).
+         */
+        if (trace_writer.is_enabled()) {
+            trace_writer.write(
+                "lagrange_dual",                                  //
+                iteration,                                        //
+                elapsed_time + option.lagrange_dual.time_offset,  //
+                solution_score,                                   //
+                0,                                                //
+                profiler);
+        }
+
         /**
          * Terminate the loop if lagrangian converges.
          */
@@ -334,6 +340,23 @@ LagrangeDualResult<T_Variable, T_Expression> solve(
             break;
         }
 
+        /**
+         * Terminate the loop if the primal estimate of the volume algorithm
+         * is almost feasible and its objective is close to the lagrangian of
+         * the center.
+         */
+        if (IS_ENABLED_VOLUME &&
+            engine.averaged_total_violation() <
+                std::max(1, model->number_of_constraints()) *
+                    option.lagrange_dual.tolerance &&
+            fabs(engine.averaged_objective() * model->sign() -
+                 center_lagrangian) <
+                std::max(1.0, fabs(center_lagrangian)) *
+                    option.lagrange_dual.tolerance) {
+            termination_status = LagrangeDualTerminationStatus::CONVERGE;
+            break;
+        }
+
         iteration++;
     }
 
@@ -342,18 +365,34 @@ LagrangeDualResult<T_Variable, T_Expression> solve(
      */
     print_table_footer(option.verbose >= Verbose::Full);
 
+    /**
+     * Synchronize the model with the last primal solution.
+     */
+    engine.export_to_model(model);
+
+    /**
+     * Fill the violations of the incumbent solutions, which are stored
+     * without them in the iterations.
+     */
+    incumbent_holder.fill_violations(model);
+
     /**
      * Prepare the result.
      */
     Result_T result;
-    result.lagrangian                    = lagrangian_incumbent;
-    result.primal_solution               = primal_incumbent;
-    result.dual_value_proxies            = dual_value_proxies_incumbent;
+    result.lagrangian      = lagrangian_incumbent;
+    result.primal_solution = primal_incumbent;
+    result.dual_value_proxies =
+        Engine_T::export_dual_value_proxies(model, dual_values_incumbent);
+    if (IS_ENABLED_VOLUME) {
+        result.primal_estimate = engine.averaged_variable_values();
+    }
     result.incumbent_holder              = incumbent_holder;
     result.total_update_status           = total_update_status;
     result.number_of_iterations          = iteration;
     result.termination_status            = termination_status;
     result.historical_feasible_solutions = historical_feasible_solutions;
+    result.profiler                      = profiler;
 
     return result;
 }
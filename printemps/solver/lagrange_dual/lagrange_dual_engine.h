@@ -0,0 +1,652 @@
+/*****************************************************************************/
+// Copyright (c) 2020 Yuji KOGUMA
+// Released under the MIT license
+// https://opensource.org/licenses/mit-license.php
+/*****************************************************************************/
+#ifndef PRINTEMPS_SOLVER_LAGRANGE_DUAL_LAGRANGE_DUAL_ENGINE_H__
+#define PRINTEMPS_SOLVER_LAGRANGE_DUAL_LAGRANGE_DUAL_ENGINE_H__
+
+#include <vector>
+#include <algorithm>
+
+namespace printemps {
+namespace solver {
+namespace lagrange_dual {
+/*****************************************************************************/
+struct LagrangeDualEngineConstant {
+    static constexpr int DEFAULT_BLOCK_SIZE = 4096;
+};
+
+/*****************************************************************************/
+template <class T_Variable, class T_Expression>
+class LagrangeDualEngine {
+    /**
+     * LagrangeDualEngine performs the subgradient iterations of the Lagrange
+     * dual problem of a linear model on flat vectors indexed by the global
+     * indices of the variables and the constraints, without updating the
+     * model in each iteration. The reduced costs of the variables are
+     * computed by the sparse matrix-vector product over the CSC format of the
+     * constraint matrix. The constraint values, the objective, and the
+     * lagrangian are updated incrementally only for the variables whose
+     * values flipped between the bounds. The model is synchronized by
+     * export_to_model() only when its solution is required, for example, for
+     * updating the incumbent.
+     *
+     * Every floating-point reduction is computed in a fixed order which does
+     * not depend on the number of threads, so that the multi-threaded
+     * iterations give bitwise identical results to the single-threaded ones.
+     *
+     * For the volume algorithm, the engine also holds the center of the dual
+     * values and the moving averages of the primal solutions, the constraint
+     * values, and the objective. The averaged primal solution is an estimate
+     * of a solution of the primal LP relaxation.
+     */
+   private:
+    model::ConstraintMatrix<T_Variable, T_Expression>        m_own_matrix;
+    const model::ConstraintMatrix<T_Variable, T_Expression> *m_matrix_ptr;
+
+    std::vector<model::Variable<T_Variable, T_Expression> *> m_variable_ptrs;
+    std::vector<model::Constraint<T_Variable, T_Expression> *>
+        m_constraint_ptrs;
+
+    std::vector<T_Variable>   m_variable_values;
+    std::vector<T_Variable>   m_next_variable_values;
+    std::vector<T_Variable>   m_minimizing_values;
+    std::vector<T_Variable>   m_maximizing_values;
+    std::vector<char>         m_is_fixed;
+    std::vector<double>       m_objective_coefficients;
+    std::vector<double>       m_reduced_costs;
+    std::vector<T_Expression> m_constraint_values;
+    std::vector<double>       m_dual_values;
+    std::vector<double>       m_block_partial_sums;
+
+    std::vector<double> m_center_dual_values;
+    std::vector<double> m_averaged_variable_values;
+    std::vector<double> m_averaged_constraint_values;
+
+    int    m_block_size;
+    double m_sign;
+    double m_objective;
+    double m_dual_product;
+    double m_averaged_objective;
+    double m_averaged_total_violation;
+    int    m_number_of_flipped_variables;
+
+   public:
+    /*************************************************************************/
+    LagrangeDualEngine(void) {
+        this->initialize();
+    }
+
+    /*************************************************************************/
+    virtual ~LagrangeDualEngine(void) {
+        /// nothing to do
+    }
+
+    /*************************************************************************/
+    void initialize(void) {
+        m_own_matrix.initialize();
+        m_matrix_ptr = nullptr;
+
+        m_variable_ptrs.clear();
+        m_constraint_ptrs.clear();
+
+        m_variable_values.clear();
+        m_next_variable_values.clear();
+        m_minimizing_values.clear();
+        m_maximizing_values.clear();
+        m_is_fixed.clear();
+        m_objective_coefficients.clear();
+        m_reduced_costs.clear();
+        m_constraint_values.clear();
+        m_dual_values.clear();
+        m_block_partial_sums.clear();
+
+        m_center_dual_values.clear();
+        m_averaged_variable_values.clear();
+        m_averaged_constraint_values.clear();
+
+        m_block_size = LagrangeDualEngineConstant::DEFAULT_BLOCK_SIZE;
+        m_sign                        = 1.0;
+        m_objective                   = 0.0;
+        m_dual_product                = 0.0;
+        m_averaged_objective          = 0.0;
+        m_averaged_total_violation    = 0.0;
+        m_number_of_flipped_variables = 0;
+    }
+
+    /*************************************************************************/
+    void setup(model::Model<T_Variable, T_Expression> *a_model) {
+        /**
+         * This method copies the current state of the model, which must be
+         * linear and updated. The constraint matrix of the model is used if
+         * it is available, and otherwise the engine builds its own one. The
+         * dual values and their center are initialized by 0, and the averages
+         * are initialized by the current state.
+         */
+        this->initialize();
+
+        m_variable_ptrs   = a_model->variable_reference().variable_ptrs;
+        m_constraint_ptrs = a_model->constraint_reference().constraint_ptrs;
+
+        if (a_model->constraint_matrix().is_enabled()) {
+            m_matrix_ptr = &a_model->constraint_matrix();
+        } else {
+            m_own_matrix.setup(m_variable_ptrs, m_constraint_ptrs, nullptr);
+            m_matrix_ptr = &m_own_matrix;
+        }
+
+        const int VARIABLES_SIZE   = m_variable_ptrs.size();
+        const int CONSTRAINTS_SIZE = m_constraint_ptrs.size();
+
+        /**
+         * The value which minimizes the lagrangian for a positive reduced
+         * cost is the lower bound for a minimization problem and the upper
+         * bound for a maximization problem.
+         */
+        const bool IS_MINIMIZATION = a_model->is_minimization();
+
+        m_variable_values.resize(VARIABLES_SIZE);
+        m_minimizing_values.resize(VARIABLES_SIZE);
+        m_maximizing_values.resize(VARIABLES_SIZE);
+        m_is_fixed.resize(VARIABLES_SIZE);
+        m_objective_coefficients.resize(VARIABLES_SIZE);
+        for (auto i = 0; i < VARIABLES_SIZE; i++) {
+            const auto &variable_ptr = m_variable_ptrs[i];
+            m_variable_values[i]     = variable_ptr->value();
+            m_is_fixed[i]            = variable_ptr->is_fixed();
+            m_objective_coefficients[i] =
+                variable_ptr->objective_sensitivity();
+            m_minimizing_values[i] = IS_MINIMIZATION
+                                         ? variable_ptr->lower_bound()
+                                         : variable_ptr->upper_bound();
+            m_maximizing_values[i] = IS_MINIMIZATION
+                                         ? variable_ptr->upper_bound()
+                                         : variable_ptr->lower_bound();
+        }
+        m_next_variable_values = m_variable_values;
+        m_reduced_costs.assign(VARIABLES_SIZE, 0.0);
+
+        m_constraint_values.resize(CONSTRAINTS_SIZE);
+        for (auto i = 0; i < CONSTRAINTS_SIZE; i++) {
+            m_constraint_values[i] = m_constraint_ptrs[i]->constraint_value();
+        }
+        m_dual_values.assign(CONSTRAINTS_SIZE, 0.0);
+
+        m_sign         = a_model->sign();
+        m_objective    = a_model->is_defined_objective()
+                             ? a_model->objective().value()
+                             : 0.0;
+        m_dual_product = 0.0;
+
+        m_center_dual_values.assign(CONSTRAINTS_SIZE, 0.0);
+        m_averaged_variable_values.assign(m_variable_values.begin(),
+                                          m_variable_values.end());
+        m_averaged_constraint_values.assign(m_constraint_values.begin(),
+                                            m_constraint_values.end());
+        m_averaged_objective = m_objective;
+        m_averaged_total_violation = this->compute_blocked_sum(
+            CONSTRAINTS_SIZE,
+            [this](const int a_INDEX) {
+                return this->compute_averaged_violation(a_INDEX);
+            },
+            false);
+    }
+
+    /*************************************************************************/
+    inline void update_dual(const double a_STEP_SIZE,
+                            const bool   a_IS_ENABLED_PARALLEL) {
+        /**
+         * This method moves the dual values along the subgradient, i.e., the
+         * constraint values, and projects them onto the feasible region of
+         * the dual problem.
+         */
+        this->update_dual_values(m_dual_values,        //
+                                 m_constraint_values,  //
+                                 a_STEP_SIZE,          //
+                                 a_IS_ENABLED_PARALLEL);
+    }
+
+    /*************************************************************************/
+    inline void update_dual_from_center(const double a_STEP_SIZE,
+                                        const bool   a_IS_ENABLED_PARALLEL) {
+        /**
+         * This method moves the dual values from the center along the
+         * averaged constraint values, and projects them onto the feasible
+         * region of the dual problem, as the volume algorithm does.
+         */
+        this->update_dual_values(m_center_dual_values,          //
+                                 m_averaged_constraint_values,  //
+                                 a_STEP_SIZE,                   //
+                                 a_IS_ENABLED_PARALLEL);
+    }
+
+    /*************************************************************************/
+    inline void update_primal(const bool a_IS_ENABLED_PARALLEL) {
+        /**
+         * This method computes the reduced costs by the product of the
+         * transposed constraint matrix and the dual values, and sets each
+         * variable to the bound which minimizes the lagrangian. The reduced
+         * costs are computed column by column in parallel; each of them is
+         * accumulated by a single thread in the order of the CSC format, and
+         * hence does not depend on the number of threads. Then, the
+         * constraint values, the objective, and the inner product of the dual
+         * values and the constraint values are updated in serial only for
+         * the columns of the flipped variables.
+         */
+        const auto &column_begins = m_matrix_ptr->column_begins();
+        const auto &column_constraint_indices =
+            m_matrix_ptr->column_constraint_indices();
+        const auto &column_coefficients = m_matrix_ptr->column_coefficients();
+
+        const int VARIABLES_SIZE = m_variable_ptrs.size();
+#ifdef _OPENMP
+#pragma omp parallel for if (a_IS_ENABLED_PARALLEL) schedule(static)
+#endif
+        for (auto i = 0; i < VARIABLES_SIZE; i++) {
+            if (m_is_fixed[i]) {
+                continue;
+            }
+            double dual_sum = 0.0;
+            for (auto j = column_begins[i]; j < column_begins[i + 1]; j++) {
+                dual_sum += m_dual_values[column_constraint_indices[j]] *
+                            column_coefficients[j];
+            }
+            const double REDUCED_COST =
+                m_objective_coefficients[i] + dual_sum * m_sign;
+            m_reduced_costs[i] = REDUCED_COST;
+            m_next_variable_values[i] =
+                REDUCED_COST > 0 ? m_minimizing_values[i]
+                                 : m_maximizing_values[i];
+        }
+#ifndef _OPENMP
+        static_cast<void>(a_IS_ENABLED_PARALLEL);
+#endif
+
+        m_number_of_flipped_variables = 0;
+        for (auto i = 0; i < VARIABLES_SIZE; i++) {
+            const T_Variable VALUE_DIFFERENCE =
+                m_next_variable_values[i] - m_variable_values[i];
+            if (VALUE_DIFFERENCE == 0) {
+                continue;
+            }
+            for (auto j = column_begins[i]; j < column_begins[i + 1]; j++) {
+                const int CONSTRAINT_INDEX = column_constraint_indices[j];
+                const T_Expression DIFFERENCE =
+                    column_coefficients[j] * VALUE_DIFFERENCE;
+                m_constraint_values[CONSTRAINT_INDEX] += DIFFERENCE;
+                m_dual_product += m_dual_values[CONSTRAINT_INDEX] * DIFFERENCE;
+            }
+            m_objective += m_objective_coefficients[i] * VALUE_DIFFERENCE;
+            m_variable_values[i] = m_next_variable_values[i];
+            m_number_of_flipped_variables++;
+        }
+    }
+
+    /*************************************************************************/
+    inline double compute_averaging_rate(const double a_AVERAGING_RATE_MAX,
+                                         const bool a_IS_ENABLED_PARALLEL) {
+        /**
+         * This method returns the rate of the moving averages for the volume
+         * algorithm. The rate a minimizes the norm of the averaged constraint
+         * values a * g + (1 - a) * g_avg updated by the current constraint
+         * values g, and is clipped to [a_max / 10, a_max].
+         */
+        const int CONSTRAINTS_SIZE = m_constraint_values.size();
+
+        const double INNER_PRODUCT = this->compute_blocked_sum(
+            CONSTRAINTS_SIZE,
+            [this](const int a_INDEX) {
+                return m_averaged_constraint_values[a_INDEX] *
+                       (m_constraint_values[a_INDEX] -
+                        m_averaged_constraint_values[a_INDEX]);
+            },
+            a_IS_ENABLED_PARALLEL);
+
+        const double SQUARED_NORM = this->compute_blocked_sum(
+            CONSTRAINTS_SIZE,
+            [this](const int a_INDEX) {
+                const double DIFFERENCE = m_constraint_values[a_INDEX] -
+                                          m_averaged_constraint_values[a_INDEX];
+                return DIFFERENCE * DIFFERENCE;
+            },
+            a_IS_ENABLED_PARALLEL);
+
+        if (SQUARED_NORM < constant::EPSILON_10) {
+            return a_AVERAGING_RATE_MAX;
+        }
+        return std::max(
+            0.1 * a_AVERAGING_RATE_MAX,
+            std::min(-INNER_PRODUCT / SQUARED_NORM, a_AVERAGING_RATE_MAX));
+    }
+
+    /*************************************************************************/
+    inline void update_average(const double a_AVERAGING_RATE,
+                               const bool   a_IS_ENABLED_PARALLEL) {
+        /**
+         * This method updates the moving averages of the primal solution,
+         * the constraint values, and the objective by the current ones. The
+         * total violation of the averaged constraint values is recomputed in
+         * the same loop.
+         */
+        const double RATE = a_AVERAGING_RATE;
+
+        const int VARIABLES_SIZE = m_variable_values.size();
+#ifdef _OPENMP
+#pragma omp parallel for if (a_IS_ENABLED_PARALLEL) schedule(static)
+#endif
+        for (auto i = 0; i < VARIABLES_SIZE; i++) {
+            m_averaged_variable_values[i] =
+                RATE * m_variable_values[i] +
+                (1.0 - RATE) * m_averaged_variable_values[i];
+        }
+
+#ifndef _OPENMP
+        static_cast<void>(a_IS_ENABLED_PARALLEL);
+#endif
+
+        m_averaged_total_violation = this->compute_blocked_sum(
+            m_constraint_values.size(),
+            [this, RATE](const int a_INDEX) {
+                m_averaged_constraint_values[a_INDEX] =
+                    RATE * m_constraint_values[a_INDEX] +
+                    (1.0 - RATE) * m_averaged_constraint_values[a_INDEX];
+                return this->compute_averaged_violation(a_INDEX);
+            },
+            a_IS_ENABLED_PARALLEL);
+
+        m_averaged_objective =
+            RATE * m_objective + (1.0 - RATE) * m_averaged_objective;
+    }
+
+    /*************************************************************************/
+    inline void update_center(void) {
+        m_center_dual_values = m_dual_values;
+    }
+
+    /*************************************************************************/
+    inline model::SolutionScore evaluate(void) const noexcept {
+        /**
+         * This method returns the score of the current primal solution, which
+         * is identical to that returned by Model::evaluate({}) after the
+         * model is synchronized.
+         */
+        double total_violation = 0.0;
+        double local_penalty   = 0.0;
+        double global_penalty  = 0.0;
+
+        const int CONSTRAINTS_SIZE = m_constraint_ptrs.size();
+        for (auto i = 0; i < CONSTRAINTS_SIZE; i++) {
+            const auto &constraint_ptr = m_constraint_ptrs[i];
+            if (!constraint_ptr->is_enabled()) {
+                continue;
+            }
+            const double VIOLATION =
+                constraint_ptr->compute_violation(m_constraint_values[i]);
+            total_violation += VIOLATION;
+            local_penalty +=
+                VIOLATION * constraint_ptr->local_penalty_coefficient();
+            global_penalty +=
+                VIOLATION * constraint_ptr->global_penalty_coefficient();
+        }
+
+        const double OBJECTIVE = m_objective * m_sign;
+
+        model::SolutionScore score;
+        score.objective                  = OBJECTIVE;
+        score.objective_improvement      = 0.0;
+        score.total_violation            = total_violation;
+        score.local_penalty              = local_penalty;
+        score.global_penalty             = global_penalty;
+        score.local_augmented_objective  = OBJECTIVE + local_penalty;
+        score.global_augmented_objective = OBJECTIVE + global_penalty;
+        score.is_feasible = !(total_violation > constant::EPSILON);
+        score.is_objective_improvable   = false;
+        score.is_feasibility_improvable = false;
+        return score;
+    }
+
+    /*************************************************************************/
+    inline model::CompactSolution<T_Variable, T_Expression>
+    export_compact_solution(void) const {
+        /**
+         * This method returns the current primal solution in the same form as
+         * Model::export_compact_solution() without updating the model.
+         */
+        model::CompactSolution<T_Variable, T_Expression> compact_solution;
+        compact_solution.variables = m_variable_values;
+
+        const int    CONSTRAINTS_SIZE = m_constraint_ptrs.size();
+        T_Expression total_violation  = 0;
+        bool         is_feasible      = true;
+        compact_solution.violations.resize(CONSTRAINTS_SIZE);
+        for (auto i = 0; i < CONSTRAINTS_SIZE; i++) {
+            const auto VIOLATION =
+                m_constraint_ptrs[i]->compute_violation(m_constraint_values[i]);
+            compact_solution.violations[i] = VIOLATION;
+            total_violation += VIOLATION;
+            if (VIOLATION > constant::EPSILON) {
+                is_feasible = false;
+            }
+        }
+
+        compact_solution.objective       = m_objective;
+        compact_solution.total_violation = total_violation;
+        compact_solution.is_feasible     = is_feasible;
+
+        return compact_solution;
+    }
+
+    /*************************************************************************/
+    inline void export_to_model(
+        model::Model<T_Variable, T_Expression> *a_model) const {
+        /**
+         * This method sets the current primal solution to the model and
+         * updates it.
+         */
+        const int VARIABLES_SIZE = m_variable_ptrs.size();
+        for (auto i = 0; i < VARIABLES_SIZE; i++) {
+            m_variable_ptrs[i]->set_value_if_not_fixed(m_variable_values[i]);
+        }
+        a_model->update();
+    }
+
+    /*************************************************************************/
+    inline static std::vector<model::ValueProxy<double>>
+    export_dual_value_proxies(
+        const model::Model<T_Variable, T_Expression> *a_MODEL,
+        const std::vector<double> &                   a_DUAL_VALUES) {
+        /**
+         * This method returns the dual values indexed by the global indices
+         * of the constraints, e.g., dual_values(), arranged in the shapes of
+         * the constraint proxies of the model.
+         */
+        auto dual_value_proxies =
+            a_MODEL->generate_constraint_parameter_proxies(0.0);
+        int global_index = 0;
+        for (auto &&proxy : dual_value_proxies) {
+            for (auto &&value : proxy.flat_indexed_values()) {
+                value = a_DUAL_VALUES[global_index++];
+            }
+        }
+        return dual_value_proxies;
+    }
+
+    /*************************************************************************/
+    inline constexpr void set_block_size(const int a_BLOCK_SIZE) noexcept {
+        m_block_size = std::max(1, a_BLOCK_SIZE);
+    }
+
+    /*************************************************************************/
+    inline constexpr int block_size(void) const noexcept {
+        return m_block_size;
+    }
+
+    /*************************************************************************/
+    inline constexpr double lagrangian(void) const noexcept {
+        return (m_objective + m_dual_product) * m_sign;
+    }
+
+    /*************************************************************************/
+    inline constexpr double objective(void) const noexcept {
+        return m_objective;
+    }
+
+    /*************************************************************************/
+    inline constexpr const std::vector<T_Variable> &variable_values(
+        void) const noexcept {
+        return m_variable_values;
+    }
+
+    /*************************************************************************/
+    inline constexpr const std::vector<double> &reduced_costs(void) const
+        noexcept {
+        return m_reduced_costs;
+    }
+
+    /*************************************************************************/
+    inline constexpr const std::vector<T_Expression> &constraint_values(
+        void) const noexcept {
+        return m_constraint_values;
+    }
+
+    /*************************************************************************/
+    inline constexpr const std::vector<double> &dual_values(void) const
+        noexcept {
+        return m_dual_values;
+    }
+
+    /*************************************************************************/
+    inline constexpr int number_of_flipped_variables(void) const noexcept {
+        return m_number_of_flipped_variables;
+    }
+
+    /*************************************************************************/
+    inline constexpr const std::vector<double> &center_dual_values(void) const
+        noexcept {
+        return m_center_dual_values;
+    }
+
+    /*************************************************************************/
+    inline constexpr const std::vector<double> &averaged_variable_values(
+        void) const noexcept {
+        return m_averaged_variable_values;
+    }
+
+    /*************************************************************************/
+    inline constexpr const std::vector<double> &averaged_constraint_values(
+        void) const noexcept {
+        return m_averaged_constraint_values;
+    }
+
+    /*************************************************************************/
+    inline constexpr double averaged_objective(void) const noexcept {
+        return m_averaged_objective;
+    }
+
+    /*************************************************************************/
+    inline constexpr double averaged_total_violation(void) const noexcept {
+        /**
+         * The total violation of the averaged constraint values measures the
+         * infeasibility of the primal estimate of the volume algorithm.
+         */
+        return m_averaged_total_violation;
+    }
+
+   private:
+    /*************************************************************************/
+    inline double compute_averaged_violation(const int a_INDEX) const
+        noexcept {
+        const auto &constraint_ptr = m_constraint_ptrs[a_INDEX];
+        if (!constraint_ptr->is_enabled()) {
+            return 0.0;
+        }
+        return constraint_ptr->compute_violation(
+            static_cast<T_Expression>(m_averaged_constraint_values[a_INDEX]));
+    }
+
+    /*************************************************************************/
+    template <class T_Function>
+    inline double compute_blocked_sum(const int         a_SIZE,
+                                      const T_Function &a_FUNCTION,
+                                      const bool        a_IS_ENABLED_PARALLEL) {
+        /**
+         * This method returns the sum of a_FUNCTION(i) for i = 0, ...,
+         * a_SIZE - 1. The indices are partitioned into blocks of the fixed
+         * size, and the partial sums of the blocks are computed in parallel
+         * and then added in the order of the blocks. The OpenMP reduction
+         * clause is not used because its order of summation depends on the
+         * number of threads.
+         */
+        const int NUMBER_OF_BLOCKS = (a_SIZE + m_block_size - 1) / m_block_size;
+        m_block_partial_sums.resize(NUMBER_OF_BLOCKS);
+
+#ifdef _OPENMP
+#pragma omp parallel for if (a_IS_ENABLED_PARALLEL) schedule(static)
+#endif
+        for (auto i = 0; i < NUMBER_OF_BLOCKS; i++) {
+            const int BEGIN = i * m_block_size;
+            const int END   = std::min(BEGIN + m_block_size, a_SIZE);
+
+            double partial_sum = 0.0;
+            for (auto j = BEGIN; j < END; j++) {
+                partial_sum += a_FUNCTION(j);
+            }
+            m_block_partial_sums[i] = partial_sum;
+        }
+#ifndef _OPENMP
+        static_cast<void>(a_IS_ENABLED_PARALLEL);
+#endif
+
+        double sum = 0.0;
+        for (const auto &partial_sum : m_block_partial_sums) {
+            sum += partial_sum;
+        }
+        return sum;
+    }
+
+    /*************************************************************************/
+    template <class T_Direction>
+    inline void update_dual_values(const std::vector<double> &     a_BASE,
+                                   const std::vector<T_Direction> &a_DIRECTION,
+                                   const double a_STEP_SIZE,
+                                   const bool   a_IS_ENABLED_PARALLEL) {
+        /**
+         * This method sets the dual values to a_BASE + a_STEP_SIZE *
+         * a_DIRECTION projected onto the feasible region of the dual problem.
+         * The inner product of the dual values and the constraint values is
+         * recomputed in the same loop. a_BASE may be the dual values
+         * themselves.
+         */
+        m_dual_product = this->compute_blocked_sum(
+            m_constraint_ptrs.size(),
+            [this, &a_BASE, &a_DIRECTION, a_STEP_SIZE](const int a_INDEX) {
+                double dual_value =
+                    a_BASE[a_INDEX] + a_STEP_SIZE * a_DIRECTION[a_INDEX];
+                switch (m_constraint_ptrs[a_INDEX]->sense()) {
+                    case model::ConstraintSense::Lower: {
+                        dual_value = std::max(dual_value, 0.0);
+                        break;
+                    }
+                    case model::ConstraintSense::Upper: {
+                        dual_value = std::min(dual_value, 0.0);
+                        break;
+                    }
+                    default: {
+                        /// nothing to do
+                    }
+                }
+                m_dual_values[a_INDEX] = dual_value;
+                return dual_value * m_constraint_values[a_INDEX];
+            },
+            a_IS_ENABLED_PARALLEL);
+    }
+};
+}  // namespace lagrange_dual
+}  // namespace solver
+}  // namespace printemps
+
+#endif
+/*****************************************************************************/
+// END
+/*****************************************************************************/
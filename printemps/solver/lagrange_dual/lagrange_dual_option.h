@@ -9,16 +9,23 @@
 namespace printemps {
 namespace solver {
 namespace lagrange_dual {
+/*****************************************************************************/
+enum LagrangeDualMethod : int {
+    Subgradient,
+    Volume,
+};
+
 /*****************************************************************************/
 struct LagrangeDualOptionConstant {
-    static constexpr int    DEFAULT_ITERATION_MAX         = 10000;
-    static constexpr double DEFAULT_TIME_MAX              = 120.0;
-    static constexpr double DEFAULT_TIME_OFFSET           = 0.0;
-    static constexpr double DEFAULT_STEP_SIZE_EXTEND_RATE = 1.05;
-    static constexpr double DEFAULT_STEP_SIZE_REDUCE_RATE = 0.95;
-    static constexpr double DEFAULT_TOLERANCE             = 1E-5;
-    static constexpr int    DEFAULT_QUEUE_SIZE            = 100;
-    static constexpr int    DEFAULT_LOG_INTERVAL          = 10;
+    static constexpr int    DEFAULT_ITERATION_MAX             = 10000;
+    static constexpr double DEFAULT_TIME_MAX                  = 120.0;
+    static constexpr double DEFAULT_TIME_OFFSET               = 0.0;
+    static constexpr double DEFAULT_STEP_SIZE_EXTEND_RATE     = 1.05;
+    static constexpr double DEFAULT_STEP_SIZE_REDUCE_RATE     = 0.95;
+    static constexpr double DEFAULT_TOLERANCE                 = 1E-5;
+    static constexpr int    DEFAULT_QUEUE_SIZE                = 100;
+    static constexpr int    DEFAULT_LOG_INTERVAL              = 10;
+    static constexpr double DEFAULT_VOLUME_AVERAGING_RATE_MAX = 0.1;
 };
 
 /*****************************************************************************/
@@ -32,6 +39,9 @@ struct LagrangeDualOption {
     double queue_size;  // hidden
     int    log_interval;
 
+    LagrangeDualMethod method;
+    double             volume_averaging_rate_max;
+
     /*************************************************************************/
     LagrangeDualOption(void) {
         this->initialize();
@@ -54,6 +64,9 @@ struct LagrangeDualOption {
         this->tolerance    = LagrangeDualOptionConstant::DEFAULT_TOLERANCE;
         this->queue_size   = LagrangeDualOptionConstant::DEFAULT_QUEUE_SIZE;
         this->log_interval = LagrangeDualOptionConstant::DEFAULT_LOG_INTERVAL;
+        this->method       = LagrangeDualMethod::Subgradient;
+        this->volume_averaging_rate_max =
+            LagrangeDualOptionConstant::DEFAULT_VOLUME_AVERAGING_RATE_MAX;
     }
 };
 }  // namespace lagrange_dual
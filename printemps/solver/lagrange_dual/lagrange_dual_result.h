@@ -24,17 +24,20 @@ enum class LagrangeDualTerminationStatus {
 /*****************************************************************************/
 template <class T_Variable, class T_Expression>
 struct LagrangeDualResult {
-    double                                    lagrangian;
-    model::Solution<T_Variable, T_Expression> primal_solution;
-    std::vector<model::ValueProxy<double>>    dual_value_proxies;
-    IncumbentHolder<T_Variable, T_Expression> incumbent_holder;
-    int                                       total_update_status;
-    int                                       number_of_iterations;
-    LagrangeDualTerminationStatus             termination_status;
+    double                                           lagrangian;
+    model::CompactSolution<T_Variable, T_Expression> primal_solution;
+    std::vector<model::ValueProxy<double>>           dual_value_proxies;
+    std::vector<double>                              primal_estimate;
+    IncumbentHolder<T_Variable, T_Expression>        incumbent_holder;
+    int                                              total_update_status;
+    int                                              number_of_iterations;
+    LagrangeDualTerminationStatus                    termination_status;
 
     std::vector<model::PlainSolution<T_Variable, T_Expression>>
         historical_feasible_solutions;
 
+    Profiler profiler;
+
     /*************************************************************************/
     LagrangeDualResult(void) {
         this->initialize();
@@ -50,12 +53,14 @@ struct LagrangeDualResult {
         this->lagrangian = -HUGE_VALF;
         this->primal_solution.initialize();
         this->dual_value_proxies.clear();
+        this->primal_estimate.clear();
         this->incumbent_holder.initialize();
         this->total_update_status  = 0;
         this->number_of_iterations = 0;
         this->termination_status =
             LagrangeDualTerminationStatus::ITERATION_OVER;
         this->historical_feasible_solutions.clear();
+        this->profiler.initialize();
     }
 };
 }  // namespace lagrange_dual
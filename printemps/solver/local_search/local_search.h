@@ -6,6 +6,8 @@
 #ifndef PRINTEMPS_SOLVER_LOCAL_SEARCH_LOCAL_SEARCH_H__
 #define PRINTEMPS_SOLVER_LOCAL_SEARCH_LOCAL_SEARCH_H__
 
+#include "../profiler.h"
+#include "../trace_writer.h"
 #include "local_search_option.h"
 #include "local_search_print.h"
 #include "local_search_result.h"
@@ -25,11 +27,11 @@ template <class T_Variable, class T_Expression>
 LocalSearchResult<T_Variable, T_Expression> solve(
     model::Model<T_Variable, T_Expression>* a_model,   //
     const Option&                           a_OPTION,  //
-    const std::vector<model::ValueProxy<T_Variable>>&  //
-        a_INITIAL_VARIABLE_VALUE_PROXIES,              //
+    const std::vector<T_Variable>&                     //
+        a_INITIAL_VARIABLE_VALUES,                     //
     const IncumbentHolder<T_Variable, T_Expression>&   //
-                  a_INCUMBENT_HOLDER,                  //
-    const Memory& a_MEMORY) {
+            a_INCUMBENT_HOLDER,                        //
+    Memory* a_memory) {
     /**
      * Define type aliases.
      */
@@ -48,7 +50,11 @@ LocalSearchResult<T_Variable, T_Expression> solve(
      */
     Model_T* model  = a_model;
     Option   option = a_OPTION;
-    Memory   memory = a_MEMORY;
+
+    /**
+     * The memory is shared with the caller and updated in place.
+     */
+    Memory& memory = *a_memory;
 
     IncumbentHolder_T incumbent_holder = a_INCUMBENT_HOLDER;
 
@@ -65,7 +71,7 @@ LocalSearchResult<T_Variable, T_Expression> solve(
     /**
      * Initialize the solution and update the model.
      */
-    model->import_variable_values(a_INITIAL_VARIABLE_VALUE_PROXIES);
+    model->import_variable_values(a_INITIAL_VARIABLE_VALUES);
     model->update();
 
     model::SolutionScore solution_score = model->evaluate({});
@@ -101,6 +107,16 @@ LocalSearchResult<T_Variable, T_Expression> solve(
     model::Move<T_Variable, T_Expression> previous_move;
     model::Move<T_Variable, T_Expression> current_move;
 
+    /**
+     * Prepare the profiler of the phases and the trace writer (optional).
+     */
+    Profiler profiler;
+    profiler.setup(option.is_enabled_profile ||
+                   option.trace_mode != TraceMode::None);
+
+    TraceWriter trace_writer;
+    trace_writer.open(option.trace_file_name, option.trace_mode);
+
     /**
      * Print the header of optimization progress table and print the initial
      * solution status.
@@ -142,9 +158,12 @@ LocalSearchResult<T_Variable, T_Expression> solve(
             break;
         }
 
+        profiler.start_iteration();
+
         /**
          * Update the moves.
          */
+        profiler.start();
         bool accept_all                    = true;
         bool accept_objective_improvable   = true;
         bool accept_feasibility_improvable = true;
@@ -175,13 +194,19 @@ LocalSearchResult<T_Variable, T_Expression> solve(
                 accept_feasibility_improvable = true;
             }
         }
+        profiler.stop(ProfilePhase::ImprovabilityUpdate);
+
+        profiler.start();
         model->neighborhood().update_moves(
             accept_all,                     //
             accept_objective_improvable,    //
             accept_feasibility_improvable,  //
             option.is_enabled_parallel_neighborhood_update);
+        profiler.stop(ProfilePhase::MoveUpdate);
 
+        profiler.start();
         model->neighborhood().shuffle_moves(&get_rand_mt);
+        profiler.stop(ProfilePhase::Shuffle);
 
         bool is_found_improving_solution = false;
 
@@ -199,6 +224,7 @@ LocalSearchResult<T_Variable, T_Expression> solve(
             break;
         }
 
+        profiler.start();
         for (const auto& move_ptr : move_ptrs) {
             model::SolutionScore trial_solution_score;
             /**
@@ -231,6 +257,7 @@ LocalSearchResult<T_Variable, T_Expression> solve(
 
             number_of_checked_move++;
         }
+        profiler.stop(ProfilePhase::Evaluation);
 
         /**
          * The local search will be terminated if there is no improving solution
@@ -246,7 +273,11 @@ LocalSearchResult<T_Variable, T_Expression> solve(
          */
         Move_T* move_ptr = move_ptrs[number_of_checked_move];
 
+        profiler.start();
         model->update(*move_ptr);
+        profiler.stop(ProfilePhase::ModelUpdate);
+
+        profiler.start();
         update_status =
             incumbent_holder.try_update_incumbent(model, solution_score);
         total_update_status = update_status || total_update_status;
@@ -258,11 +289,14 @@ LocalSearchResult<T_Variable, T_Expression> solve(
             historical_feasible_solutions.push_back(
                 model->export_plain_solution());
         }
+        profiler.stop(ProfilePhase::IncumbentUpdate);
 
         /**
          * Update the memory.
          */
+        profiler.start();
         memory.update(*move_ptr, iteration);
+        profiler.stop(ProfilePhase::MemoryUpdate);
 
         /**
          * Print the optimization progress.
@@ -278,6 +312,19 @@ LocalSearchResult<T_Variable, T_Expression> solve(
                              incumbent_holder,        //
                              option.verbose >= Verbose::Full);
         }
+
+        /**
+         * Write the trace of the iteration (optional).
+         */
+        if (trace_writer.is_enabled()) {
+            trace_writer.write(
+                "local_search",                                  //
+                iteration,                                       //
+                elapsed_time + option.local_search.time_offset,  //
+                solution_score,                                  //
+                number_of_moves,                                 //
+                profiler);
+        }
         iteration++;
     }
 
@@ -286,16 +333,22 @@ LocalSearchResult<T_Variable, T_Expression> solve(
      */
     print_table_footer(option.verbose >= Verbose::Full);
 
+    /**
+     * Fill the violations of the incumbent solutions, which are stored
+     * without them in the iterations.
+     */
+    incumbent_holder.fill_violations(model);
+
     /**
      * Prepare the result.
      */
     Result_T result;
     result.incumbent_holder              = incumbent_holder;
-    result.memory                        = memory;
     result.total_update_status           = total_update_status;
     result.number_of_iterations          = iteration;
     result.termination_status            = termination_status;
     result.historical_feasible_solutions = historical_feasible_solutions;
+    result.profiler                      = profiler;
 
     return result;
 }
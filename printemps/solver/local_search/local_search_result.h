@@ -26,7 +26,6 @@ enum class LocalSearchTerminationStatus {
 template <class T_Variable, class T_Expression>
 struct LocalSearchResult {
     IncumbentHolder<T_Variable, T_Expression> incumbent_holder;
-    Memory                                    memory;
 
     int total_update_status;
     int number_of_iterations;
@@ -36,6 +35,8 @@ struct LocalSearchResult {
     std::vector<model::PlainSolution<T_Variable, T_Expression>>
         historical_feasible_solutions;
 
+    Profiler profiler;
+
     /*************************************************************************/
     LocalSearchResult(void) {
         this->initialize();
@@ -49,11 +50,11 @@ struct LocalSearchResult {
     /*************************************************************************/
     void initialize(void) {
         this->incumbent_holder.initialize();
-        this->memory.initialize();
         this->total_update_status  = 0;
         this->number_of_iterations = 0;
         this->termination_status = LocalSearchTerminationStatus::ITERATION_OVER;
         this->historical_feasible_solutions.clear();
+        this->profiler.initialize();
     }
 };
 }  // namespace local_search
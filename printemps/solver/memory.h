@@ -7,6 +7,7 @@
 #define PRINTEMPS_SOLVER_MEMORY_H__
 
 #include <vector>
+#include <algorithm>
 
 namespace printemps {
 namespace solver {
@@ -17,11 +18,30 @@ struct MemoryConstant {
 
 /*****************************************************************************/
 class Memory {
+    /**
+     * Memory stores the short-term and the long-term memories of the search
+     * in flat vectors indexed by the global indices of the variables, so that
+     * a lookup for a variable is a single load. The memory is shared by
+     * reference among the local search and the tabu search loops.
+     */
    private:
-    std::vector<std::string>            m_variable_names;
-    std::vector<model::ValueProxy<int>> m_last_update_iterations;
-    std::vector<model::ValueProxy<int>> m_update_counts;
-    long                                m_total_update_counts;
+    std::vector<int> m_last_update_iterations;
+    std::vector<int> m_update_counts;
+    long             m_total_update_counts;
+    long             m_total_squared_update_counts;
+
+    /*************************************************************************/
+    inline void increment_update_count(const int a_GLOBAL_INDEX) noexcept {
+        /**
+         * (c + 1)^2 - c^2 = 2c + 1 is added to the sum of the squared update
+         * counts.
+         */
+        auto &update_count = m_update_counts[a_GLOBAL_INDEX];
+        m_total_squared_update_counts +=
+            2 * static_cast<long>(update_count) + 1;
+        update_count++;
+        m_total_update_counts++;
+    }
 
    public:
     /*************************************************************************/
@@ -42,110 +62,95 @@ class Memory {
 
     /*************************************************************************/
     void initialize(void) {
-        m_variable_names.clear();
         m_last_update_iterations.clear();
         m_update_counts.clear();
-        m_total_update_counts = 0;
+        m_total_update_counts         = 0;
+        m_total_squared_update_counts = 0;
     }
 
     /*************************************************************************/
     template <class T_Variable, class T_Expression>
-    inline constexpr void setup(
-        model::Model<T_Variable, T_Expression> *a_model) {
+    inline void setup(model::Model<T_Variable, T_Expression> *a_model) {
         this->initialize();
+        const int VARIABLES_SIZE =
+            a_model->variable_reference().variable_ptrs.size();
         /**
          * Short-term memory:
          * The short-term memory records the iteration count at which each
          * variable has been updated last. The initial value of the short-term
          * memory must be sufficiently large and finite negative value. The
          * finiteness is required so that an operation a_ITERATION -
-         * last_update_iterations[proxy_index][index] in
-         * tabu_search_move_score.h can return finite integer value.
+         * last_update_iterations[global_index] in tabu_search_move_score.h
+         * can return finite integer value.
          */
-        m_last_update_iterations = a_model->generate_variable_parameter_proxies(
-            MemoryConstant::INITIAL_LAST_UPDATE_ITERATION);
+        m_last_update_iterations.assign(
+            VARIABLES_SIZE,
+            static_cast<int>(MemoryConstant::INITIAL_LAST_UPDATE_ITERATION));
 
         /* Long-term memory:
          * The Long-term memory records the number of times which each variable
          * has been updated. The initial value of the long-term memory is 0.
          */
-        m_update_counts = a_model->generate_variable_parameter_proxies(0);
-
-        m_variable_names = a_model->variable_names();
+        m_update_counts.assign(VARIABLES_SIZE, 0);
     }
 
     /*************************************************************************/
-    void print_last_update_iterations(void) {
+    template <class T_Variable, class T_Expression>
+    void print_last_update_iterations(
+        const model::Model<T_Variable, T_Expression> *a_MODEL) const {
         /// This method is for debug.
-        const int VARIABLE_PROXIES_SIZE = m_variable_names.size();
-        for (auto i = 0; i < VARIABLE_PROXIES_SIZE; i++) {
-            auto &last_update_iteration = m_last_update_iterations[i];
-            const std::string NAME      = m_variable_names[i];
-            const int         NUMBER_OF_ELEMENTS =
-                last_update_iteration.number_of_elements();
-            for (auto j = 0; j < NUMBER_OF_ELEMENTS; j++) {
-                utility::print(
-                    NAME + last_update_iteration.indices_label(j) + " = " +
-                    std::to_string(
-                        last_update_iteration.flat_indexed_values(j)));
-            }
+        for (const auto &variable_ptr :
+             a_MODEL->variable_reference().variable_ptrs) {
+            utility::print(variable_ptr->name() + " = " +
+                           std::to_string(m_last_update_iterations
+                                              [variable_ptr->global_index()]));
         }
     }
 
     /*************************************************************************/
-    void print_update_counts(void) {
+    template <class T_Variable, class T_Expression>
+    void print_update_counts(
+        const model::Model<T_Variable, T_Expression> *a_MODEL) const {
         /// This method is for debug.
-        const int VARIABLE_PROXIES_SIZE = m_variable_names.size();
-        for (auto i = 0; i < VARIABLE_PROXIES_SIZE; i++) {
-            auto &            update_count = m_update_counts[i];
-            const std::string NAME         = m_variable_names[i];
-            const int NUMBER_OF_ELEMENTS   = update_count.number_of_elements();
-            for (auto j = 0; j < NUMBER_OF_ELEMENTS; j++) {
-                utility::print(
-                    NAME + update_count.indices_label(j) + " = " +
-                    std::to_string(update_count.flat_indexed_values(j)));
-            }
+        for (const auto &variable_ptr :
+             a_MODEL->variable_reference().variable_ptrs) {
+            utility::print(
+                variable_ptr->name() + " = " +
+                std::to_string(m_update_counts[variable_ptr->global_index()]));
         }
     }
 
     /*************************************************************************/
-    void print_frequency(void) {
+    template <class T_Variable, class T_Expression>
+    void print_frequency(
+        const model::Model<T_Variable, T_Expression> *a_MODEL) const {
         /// This method is for debug.
-        const int VARIABLE_PROXIES_SIZE = m_variable_names.size();
-        for (auto i = 0; i < VARIABLE_PROXIES_SIZE; i++) {
-            auto &            update_count = m_update_counts[i];
-            const std::string NAME         = m_variable_names[i];
-            const int NUMBER_OF_ELEMENTS   = update_count.number_of_elements();
-            for (auto j = 0; j < NUMBER_OF_ELEMENTS; j++) {
-                utility::print(
-                    NAME + update_count.indices_label(j) + " = " +
-                    std::to_string(update_count.flat_indexed_values(j) /
-                                   static_cast<double>(m_total_update_counts)));
-            }
+        for (const auto &variable_ptr :
+             a_MODEL->variable_reference().variable_ptrs) {
+            utility::print(
+                variable_ptr->name() + " = " +
+                std::to_string(m_update_counts[variable_ptr->global_index()] /
+                               static_cast<double>(m_total_update_counts)));
         }
     }
 
     /*************************************************************************/
-    void print_bias(void) {
+    void print_bias(void) const {
         /// This method is for debug.
         utility::print(std::to_string(this->bias()));
     }
 
     /*************************************************************************/
-    double bias(void) const noexcept {
-        /// This method cannot be constexpr for m_variable_names.size().
-        double    result                = 0.0;
-        const int VARIABLE_PROXIES_SIZE = m_variable_names.size();
-        for (auto i = 0; i < VARIABLE_PROXIES_SIZE; i++) {
-            auto &    update_count       = m_update_counts[i];
-            const int NUMBER_OF_ELEMENTS = update_count.number_of_elements();
-            for (auto j = 0; j < NUMBER_OF_ELEMENTS; j++) {
-                double frequency = update_count.flat_indexed_values(j) /
-                                   static_cast<double>(m_total_update_counts);
-                result += frequency * frequency;
-            }
-        }
-        return result;
+    inline constexpr double bias(void) const noexcept {
+        /**
+         * The bias is the sum of the squared update frequencies of the
+         * variables, which is computed from the sum of the squared update
+         * counts maintained in update().
+         */
+        const double TOTAL_UPDATE_COUNTS =
+            static_cast<double>(m_total_update_counts);
+        return m_total_squared_update_counts /
+               (TOTAL_UPDATE_COUNTS * TOTAL_UPDATE_COUNTS);
     }
 
     /*************************************************************************/
@@ -153,12 +158,10 @@ class Memory {
     constexpr void update(const model::Move<T_Variable, T_Expression> &a_MOVE,
                           const int a_ITERATION) noexcept {
         for (const auto &alteration : a_MOVE.alterations) {
-            int proxy_index = alteration.first->proxy_index();
-            int flat_index  = alteration.first->flat_index();
+            const int GLOBAL_INDEX = alteration.first->global_index();
 
-            m_last_update_iterations[proxy_index][flat_index] = a_ITERATION;
-            m_update_counts[proxy_index][flat_index]++;
-            m_total_update_counts++;
+            m_last_update_iterations[GLOBAL_INDEX] = a_ITERATION;
+            this->increment_update_count(GLOBAL_INDEX);
         }
     }
 
@@ -172,38 +175,72 @@ class Memory {
             this->update(a_MOVE, a_ITERATION);
         } else {
             for (const auto &alteration : a_MOVE.alterations) {
-                int proxy_index = alteration.first->proxy_index();
-                int flat_index  = alteration.first->flat_index();
-                int randomness =
+                const int GLOBAL_INDEX = alteration.first->global_index();
+                int       randomness =
                     (*get_rand_mt)() % (2 * a_RANDOM_WIDTH) - a_RANDOM_WIDTH;
 
-                m_last_update_iterations[proxy_index][flat_index] =
+                m_last_update_iterations[GLOBAL_INDEX] =
                     a_ITERATION + randomness;
-                m_update_counts[proxy_index][flat_index]++;
-                m_total_update_counts++;
+                this->increment_update_count(GLOBAL_INDEX);
             }
         }
     }
 
     /*************************************************************************/
     inline void reset_last_update_iterations(void) {
-        /// This method cannot be constexpr.
-        for (auto &&proxy : m_last_update_iterations) {
+        std::fill(m_last_update_iterations.begin(),
+                  m_last_update_iterations.end(),
+                  static_cast<int>(
+                      MemoryConstant::INITIAL_LAST_UPDATE_ITERATION));
+    }
+
+    /*************************************************************************/
+    inline void import_values(
+        const std::vector<int> &a_LAST_UPDATE_ITERATIONS,  //
+        const std::vector<int> &a_UPDATE_COUNTS,           //
+        const long              a_TOTAL_UPDATE_COUNTS) {
+        /**
+         * This method restores the memory from the values exported by
+         * last_update_iterations() and update_counts() for the same model.
+         */
+        m_last_update_iterations = a_LAST_UPDATE_ITERATIONS;
+        m_update_counts          = a_UPDATE_COUNTS;
+        m_total_update_counts    = a_TOTAL_UPDATE_COUNTS;
+
+        m_total_squared_update_counts = 0;
+        for (const auto &update_count : m_update_counts) {
+            m_total_squared_update_counts +=
+                static_cast<long>(update_count) * update_count;
+        }
+    }
+
+    /*************************************************************************/
+    template <class T_Variable, class T_Expression>
+    inline std::vector<model::ValueProxy<int>> export_update_count_proxies(
+        const model::Model<T_Variable, T_Expression> *a_MODEL) const {
+        /**
+         * This method returns the update counts arranged in the shapes of the
+         * variable proxies of the model.
+         */
+        auto update_count_proxies =
+            a_MODEL->generate_variable_parameter_proxies(0);
+        int global_index = 0;
+        for (auto &&proxy : update_count_proxies) {
             for (auto &&value : proxy.flat_indexed_values()) {
-                value = MemoryConstant::INITIAL_LAST_UPDATE_ITERATION;
+                value = m_update_counts[global_index++];
             }
         }
+        return update_count_proxies;
     }
 
     /*************************************************************************/
-    inline constexpr const std::vector<model::ValueProxy<int>>
-        &last_update_iterations(void) const {
+    inline constexpr const std::vector<int> &last_update_iterations(
+        void) const {
         return m_last_update_iterations;
     }
 
     /*************************************************************************/
-    inline constexpr const std::vector<model::ValueProxy<int>> &update_counts(
-        void) const {
+    inline constexpr const std::vector<int> &update_counts(void) const {
         return m_update_counts;
     }
 
@@ -211,11 +248,16 @@ class Memory {
     inline constexpr const long &total_update_counts(void) const {
         return m_total_update_counts;
     }
-};  // namespace solver
+
+    /*************************************************************************/
+    inline constexpr const long &total_squared_update_counts(void) const {
+        return m_total_squared_update_counts;
+    }
+};
 }  // namespace solver
 }  // namespace printemps
 
 #endif
 /*****************************************************************************/
 // END
-/*****************************************************************************/
\ No newline at end of file
+/*****************************************************************************/
@@ -0,0 +1,376 @@
+/*****************************************************************************/
+// Copyright (c) 2020 Yuji KOGUMA
+// Released under the MIT license
+// https://opensource.org/licenses/mit-license.php
+/*****************************************************************************/
+#ifndef PRINTEMPS_SOLVER_MULTI_START_MULTI_START_H__
+#define PRINTEMPS_SOLVER_MULTI_START_MULTI_START_H__
+
+#include <functional>
+#include <memory>
+#include "../solver.h"
+
+namespace printemps {
+namespace solver {
+namespace multi_start {
+/*****************************************************************************/
+template <class T_Variable, class T_Expression>
+inline bool is_better(
+    const model::PlainSolution<T_Variable, T_Expression>& a_LHS,
+    const model::PlainSolution<T_Variable, T_Expression>& a_RHS,
+    const double                                          a_SIGN) {
+    /**
+     * A feasible solution is better than an infeasible one. The feasible
+     * solutions are compared by the objective values, and the infeasible ones
+     * are compared by the total violations.
+     */
+    if (a_LHS.is_feasible != a_RHS.is_feasible) {
+        return a_LHS.is_feasible;
+    }
+    if (a_LHS.is_feasible) {
+        return a_LHS.objective * a_SIGN < a_RHS.objective * a_SIGN;
+    }
+    return a_LHS.total_violation < a_RHS.total_violation;
+}
+
+/*****************************************************************************/
+template <class T_Variable, class T_Expression>
+Result<T_Variable, T_Expression> solve(
+    const std::function<void(model::Model<T_Variable, T_Expression>*)>&
+                  a_MODEL_BUILDER,  //
+    const Option& a_OPTION) {
+    /**
+     * This function runs the specified number of independent chains of the
+     * solver concurrently in island-model manner. The search is divided into
+     * rounds; each chain builds its own model by the given builder once, and
+     * runs solver::solve() with an individual seed. The state of the search
+     * at the end of each round, e.g., the memory, the penalty coefficients,
+     * and the chain moves, is kept as an in-memory checkpoint, and the chain
+     * resumes from it in the next round. At the end of each round, the chain
+     * solutions are pushed to the shared solution archive, and the chains
+     * with the worst solutions receive the elite ones as migrants. Only these
+     * chains are reset; they rebuild their models and start new searches
+     * from the migrants.
+     *
+     * Since the model objects cannot be copied, the builder must construct
+     * an identical model for each call, and it must be thread-safe if the
+     * parallel chains are enabled.
+     *
+     * The chains do not write checkpoints, since they would overwrite the
+     * same file concurrently and the search could not be resumed from it.
+     */
+
+    /**
+     * Define type aliases.
+     */
+    using Model_T         = model::Model<T_Variable, T_Expression>;
+    using Result_T        = Result<T_Variable, T_Expression>;
+    using PlainSolution_T = model::PlainSolution<T_Variable, T_Expression>;
+    using Checkpoint_T    = Checkpoint<T_Variable, T_Expression>;
+
+    /**
+     * Start to measure computational time and get the starting time.
+     */
+    utility::TimeKeeper time_keeper;
+    std::string         start_date_time = utility::date_time();
+
+    /**
+     * Copy arguments as local variables.
+     */
+    Option master_option = a_OPTION;
+
+    const int NUMBER_OF_CHAINS =
+        std::max(1, master_option.multi_start.number_of_chains);
+    const int NUMBER_OF_ROUNDS =
+        std::max(1, master_option.multi_start.number_of_rounds);
+    const int NUMBER_OF_MIGRANTS = std::min(
+        NUMBER_OF_CHAINS - 1,
+        static_cast<int>(
+            std::floor(master_option.multi_start.migration_rate *
+                       NUMBER_OF_CHAINS)));
+
+    const double ROUND_TIME_MAX = master_option.time_max / NUMBER_OF_ROUNDS;
+    const int    ROUND_ITERATION_MAX =
+        std::max(1, master_option.iteration_max / NUMBER_OF_ROUNDS);
+
+    /**
+     * Prepare the states of the chains.
+     */
+    std::vector<std::unique_ptr<Model_T>> chain_models(NUMBER_OF_CHAINS);
+    std::vector<Checkpoint_T>             chain_checkpoints(NUMBER_OF_CHAINS);
+    std::vector<Result_T>                 chain_results(NUMBER_OF_CHAINS);
+    std::vector<PlainSolution_T>          chain_solutions(NUMBER_OF_CHAINS);
+    std::vector<double>                   chain_signs(NUMBER_OF_CHAINS, 1.0);
+    std::vector<int>                      chain_indices(NUMBER_OF_CHAINS);
+    for (auto i = 0; i < NUMBER_OF_CHAINS; i++) {
+        chain_indices[i] = i;
+    }
+
+    /**
+     * The chains to be reset start new searches in the next round. All of
+     * the chains start new searches in the first round.
+     */
+    std::vector<int> chain_reset_flags(NUMBER_OF_CHAINS, 1);
+
+    SolutionArchive<T_Variable, T_Expression> solution_archive;
+
+    Result_T        best_result;
+    PlainSolution_T best_solution;
+    bool            has_best_solution = false;
+
+    int number_of_lagrange_dual_iterations = 0;
+    int number_of_local_search_iterations  = 0;
+    int number_of_tabu_search_iterations   = 0;
+    int number_of_tabu_search_loops        = 0;
+
+    bool   is_found_lagrangian_bound = false;
+    double lagrangian_bound          = 0.0;
+
+    Profiler profiler;
+
+    /**
+     * If the checkpoint is enabled, SIGTERM is caught once here instead of
+     * in each chain, because the handler is shared by the whole process. The
+     * chains and the rounds stop at the signal, and the best solution found
+     * so far is returned.
+     */
+    utility::TerminationSignalHandler termination_signal_handler;
+    if (master_option.is_enabled_checkpoint) {
+        utility::print_warning(
+            "The checkpoint is not written in the multi-start search.",
+            master_option.verbose >= Verbose::Warning);
+        termination_signal_handler.install();
+    }
+
+    utility::print_single_line(master_option.verbose >= Verbose::Outer);
+    utility::print_message(
+        "Multi-start search starts with " + std::to_string(NUMBER_OF_CHAINS) +
+            " chains.",
+        master_option.verbose >= Verbose::Outer);
+
+    for (auto round = 0; round < NUMBER_OF_ROUNDS; round++) {
+        /**
+         *  Check the terminating condition.
+         */
+        double elapsed_time = time_keeper.clock();
+        if (elapsed_time > master_option.time_max) {
+            utility::print_message(
+                "Multi-start search was terminated because of time-over (" +
+                    utility::to_string(elapsed_time, "%.3f") + "sec).",
+                master_option.verbose >= Verbose::Outer);
+            break;
+        }
+        if (utility::TerminationSignalHandler::is_received()) {
+            utility::print_message(
+                "Multi-start search was terminated because of the "
+                "termination signal.",
+                master_option.verbose >= Verbose::Outer);
+            break;
+        }
+
+        /**
+         *  Prepare an option object for the chains in this round.
+         */
+        Option round_option = master_option;
+        round_option.time_max =
+            std::min(ROUND_TIME_MAX, master_option.time_max - elapsed_time);
+        round_option.iteration_max         = ROUND_ITERATION_MAX;
+        round_option.verbose               = Verbose::None;
+        round_option.is_enabled_checkpoint = false;
+
+        /**
+         * The chains after the first round continue the searches of the
+         * previous round or start from the migrants, so the whole budget of
+         * the round is given to the tabu search.
+         */
+        if (round > 0) {
+            round_option.is_enabled_lagrange_dual = false;
+            round_option.is_enabled_local_search  = false;
+        }
+
+        /**
+         * Run the chains. The parallel evaluation of moves in each chain is
+         * performed serially unless nested parallelism is enabled.
+         */
+#ifdef _OPENMP
+        const bool IS_ENABLED_PARALLEL_CHAINS =
+            master_option.multi_start.is_enabled_parallel_chains;
+#pragma omp parallel for if (IS_ENABLED_PARALLEL_CHAINS) schedule(dynamic)
+#endif
+        for (auto i = 0; i < NUMBER_OF_CHAINS; i++) {
+            Option option = round_option;
+            option.seed += round * NUMBER_OF_CHAINS + i;
+            option.tabu_search.seed += round * NUMBER_OF_CHAINS + i;
+            option.local_search.seed += round * NUMBER_OF_CHAINS + i;
+
+            /**
+             * Each chain writes its own trace file to avoid interleaving.
+             */
+            option.trace_file_name += "_" + std::to_string(round) + "_" +
+                                      std::to_string(i);
+
+            auto& checkpoint = chain_checkpoints[i];
+            if (chain_reset_flags[i]) {
+                /**
+                 * A new search is started from the migrant, or from the
+                 * initial solution in the first round.
+                 */
+                chain_models[i].reset(new Model_T());
+                a_MODEL_BUILDER(chain_models[i].get());
+
+                if (round > 0) {
+                    chain_models[i]->categorize_variables();
+                    chain_models[i]->import_variable_values(
+                        chain_solutions[i].variables);
+                }
+
+                chain_results[i] = solver::solve(
+                    chain_models[i].get(), option,
+                    static_cast<const Checkpoint_T*>(nullptr), &checkpoint);
+            } else {
+                /**
+                 * The search of the previous round is resumed. The elapsed
+                 * time and the counters are cleared so that the budget and
+                 * the statistics of the resumed search cover only this round.
+                 */
+                option.iteration_max += checkpoint.iteration;
+
+                checkpoint.elapsed_time                       = 0.0;
+                checkpoint.number_of_lagrange_dual_iterations = 0;
+                checkpoint.number_of_local_search_iterations  = 0;
+                checkpoint.number_of_tabu_search_iterations   = 0;
+                checkpoint.number_of_tabu_search_loops        = 0;
+
+                chain_results[i] = solver::solve(
+                    chain_models[i].get(), option, &checkpoint, &checkpoint);
+            }
+
+            chain_solutions[i] = chain_models[i]->export_plain_solution();
+            chain_signs[i]     = chain_models[i]->sign();
+        }
+
+        /**
+         * Update the shared solution archive and the best solution.
+         */
+        const double SIGN = chain_signs.front();
+        if (round == 0) {
+            solution_archive.setup(master_option.historical_data_capacity,
+                                   SIGN > 0);
+        }
+
+        for (auto i = 0; i < NUMBER_OF_CHAINS; i++) {
+            const auto& status = chain_results[i].status;
+            number_of_lagrange_dual_iterations +=
+                status.number_of_lagrange_dual_iterations;
+            number_of_local_search_iterations +=
+                status.number_of_local_search_iterations;
+            number_of_tabu_search_iterations +=
+                status.number_of_tabu_search_iterations;
+            number_of_tabu_search_loops += status.number_of_tabu_search_loops;
+            profiler.merge(status.profiler);
+
+            /**
+             * The tightest Lagrangian bound among the chains is kept; it is
+             * the largest one for a minimization problem.
+             */
+            if (status.is_found_lagrangian_bound &&
+                (!is_found_lagrangian_bound ||
+                 status.lagrangian_bound * SIGN > lagrangian_bound * SIGN)) {
+                is_found_lagrangian_bound = true;
+                lagrangian_bound          = status.lagrangian_bound;
+            }
+
+            if (chain_solutions[i].is_feasible) {
+                solution_archive.push(chain_solutions[i]);
+            }
+            if (master_option.is_enabled_collect_historical_data) {
+                solution_archive.push(
+                    chain_results[i].solution_archive.solutions());
+            }
+
+            if (!has_best_solution ||
+                is_better(chain_solutions[i], best_solution, SIGN)) {
+                best_result       = chain_results[i];
+                best_solution     = chain_solutions[i];
+                has_best_solution = true;
+            }
+        }
+
+        /**
+         * Replace the solutions of the worst chains with the elite ones. The
+         * elite solutions are taken from the shared archive if it holds any
+         * feasible solution, and from the best solution otherwise.
+         */
+        std::stable_sort(
+            chain_indices.begin(), chain_indices.end(),
+            [&chain_solutions, SIGN](const int a_LHS, const int a_RHS) {
+                return is_better(chain_solutions[a_LHS],
+                                 chain_solutions[a_RHS], SIGN);
+            });
+
+        std::fill(chain_reset_flags.begin(), chain_reset_flags.end(), 0);
+
+        const auto& elite_solutions = solution_archive.solutions();
+        for (auto i = 0; i < NUMBER_OF_MIGRANTS; i++) {
+            const int CHAIN_INDEX = chain_indices[NUMBER_OF_CHAINS - 1 - i];
+            chain_reset_flags[CHAIN_INDEX] = 1;
+
+            auto& migrant_solution = chain_solutions[CHAIN_INDEX];
+            if (elite_solutions.empty()) {
+                migrant_solution = best_solution;
+            } else {
+                migrant_solution =
+                    elite_solutions[i % elite_solutions.size()];
+            }
+        }
+
+        utility::print_message(
+            "Round (" + std::to_string(round + 1) + "/" +
+                std::to_string(NUMBER_OF_ROUNDS) + ") finished.",
+            master_option.verbose >= Verbose::Outer);
+
+        utility::print_info(
+            " -- Best objective: " +
+                utility::to_string(best_solution.objective, "%.3f") +
+                (best_solution.is_feasible ? " (feasible)" : " (infeasible)"),
+            master_option.verbose >= Verbose::Outer);
+    }
+
+    /**
+     * Get the finish time, and the elapsed wall-clock and CPU times.
+     */
+    std::string finish_date_time = utility::date_time();
+    time_keeper.clock();
+    time_keeper.cpu_clock();
+
+    /**
+     * Prepare the result object to return. The solution and the penalty
+     * coefficients are those of the chain which found the best solution.
+     */
+    Result_T result                = best_result;
+    result.status.start_date_time  = start_date_time;
+    result.status.finish_date_time = finish_date_time;
+    result.status.elapsed_time     = time_keeper.elapsed_time();
+    result.status.elapsed_cpu_time = time_keeper.elapsed_cpu_time();
+    result.status.number_of_lagrange_dual_iterations =
+        number_of_lagrange_dual_iterations;
+    result.status.number_of_local_search_iterations =
+        number_of_local_search_iterations;
+    result.status.number_of_tabu_search_iterations =
+        number_of_tabu_search_iterations;
+    result.status.number_of_tabu_search_loops = number_of_tabu_search_loops;
+    result.status.is_found_lagrangian_bound   = is_found_lagrangian_bound;
+    result.status.lagrangian_bound            = lagrangian_bound;
+    result.status.profiler                    = profiler;
+    result.solution_archive                   = solution_archive;
+
+    return result;
+}
+}  // namespace multi_start
+}  // namespace solver
+}  // namespace printemps
+
+#endif
+/*****************************************************************************/
+// END
+/*****************************************************************************/
@@ -0,0 +1,55 @@
+/*****************************************************************************/
+// Copyright (c) 2020 Yuji KOGUMA
+// Released under the MIT license
+// https://opensource.org/licenses/mit-license.php
+/*****************************************************************************/
+#ifndef PRINTEMPS_SOLVER_MULTI_START_MULTI_START_OPTION_H__
+#define PRINTEMPS_SOLVER_MULTI_START_MULTI_START_OPTION_H__
+
+namespace printemps {
+namespace solver {
+namespace multi_start {
+/*****************************************************************************/
+struct MultiStartOptionConstant {
+    static constexpr int    DEFAULT_NUMBER_OF_CHAINS           = 4;
+    static constexpr int    DEFAULT_NUMBER_OF_ROUNDS           = 4;
+    static constexpr double DEFAULT_MIGRATION_RATE             = 0.5;
+    static constexpr bool   DEFAULT_IS_ENABLED_PARALLEL_CHAINS = true;
+};
+
+/*****************************************************************************/
+struct MultiStartOption {
+    int    number_of_chains;
+    int    number_of_rounds;
+    double migration_rate;
+    bool   is_enabled_parallel_chains;
+
+    /*************************************************************************/
+    MultiStartOption(void) {
+        this->initialize();
+    }
+
+    /*************************************************************************/
+    virtual ~MultiStartOption(void) {
+        /// nothing to do
+    }
+
+    /*************************************************************************/
+    void initialize(void) {
+        this->number_of_chains =
+            MultiStartOptionConstant::DEFAULT_NUMBER_OF_CHAINS;
+        this->number_of_rounds =
+            MultiStartOptionConstant::DEFAULT_NUMBER_OF_ROUNDS;
+        this->migration_rate = MultiStartOptionConstant::DEFAULT_MIGRATION_RATE;
+        this->is_enabled_parallel_chains =
+            MultiStartOptionConstant::DEFAULT_IS_ENABLED_PARALLEL_CHAINS;
+    }
+};
+}  // namespace multi_start
+}  // namespace solver
+}  // namespace printemps
+
+#endif
+/*****************************************************************************/
+// END
+/*****************************************************************************/
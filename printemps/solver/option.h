@@ -9,6 +9,8 @@
 #include "lagrange_dual/lagrange_dual_option.h"
 #include "local_search/local_search_option.h"
 #include "tabu_search/tabu_search_option.h"
+#include "multi_start/multi_start_option.h"
+#include "trace_writer.h"
 
 namespace printemps {
 namespace solver {
@@ -39,6 +41,7 @@ struct OptionConstant {
     static constexpr double DEFAULT_INITIAL_PENALTY_COEFFICIENT = 1E7;
     static constexpr bool   DEFAULT_IS_ENABLED_LAGRANGE_DUAL    = false;
     static constexpr bool   DEFAULT_IS_ENABLED_LOCAL_SEARCH     = false;
+    static constexpr bool   DEFAULT_IS_ENABLED_MULTI_START      = false;
     static constexpr bool   DEFAULT_IS_ENABLED_GROUPING_PENALTY_COEFFICIENT =
         false;
     static constexpr bool DEFAULT_IS_ENABLED_PRESOLVE                 = true;
@@ -46,6 +49,8 @@ struct OptionConstant {
     static constexpr bool DEFAULT_IS_ENABLED_PARALLEL_EVALUATION      = true;
     static constexpr bool DEFAULT_IS_ENABLED_PARALLEL_NEIGHBORHOOD_UPDATE =
         true;
+    static constexpr bool DEFAULT_IS_ENABLED_ADAPTIVE_PARALLELIZATION = true;
+    static constexpr int  DEFAULT_PARALLEL_SIZE_THRESHOLD        = 1000;
     static constexpr bool DEFAULT_IS_ENABLED_BINARY_MOVE         = true;
     static constexpr bool DEFAULT_IS_ENABLED_INTEGER_MOVE        = true;
     static constexpr bool DEFAULT_IS_ENABLED_AGGREGATION_MOVE    = false;
@@ -70,6 +75,13 @@ struct OptionConstant {
     static constexpr bool   DEFAULT_VERBOSE          = Verbose::None;
     static constexpr bool   DEFAULT_IS_ENABLED_COLLECT_HISTORICAL_DATA = false;
     static constexpr int    DEFAULT_HISTORICAL_DATA_CAPACITY           = 1000;
+    static constexpr bool   DEFAULT_IS_ENABLED_PROFILE                 = false;
+    static constexpr TraceMode   DEFAULT_TRACE_MODE      = TraceMode::None;
+    static constexpr const char *DEFAULT_TRACE_FILE_NAME = "trace";
+    static constexpr bool        DEFAULT_IS_ENABLED_CHECKPOINT = false;
+    static constexpr const char *DEFAULT_CHECKPOINT_FILE_NAME =
+        "checkpoint.bin";
+    static constexpr int DEFAULT_CHECKPOINT_INTERVAL = 1;
 };
 
 /*****************************************************************************/
@@ -84,11 +96,14 @@ struct Option {
     double initial_penalty_coefficient;
     bool   is_enabled_lagrange_dual;
     bool   is_enabled_local_search;
+    bool   is_enabled_multi_start;
     bool   is_enabled_grouping_penalty_coefficient;
     bool   is_enabled_presolve;
     bool   is_enabled_initial_value_correction;
     bool   is_enabled_parallel_evaluation;
     bool   is_enabled_parallel_neighborhood_update;
+    bool   is_enabled_adaptive_parallelization;  // hidden
+    int    parallel_size_threshold;              // hidden
 
     bool is_enabled_binary_move;
     bool is_enabled_integer_move;
@@ -112,9 +127,18 @@ struct Option {
     bool   is_enabled_collect_historical_data;  // hidden
     int    historical_data_capacity;            // hidden
 
+    bool        is_enabled_profile;
+    TraceMode   trace_mode;
+    std::string trace_file_name;
+
+    bool        is_enabled_checkpoint;
+    std::string checkpoint_file_name;
+    int         checkpoint_interval;
+
     tabu_search::TabuSearchOption     tabu_search;
     local_search::LocalSearchOption   local_search;
     lagrange_dual::LagrangeDualOption lagrange_dual;
+    multi_start::MultiStartOption     multi_start;
 
     /*************************************************************************/
     Option(void) {
@@ -145,6 +169,8 @@ struct Option {
             OptionConstant::DEFAULT_IS_ENABLED_LAGRANGE_DUAL;
         this->is_enabled_local_search =
             OptionConstant::DEFAULT_IS_ENABLED_LOCAL_SEARCH;
+        this->is_enabled_multi_start =
+            OptionConstant::DEFAULT_IS_ENABLED_MULTI_START;
         this->is_enabled_grouping_penalty_coefficient =
             OptionConstant::DEFAULT_IS_ENABLED_GROUPING_PENALTY_COEFFICIENT;
         this->is_enabled_presolve = OptionConstant::DEFAULT_IS_ENABLED_PRESOLVE;
@@ -154,6 +180,10 @@ struct Option {
             OptionConstant::DEFAULT_IS_ENABLED_PARALLEL_EVALUATION;
         this->is_enabled_parallel_neighborhood_update =
             OptionConstant::DEFAULT_IS_ENABLED_PARALLEL_NEIGHBORHOOD_UPDATE;
+        this->is_enabled_adaptive_parallelization =
+            OptionConstant::DEFAULT_IS_ENABLED_ADAPTIVE_PARALLELIZATION;
+        this->parallel_size_threshold =
+            OptionConstant::DEFAULT_PARALLEL_SIZE_THRESHOLD;
         this->is_enabled_binary_move =
             OptionConstant::DEFAULT_IS_ENABLED_BINARY_MOVE;
         this->is_enabled_integer_move =
@@ -187,10 +217,20 @@ struct Option {
             OptionConstant::DEFAULT_IS_ENABLED_COLLECT_HISTORICAL_DATA;
         this->historical_data_capacity =
             OptionConstant::DEFAULT_HISTORICAL_DATA_CAPACITY;
+        this->is_enabled_profile = OptionConstant::DEFAULT_IS_ENABLED_PROFILE;
+        this->trace_mode         = OptionConstant::DEFAULT_TRACE_MODE;
+        this->trace_file_name    = OptionConstant::DEFAULT_TRACE_FILE_NAME;
+
+        this->is_enabled_checkpoint =
+            OptionConstant::DEFAULT_IS_ENABLED_CHECKPOINT;
+        this->checkpoint_file_name =
+            OptionConstant::DEFAULT_CHECKPOINT_FILE_NAME;
+        this->checkpoint_interval = OptionConstant::DEFAULT_CHECKPOINT_INTERVAL;
 
         this->lagrange_dual.initialize();
         this->local_search.initialize();
         this->tabu_search.initialize();
+        this->multi_start.initialize();
     }
 
     /*************************************************************************/
@@ -246,6 +286,10 @@ struct Option {
             " -- is_enabled_local_search: " +  //
             utility::to_string(this->is_enabled_local_search, "%d"));
 
+        utility::print(                       //
+            " -- is_enabled_multi_start: " +  //
+            utility::to_string(this->is_enabled_multi_start, "%d"));
+
         utility::print(                                        //
             " -- is_enabled_grouping_penalty_coefficient: " +  //
             utility::to_string(this->is_enabled_grouping_penalty_coefficient,
@@ -265,6 +309,15 @@ struct Option {
             utility::to_string(this->is_enabled_parallel_neighborhood_update,
                                "%d"));
 
+        utility::print(                                    //
+            " -- is_enabled_adaptive_parallelization: " +  //
+            utility::to_string(this->is_enabled_adaptive_parallelization,
+                               "%d"));
+
+        utility::print(                        //
+            " -- parallel_size_threshold: " +  //
+            utility::to_string(this->parallel_size_threshold, "%d"));
+
         utility::print(                       //
             " -- is_enabled_binary_move: " +  //
             utility::to_string(this->is_enabled_binary_move, "%d"));
@@ -337,6 +390,30 @@ struct Option {
             " -- historical_data_capacity: " +  //
             utility::to_string(this->historical_data_capacity, "%d"));
 
+        utility::print(                   //
+            " -- is_enabled_profile: " +  //
+            utility::to_string(this->is_enabled_profile, "%d"));
+
+        utility::print(           //
+            " -- trace_mode: " +  //
+            utility::to_string(static_cast<int>(this->trace_mode), "%d"));
+
+        utility::print(                //
+            " -- trace_file_name: " +  //
+            this->trace_file_name);
+
+        utility::print(                      //
+            " -- is_enabled_checkpoint: " +  //
+            utility::to_string(this->is_enabled_checkpoint, "%d"));
+
+        utility::print(                     //
+            " -- checkpoint_file_name: " +  //
+            this->checkpoint_file_name);
+
+        utility::print(                    //
+            " -- checkpoint_interval: " +  //
+            utility::to_string(this->checkpoint_interval, "%d"));
+
         utility::print(                            //
             " -- lagrange_dual.iteration_max: " +  //
             utility::to_string(this->lagrange_dual.iteration_max, "%d"));
@@ -371,6 +448,15 @@ struct Option {
             " -- lagrange_dual.log_interval: " +  //
             utility::to_string(this->lagrange_dual.log_interval, "%d"));
 
+        utility::print(                     //
+            " -- lagrange_dual.method: " +  //
+            utility::to_string(this->lagrange_dual.method, "%d"));
+
+        utility::print(                                        //
+            " -- lagrange_dual.volume_averaging_rate_max: " +  //
+            utility::to_string(this->lagrange_dual.volume_averaging_rate_max,
+                               "%f"));
+
         utility::print(                           //
             " -- local_search.iteration_max: " +  //
             utility::to_string(this->local_search.iteration_max, "%d"));
@@ -504,9 +590,36 @@ struct Option {
             utility::to_string(this->tabu_search.number_of_initial_modification,
                                "%d"));
 
+        utility::print(                                             //
+            " -- tabu_search.is_enabled_move_evaluation_cache: " +  //
+            utility::to_string(
+                this->tabu_search.is_enabled_move_evaluation_cache, "%d"));
+
+        utility::print(                                              //
+            " -- tabu_search.is_enabled_binary_flip_evaluation: " +  //
+            utility::to_string(
+                this->tabu_search.is_enabled_binary_flip_evaluation, "%d"));
+
         utility::print(               //
             " -- tabu_search.seed: "  //
             + utility::to_string(this->tabu_search.seed, "%d"));
+
+        utility::print(                             //
+            " -- multi_start.number_of_chains: " +  //
+            utility::to_string(this->multi_start.number_of_chains, "%d"));
+
+        utility::print(                             //
+            " -- multi_start.number_of_rounds: " +  //
+            utility::to_string(this->multi_start.number_of_rounds, "%d"));
+
+        utility::print(                           //
+            " -- multi_start.migration_rate: " +  //
+            utility::to_string(this->multi_start.migration_rate, "%f"));
+
+        utility::print(                                       //
+            " -- multi_start.is_enabled_parallel_chains: " +  //
+            utility::to_string(this->multi_start.is_enabled_parallel_chains,
+                               "%d"));
     }
 };
 }  // namespace solver
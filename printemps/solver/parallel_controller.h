@@ -0,0 +1,224 @@
+/*****************************************************************************/
+// Copyright (c) 2020 Yuji KOGUMA
+// Released under the MIT license
+// https://opensource.org/licenses/mit-license.php
+/*****************************************************************************/
+#ifndef PRINTEMPS_SOLVER_PARALLEL_CONTROLLER_H__
+#define PRINTEMPS_SOLVER_PARALLEL_CONTROLLER_H__
+
+#include <array>
+#include <string>
+
+namespace printemps {
+namespace solver {
+/*****************************************************************************/
+enum class ParallelPhase : int { NeighborhoodUpdate, Evaluation };
+
+/*****************************************************************************/
+enum class ParallelMode : int { Serial, Parallel, Calibrating };
+
+/*****************************************************************************/
+struct ParallelControllerConstant {
+    static constexpr int NUMBER_OF_PHASES             = 2;
+    static constexpr int NUMBER_OF_SIZE_CLASSES       = 32;
+    static constexpr int NUMBER_OF_CALIBRATION_TRIALS = 3;
+};
+
+/*****************************************************************************/
+inline std::string parallel_mode_name(const ParallelMode a_MODE) {
+    switch (a_MODE) {
+        case ParallelMode::Serial: {
+            return "serial";
+        }
+        case ParallelMode::Parallel: {
+            return "parallel";
+        }
+        case ParallelMode::Calibrating: {
+            return "calibrating";
+        }
+        default: {
+            return "";
+        }
+    }
+}
+
+/*****************************************************************************/
+struct ParallelCalibration {
+    int    serial_count;
+    int    parallel_count;
+    double serial_elapsed_time;
+    double parallel_elapsed_time;
+};
+
+/*****************************************************************************/
+class ParallelController {
+    /**
+     * ParallelController decides whether each phase of the tabu search is
+     * executed in serial or in parallel. If the adaptive mode is enabled, the
+     * decision is made for each size class of the neighborhood, where the
+     * size class is floor(log2(size)). When a size class is used for the
+     * first time, the phase is executed in serial and in parallel for
+     * several trials each, and then the faster mode is adopted for the size
+     * class. Therefore, the calibration is done again when the neighborhood
+     * grows or shrinks, for example, when the special neighborhood moves are
+     * enabled. If the adaptive mode is disabled, the phase is executed in
+     * parallel if it is enabled and otherwise in serial. In both modes, a
+     * neighborhood smaller than the threshold is processed in serial.
+     */
+   private:
+    std::array<bool, ParallelControllerConstant::NUMBER_OF_PHASES>
+         m_is_enabled_parallel;
+    bool m_is_enabled_adaptive;
+    int  m_parallel_size_threshold;
+
+    std::array<std::array<ParallelCalibration,
+                          ParallelControllerConstant::NUMBER_OF_SIZE_CLASSES>,
+               ParallelControllerConstant::NUMBER_OF_PHASES>
+        m_calibrations;
+
+    std::array<ParallelMode, ParallelControllerConstant::NUMBER_OF_PHASES>
+        m_last_modes;
+
+    /*************************************************************************/
+    inline static constexpr int compute_size_class(const int a_SIZE) {
+        int size_class = 0;
+        int size       = a_SIZE;
+        while (size > 1 &&
+               size_class <
+                   ParallelControllerConstant::NUMBER_OF_SIZE_CLASSES - 1) {
+            size >>= 1;
+            size_class++;
+        }
+        return size_class;
+    }
+
+   public:
+    /*************************************************************************/
+    ParallelController(void) {
+        this->initialize();
+    }
+
+    /*************************************************************************/
+    virtual ~ParallelController(void) {
+        /// nothing to do
+    }
+
+    /*************************************************************************/
+    inline void initialize(void) {
+        m_is_enabled_parallel.fill(false);
+        m_is_enabled_adaptive     = false;
+        m_parallel_size_threshold = 0;
+        for (auto &&calibrations : m_calibrations) {
+            calibrations.fill(ParallelCalibration{0, 0, 0.0, 0.0});
+        }
+        m_last_modes.fill(ParallelMode::Serial);
+    }
+
+    /*************************************************************************/
+    inline void setup(const bool a_IS_ENABLED_PARALLEL_NEIGHBORHOOD_UPDATE,
+                      const bool a_IS_ENABLED_PARALLEL_EVALUATION,
+                      const bool a_IS_ENABLED_ADAPTIVE,
+                      const int  a_PARALLEL_SIZE_THRESHOLD) {
+        this->initialize();
+        m_is_enabled_parallel[static_cast<int>(
+            ParallelPhase::NeighborhoodUpdate)] =
+            a_IS_ENABLED_PARALLEL_NEIGHBORHOOD_UPDATE;
+        m_is_enabled_parallel[static_cast<int>(ParallelPhase::Evaluation)] =
+            a_IS_ENABLED_PARALLEL_EVALUATION;
+        m_is_enabled_adaptive     = a_IS_ENABLED_ADAPTIVE;
+        m_parallel_size_threshold = a_PARALLEL_SIZE_THRESHOLD;
+    }
+
+    /*************************************************************************/
+    inline bool is_parallel(const ParallelPhase a_PHASE, const int a_SIZE) {
+        /**
+         * This method returns whether the phase for a neighborhood of a_SIZE
+         * should be executed in parallel. A neighborhood smaller than the
+         * threshold is always processed in serial. During the calibration,
+         * the serial and the parallel executions are returned alternately,
+         * and the caller must report the elapsed time by record().
+         */
+        const int PHASE = static_cast<int>(a_PHASE);
+        if (!m_is_enabled_parallel[PHASE] ||
+            a_SIZE < m_parallel_size_threshold) {
+            m_last_modes[PHASE] = ParallelMode::Serial;
+            return false;
+        }
+        if (!m_is_enabled_adaptive) {
+            m_last_modes[PHASE] = ParallelMode::Parallel;
+            return true;
+        }
+
+        const auto &calibration =
+            m_calibrations[PHASE][compute_size_class(a_SIZE)];
+        const int TRIALS =
+            ParallelControllerConstant::NUMBER_OF_CALIBRATION_TRIALS;
+
+        if (calibration.serial_count < TRIALS ||
+            calibration.parallel_count < TRIALS) {
+            m_last_modes[PHASE] = ParallelMode::Calibrating;
+            return calibration.parallel_count < calibration.serial_count;
+        }
+
+        const bool IS_PARALLEL = calibration.parallel_elapsed_time <
+                                 calibration.serial_elapsed_time;
+        m_last_modes[PHASE] =
+            IS_PARALLEL ? ParallelMode::Parallel : ParallelMode::Serial;
+        return IS_PARALLEL;
+    }
+
+    /*************************************************************************/
+    inline bool is_calibrating(const ParallelPhase a_PHASE,
+                               const int           a_SIZE) const {
+        const int PHASE = static_cast<int>(a_PHASE);
+        if (!m_is_enabled_parallel[PHASE] || !m_is_enabled_adaptive ||
+            a_SIZE < m_parallel_size_threshold) {
+            return false;
+        }
+        const auto &calibration =
+            m_calibrations[PHASE][compute_size_class(a_SIZE)];
+        const int TRIALS =
+            ParallelControllerConstant::NUMBER_OF_CALIBRATION_TRIALS;
+        return calibration.serial_count < TRIALS ||
+               calibration.parallel_count < TRIALS;
+    }
+
+    /*************************************************************************/
+    inline void record(const ParallelPhase a_PHASE,        //
+                       const int           a_SIZE,         //
+                       const bool          a_IS_PARALLEL,  //
+                       const double        a_ELAPSED_TIME) {
+        auto &calibration = m_calibrations[static_cast<int>(a_PHASE)]
+                                          [compute_size_class(a_SIZE)];
+        if (a_IS_PARALLEL) {
+            calibration.parallel_count++;
+            calibration.parallel_elapsed_time += a_ELAPSED_TIME;
+        } else {
+            calibration.serial_count++;
+            calibration.serial_elapsed_time += a_ELAPSED_TIME;
+        }
+    }
+
+    /*************************************************************************/
+    inline constexpr bool is_enabled_adaptive(void) const {
+        return m_is_enabled_adaptive;
+    }
+
+    /*************************************************************************/
+    inline constexpr int parallel_size_threshold(void) const {
+        return m_parallel_size_threshold;
+    }
+
+    /*************************************************************************/
+    inline constexpr ParallelMode last_mode(
+        const ParallelPhase a_PHASE) const {
+        return m_last_modes[static_cast<int>(a_PHASE)];
+    }
+};
+}  // namespace solver
+}  // namespace printemps
+
+#endif
+/*****************************************************************************/
+// END
+/*****************************************************************************/
@@ -0,0 +1,191 @@
+/*****************************************************************************/
+// Copyright (c) 2020 Yuji KOGUMA
+// Released under the MIT license
+// https://opensource.org/licenses/mit-license.php
+/*****************************************************************************/
+#ifndef PRINTEMPS_SOLVER_PROFILER_H__
+#define PRINTEMPS_SOLVER_PROFILER_H__
+
+#include <array>
+#include <chrono>
+#include <string>
+
+namespace printemps {
+namespace solver {
+/*****************************************************************************/
+enum class ProfilePhase : int {
+    ImprovabilityUpdate,
+    MoveUpdate,
+    Shuffle,
+    Evaluation,
+    Selection,
+    ModelUpdate,
+    IncumbentUpdate,
+    MemoryUpdate,
+    ChainMoveRegistration,
+    DualUpdate,
+    PrimalUpdate,
+    Averaging
+};
+
+/*****************************************************************************/
+struct ProfilerConstant {
+    static constexpr int NUMBER_OF_PHASES = 12;
+};
+
+/*****************************************************************************/
+inline std::string profile_phase_name(const ProfilePhase a_PHASE) {
+    switch (a_PHASE) {
+        case ProfilePhase::ImprovabilityUpdate: {
+            return "improvability_update";
+        }
+        case ProfilePhase::MoveUpdate: {
+            return "move_update";
+        }
+        case ProfilePhase::Shuffle: {
+            return "shuffle";
+        }
+        case ProfilePhase::Evaluation: {
+            return "evaluation";
+        }
+        case ProfilePhase::Selection: {
+            return "selection";
+        }
+        case ProfilePhase::ModelUpdate: {
+            return "model_update";
+        }
+        case ProfilePhase::IncumbentUpdate: {
+            return "incumbent_update";
+        }
+        case ProfilePhase::MemoryUpdate: {
+            return "memory_update";
+        }
+        case ProfilePhase::ChainMoveRegistration: {
+            return "chain_move_registration";
+        }
+        case ProfilePhase::DualUpdate: {
+            return "dual_update";
+        }
+        case ProfilePhase::PrimalUpdate: {
+            return "primal_update";
+        }
+        case ProfilePhase::Averaging: {
+            return "averaging";
+        }
+        default: {
+            return "";
+        }
+    }
+}
+
+/*****************************************************************************/
+class Profiler {
+    /**
+     * Profiler accumulates the elapsed wall-clock time and the number of
+     * executions for each phase of the search loops. The time of a phase is
+     * measured between start() and stop(), and is also kept per iteration for
+     * the search trace. If the profiler is not enabled, start() and stop() do
+     * nothing.
+     */
+   private:
+    bool m_is_enabled;
+
+    std::array<double, ProfilerConstant::NUMBER_OF_PHASES> m_elapsed_times;
+    std::array<long, ProfilerConstant::NUMBER_OF_PHASES>   m_counts;
+    std::array<double, ProfilerConstant::NUMBER_OF_PHASES>
+        m_iteration_elapsed_times;
+
+    std::chrono::steady_clock::time_point m_start_time_point;
+
+   public:
+    /*************************************************************************/
+    Profiler(void) {
+        this->initialize();
+    }
+
+    /*************************************************************************/
+    virtual ~Profiler(void) {
+        /// nothing to do
+    }
+
+    /*************************************************************************/
+    inline void initialize(void) {
+        m_is_enabled = false;
+        m_elapsed_times.fill(0.0);
+        m_counts.fill(0);
+        m_iteration_elapsed_times.fill(0.0);
+        m_start_time_point = std::chrono::steady_clock::time_point();
+    }
+
+    /*************************************************************************/
+    inline void setup(const bool a_IS_ENABLED) {
+        this->initialize();
+        m_is_enabled = a_IS_ENABLED;
+    }
+
+    /*************************************************************************/
+    inline void start_iteration(void) {
+        if (!m_is_enabled) {
+            return;
+        }
+        m_iteration_elapsed_times.fill(0.0);
+    }
+
+    /*************************************************************************/
+    inline void start(void) {
+        if (!m_is_enabled) {
+            return;
+        }
+        m_start_time_point = std::chrono::steady_clock::now();
+    }
+
+    /*************************************************************************/
+    inline void stop(const ProfilePhase a_PHASE) {
+        if (!m_is_enabled) {
+            return;
+        }
+        const auto   NOW          = std::chrono::steady_clock::now();
+        const double ELAPSED_TIME = std::chrono::duration<double>(
+                                        NOW - m_start_time_point)
+                                        .count();
+        const int INDEX = static_cast<int>(a_PHASE);
+        m_elapsed_times[INDEX] += ELAPSED_TIME;
+        m_iteration_elapsed_times[INDEX] += ELAPSED_TIME;
+        m_counts[INDEX]++;
+    }
+
+    /*************************************************************************/
+    inline void merge(const Profiler &a_OTHER) {
+        for (auto i = 0; i < ProfilerConstant::NUMBER_OF_PHASES; i++) {
+            m_elapsed_times[i] += a_OTHER.m_elapsed_times[i];
+            m_counts[i] += a_OTHER.m_counts[i];
+        }
+    }
+
+    /*************************************************************************/
+    inline constexpr bool is_enabled(void) const {
+        return m_is_enabled;
+    }
+
+    /*************************************************************************/
+    inline double elapsed_time(const ProfilePhase a_PHASE) const {
+        return m_elapsed_times[static_cast<int>(a_PHASE)];
+    }
+
+    /*************************************************************************/
+    inline long count(const ProfilePhase a_PHASE) const {
+        return m_counts[static_cast<int>(a_PHASE)];
+    }
+
+    /*************************************************************************/
+    inline double iteration_elapsed_time(const ProfilePhase a_PHASE) const {
+        return m_iteration_elapsed_times[static_cast<int>(a_PHASE)];
+    }
+};
+}  // namespace solver
+}  // namespace printemps
+
+#endif
+/*****************************************************************************/
+// END
+/*****************************************************************************/
@@ -17,6 +17,7 @@
 #include "option.h"
 #include "status.h"
 #include "solution_archive.h"
+#include "checkpoint.h"
 #include "result.h"
 #include "tabu_search/tabu_search.h"
 #include "local_search/local_search.h"
@@ -37,6 +38,52 @@ template <class T_Variable, class T_Expression>
 Result<T_Variable, T_Expression> solve(
     model::Model<T_Variable, T_Expression>* a_model,  //
     const Option&                           a_OPTION) {
+    return solve(a_model, a_OPTION,
+                 static_cast<const Checkpoint<T_Variable, T_Expression>*>(
+                     nullptr));
+}
+
+/*****************************************************************************/
+template <class T_Variable, class T_Expression>
+Result<T_Variable, T_Expression> resume(
+    model::Model<T_Variable, T_Expression>* a_model,   //
+    const Option&                           a_OPTION,  //
+    const std::string&                      a_CHECKPOINT_FILE_NAME) {
+    /**
+     * This function resumes the search from the checkpoint written by a
+     * previous run for the same model and option. The model must be built
+     * in the same way as the previous run, since the checkpoint refers to
+     * the variables and the constraints by their global indices.
+     */
+    Checkpoint<T_Variable, T_Expression> checkpoint;
+    checkpoint.read(a_CHECKPOINT_FILE_NAME);
+    return solve(a_model, a_OPTION, &checkpoint);
+}
+
+/*****************************************************************************/
+template <class T_Variable, class T_Expression>
+Result<T_Variable, T_Expression> solve(
+    model::Model<T_Variable, T_Expression>*     a_model,   //
+    const Option&                               a_OPTION,  //
+    const Checkpoint<T_Variable, T_Expression>* a_CHECKPOINT_PTR) {
+    return solve(a_model, a_OPTION, a_CHECKPOINT_PTR,
+                 static_cast<Checkpoint<T_Variable, T_Expression>*>(nullptr));
+}
+
+/*****************************************************************************/
+template <class T_Variable, class T_Expression>
+Result<T_Variable, T_Expression> solve(
+    model::Model<T_Variable, T_Expression>*     a_model,           //
+    const Option&                               a_OPTION,          //
+    const Checkpoint<T_Variable, T_Expression>* a_CHECKPOINT_PTR,  //
+    Checkpoint<T_Variable, T_Expression>*       a_last_checkpoint_ptr) {
+    /**
+     * If a_CHECKPOINT_PTR is given, the search is resumed from it. If
+     * a_last_checkpoint_ptr is given, the state at the end of the search is
+     * exported to it, so that the search can be continued in memory without
+     * writing the checkpoint file. They may point to the same object.
+     */
+
     /**
      * Start to measure computational time and get the starting time.
      */
@@ -54,9 +101,12 @@ Result<T_Variable, T_Expression> solve(
                    a_OPTION.verbose >= Verbose::Outer);
 
     /**
-     * The model can be solved only once.
+     * The model can be solved only once, unless the search on it is resumed
+     * from a checkpoint. In that case, the model has already been set up by
+     * the previous search, and the setup is skipped.
      */
-    if (a_model->is_solved()) {
+    const bool IS_SETUP_REQUIRED = !a_model->is_solved();
+    if (a_model->is_solved() && a_CHECKPOINT_PTR == nullptr) {
         throw std::logic_error(utility::format_error_location(
             __FILE__, __LINE__, __func__,
             "This model has already been solved."));
@@ -68,8 +118,9 @@ Result<T_Variable, T_Expression> solve(
      * Define type aliases.
      */
     using Model_T           = model::Model<T_Variable, T_Expression>;
-    using Solution_T        = model::Solution<T_Variable, T_Expression>;
+    using Solution_T        = model::CompactSolution<T_Variable, T_Expression>;
     using IncumbentHolder_T = IncumbentHolder<T_Variable, T_Expression>;
+    using Checkpoint_T      = Checkpoint<T_Variable, T_Expression>;
 
     /**
      * Copy arguments as local variables.
@@ -77,6 +128,12 @@ Result<T_Variable, T_Expression> solve(
     Model_T* model         = a_model;
     Option   master_option = a_OPTION;
 
+    /**
+     * If the checkpoint is given, the Lagrange dual and the local search are
+     * skipped, and the tabu search loops are resumed from the checkpoint.
+     */
+    const bool IS_RESUMED = a_CHECKPOINT_PTR != nullptr;
+
     /**
      * Set default target objective value if it is not defined by the user.
      * For minimization problems, the default target value is set as -1E100.
@@ -122,17 +179,21 @@ Result<T_Variable, T_Expression> solve(
      * - verify_and_correct_binary_variables_initial_values()
      * - verify_and_correct_integer_variables_initial_values()
      * - setup_fixed_sensitivities()
+     * - setup_is_enabled_fast_evaluation()
+     * - setup_constraint_matrix()
      */
-    model->setup(master_option.is_enabled_presolve,
-                 master_option.is_enabled_initial_value_correction,
-                 master_option.is_enabled_aggregation_move,
-                 master_option.is_enabled_precedence_move,
-                 master_option.is_enabled_variable_bound_move,
-                 master_option.is_enabled_exclusive_move,
-                 master_option.is_enabled_user_defined_move,
-                 master_option.is_enabled_chain_move,
-                 master_option.selection_mode,
-                 master_option.verbose >= Verbose::Outer);
+    if (IS_SETUP_REQUIRED) {
+        model->setup(master_option.is_enabled_presolve,
+                     master_option.is_enabled_initial_value_correction,
+                     master_option.is_enabled_aggregation_move,
+                     master_option.is_enabled_precedence_move,
+                     master_option.is_enabled_variable_bound_move,
+                     master_option.is_enabled_exclusive_move,
+                     master_option.is_enabled_user_defined_move,
+                     master_option.is_enabled_chain_move,
+                     master_option.selection_mode,
+                     master_option.verbose >= Verbose::Outer);
+    }
 
     /**
      * Print the problem size.
@@ -185,6 +246,13 @@ Result<T_Variable, T_Expression> solve(
         model->neighborhood().enable_selection_move();
     }
 
+    /**
+     * The moves of a neighborhood smaller than the threshold will be updated
+     * in serial.
+     */
+    model->neighborhood().set_parallel_size_threshold(
+        master_option.parallel_size_threshold);
+
     /**
      * Check whether there exist special neighborhood moves or not.
      */
@@ -220,6 +288,18 @@ Result<T_Variable, T_Expression> solve(
      */
     Memory memory(model);
 
+    /**
+     * Prepare the parallel controller which decides whether each phase of the
+     * tabu search is executed in serial or in parallel. The calibration
+     * results are carried over the tabu search loops.
+     */
+    ParallelController parallel_controller;
+    parallel_controller.setup(
+        master_option.is_enabled_parallel_neighborhood_update,
+        master_option.is_enabled_parallel_evaluation,
+        master_option.is_enabled_adaptive_parallelization,
+        master_option.parallel_size_threshold);
+
     /**
      * Prepare feasible solutions archive.
      */
@@ -236,13 +316,26 @@ Result<T_Variable, T_Expression> solve(
     /**
      * Prepare local variables to be updated in the following process.
      */
-    Solution_T        current_solution = model->export_solution();
+    Solution_T        current_solution = model->export_compact_solution();
     Solution_T        previous_solution;
     IncumbentHolder_T incumbent_holder;
 
     model::SolutionScore current_solution_score = model->evaluate({});
     model::SolutionScore previous_solution_score;
 
+    /**
+     * Prepare the profiler which accumulates the profiles of the searches,
+     * and create the trace file (optional). The searches append their
+     * records to the trace file.
+     */
+    Profiler profiler;
+    profiler.setup(master_option.is_enabled_profile ||
+                   master_option.trace_mode != TraceMode::None);
+
+    TraceWriter trace_writer;
+    trace_writer.create(master_option.trace_file_name,
+                        master_option.trace_mode);
+
     [[maybe_unused]] int update_status = incumbent_holder.try_update_incumbent(
         current_solution, current_solution_score);
 
@@ -251,8 +344,21 @@ Result<T_Variable, T_Expression> solve(
     int number_of_tabu_search_iterations   = 0;
     int number_of_tabu_search_loops        = 0;
 
+    bool   is_found_lagrangian_bound = false;
+    double lagrangian_bound          = 0.0;
+
     bool is_terminated = false;
 
+    /**
+     * If the checkpoint is enabled, SIGTERM is caught so that the checkpoint
+     * is written before the termination. The previous handler is restored
+     * when this function returns.
+     */
+    utility::TerminationSignalHandler termination_signal_handler;
+    if (master_option.is_enabled_checkpoint) {
+        termination_signal_handler.install();
+    }
+
     /**
      * Start optimization.
      */
@@ -265,7 +371,8 @@ Result<T_Variable, T_Expression> solve(
     /**
      * Solve Lagrange dual to obtain a better initial solution ß(Optional).
      */
-    if (master_option.is_enabled_lagrange_dual && !is_terminated) {
+    if (master_option.is_enabled_lagrange_dual && !is_terminated &&
+        !IS_RESUMED) {
         utility::print_single_line(master_option.verbose == Verbose::Outer);
         if (!model->is_linear()) {
             utility::print_warning(
@@ -308,18 +415,17 @@ Result<T_Variable, T_Expression> solve(
                 /**
                  * Prepare the initial variable values.
                  */
-                std::vector<model::ValueProxy<T_Variable>>
-                    initial_variable_value_proxies =
-                        current_solution.variable_value_proxies;
+                std::vector<T_Variable> initial_variable_values =
+                    current_solution.variables;
 
                 /**
                  * Run the lagrange dual search.
                  */
                 auto result =
-                    lagrange_dual::solve(model,                           //
-                                         option,                          //
-                                         initial_variable_value_proxies,  //
-                                         incumbent_holder);               //
+                    lagrange_dual::solve(model,                    //
+                                         option,                   //
+                                         initial_variable_values,  //
+                                         incumbent_holder);        //
 
                 /**
                  * Update the current solution.
@@ -359,13 +465,56 @@ Result<T_Variable, T_Expression> solve(
                         result.incumbent_holder.feasible_incumbent_score());
                 }
 
+                /**
+                 * The primal estimate averaged by the volume algorithm is
+                 * rounded, and it replaces the initial solution of the local
+                 * search if it has a better global augmented objective.
+                 */
+                if (!result.primal_estimate.empty()) {
+                    const auto& variable_ptrs =
+                        model->variable_reference().variable_ptrs;
+                    const int VARIABLES_SIZE = variable_ptrs.size();
+
+                    std::vector<T_Variable> rounded_variable_values =
+                        current_solution.variables;
+                    for (auto i = 0; i < VARIABLES_SIZE; i++) {
+                        rounded_variable_values[variable_ptrs[i]
+                                                    ->global_index()] =
+                            static_cast<T_Variable>(
+                                std::round(result.primal_estimate[i]));
+                    }
+
+                    model->import_variable_values(rounded_variable_values);
+                    model->update();
+
+                    const auto ROUNDED_SOLUTION =
+                        model->export_compact_solution();
+                    const auto ROUNDED_SOLUTION_SCORE = model->evaluate({});
+
+                    update_status = incumbent_holder.try_update_incumbent(
+                        ROUNDED_SOLUTION, ROUNDED_SOLUTION_SCORE);
+
+                    if (ROUNDED_SOLUTION_SCORE.global_augmented_objective <
+                        current_solution_score.global_augmented_objective) {
+                        current_solution       = ROUNDED_SOLUTION;
+                        current_solution_score = ROUNDED_SOLUTION_SCORE;
+                    }
+                }
+
                 /**
                  * Preserve the number of iterations for solving the Lagrange
-                 * dual problem.
+                 * dual problem, and the best Lagrangian as the bound of the
+                 * objective.
                  */
+                profiler.merge(result.profiler);
                 number_of_lagrange_dual_iterations =
                     result.number_of_iterations;
 
+                if (std::isfinite(result.lagrangian)) {
+                    is_found_lagrangian_bound = true;
+                    lagrangian_bound = result.lagrangian * model->sign();
+                }
+
                 /**
                  * Measure the elapsed time to solve the Lagrange dual problem.
                  */
@@ -398,6 +547,13 @@ Result<T_Variable, T_Expression> solve(
                                 model->sign(),
                             "%.3f"),
                     master_option.verbose >= Verbose::Outer);
+
+                if (is_found_lagrangian_bound) {
+                    utility::print_info(
+                        " -- Lagrangian bound: " +
+                            utility::to_string(lagrangian_bound, "%.3f"),
+                        master_option.verbose >= Verbose::Outer);
+                }
             }
         }
     }
@@ -405,7 +561,8 @@ Result<T_Variable, T_Expression> solve(
     /**
      * Run a local search to improve the initial solution (optional).
      */
-    if (master_option.is_enabled_local_search && !is_terminated) {
+    if (master_option.is_enabled_local_search && !is_terminated &&
+        !IS_RESUMED) {
         double elapsed_time = time_keeper.clock();
         utility::print_single_line(master_option.verbose == Verbose::Outer);
         /**
@@ -436,19 +593,18 @@ Result<T_Variable, T_Expression> solve(
             /**
              * Prepare the initial variable values.
              */
-            std::vector<model::ValueProxy<T_Variable>>
-                initial_variable_value_proxies =
-                    current_solution.variable_value_proxies;
+            std::vector<T_Variable> initial_variable_values =
+                current_solution.variables;
 
             /**
              * Run the local search.
              */
             auto result =
-                local_search::solve(model,                           //
-                                    option,                          //
-                                    initial_variable_value_proxies,  //
-                                    incumbent_holder,                //
-                                    memory);                         //
+                local_search::solve(model,                    //
+                                    option,                   //
+                                    initial_variable_values,  //
+                                    incumbent_holder,         //
+                                    &memory);                 //
 
             /**
              * Update the current solution.
@@ -487,14 +643,10 @@ Result<T_Variable, T_Expression> solve(
                     result.incumbent_holder.feasible_incumbent_score());
             }
 
-            /**
-             * Update the memory.
-             */
-            memory = result.memory;
-
             /**
              * Preserve the number of iterations for the local search.
              */
+            profiler.merge(result.profiler);
             number_of_local_search_iterations = result.number_of_iterations;
 
             /**
@@ -555,12 +707,139 @@ Result<T_Variable, T_Expression> solve(
         improvability_screening_mode = ImprovabilityScreeningMode::Intensive;
     }
 
+    /**
+     * Restore the state of the tabu search loops from the checkpoint. The
+     * elapsed time of the previous run is added to the elapsed time so that
+     * the time limit covers both of the runs.
+     */
+    double elapsed_time_offset = 0.0;
+    if (IS_RESUMED) {
+        const auto& checkpoint = *a_CHECKPOINT_PTR;
+
+        checkpoint.import_model_state(model);
+        checkpoint.import_memory(&memory);
+        checkpoint.import_random_generator(&get_rand_mt);
+
+        incumbent_holder.initialize();
+        update_status = incumbent_holder.try_update_incumbent(
+            checkpoint.global_augmented_incumbent_solution,
+            checkpoint.global_augmented_incumbent_score);
+        if (checkpoint.is_found_feasible_solution) {
+            update_status = incumbent_holder.try_update_incumbent(
+                checkpoint.feasible_incumbent_solution,
+                checkpoint.feasible_incumbent_score);
+        }
+
+        current_solution        = checkpoint.current_solution;
+        current_solution_score  = checkpoint.current_solution_score;
+        previous_solution       = checkpoint.previous_solution;
+        previous_solution_score = checkpoint.previous_solution_score;
+
+        iteration = checkpoint.iteration;
+        no_global_augmented_incumbent_update_count =
+            checkpoint.no_global_augmented_incumbent_update_count;
+        no_update_count = checkpoint.no_update_count;
+        termination_status =
+            static_cast<tabu_search::TabuSearchTerminationStatus>(
+                checkpoint.termination_status);
+        penalty_coefficient_reset_flag =
+            checkpoint.penalty_coefficient_reset_flag;
+        inital_tabu_tenure             = checkpoint.initial_tabu_tenure;
+        pruning_rate_threshold         = checkpoint.pruning_rate_threshold;
+        number_of_initial_modification =
+            checkpoint.number_of_initial_modification;
+        iteration_max = checkpoint.iteration_max;
+        improvability_screening_mode =
+            static_cast<ImprovabilityScreeningMode>(
+                checkpoint.improvability_screening_mode);
+
+        number_of_lagrange_dual_iterations =
+            checkpoint.number_of_lagrange_dual_iterations;
+        number_of_local_search_iterations =
+            checkpoint.number_of_local_search_iterations;
+        number_of_tabu_search_iterations =
+            checkpoint.number_of_tabu_search_iterations;
+        number_of_tabu_search_loops = checkpoint.number_of_tabu_search_loops;
+
+        elapsed_time_offset = checkpoint.elapsed_time;
+
+        utility::print_message(
+            "The search was resumed from the checkpoint (" +
+                utility::to_string(iteration, "%d") + " loops finished).",
+            master_option.verbose >= Verbose::Outer);
+    }
+
+    /**
+     * Prepare functions to export the current state to a checkpoint and to
+     * write it to the file.
+     */
+    auto export_checkpoint = [&](Checkpoint_T* a_checkpoint_ptr,
+                                 const double  a_ELAPSED_TIME) {
+        auto& checkpoint = *a_checkpoint_ptr;
+        checkpoint.export_model_state(model);
+        checkpoint.export_memory(memory);
+        checkpoint.export_random_generator(get_rand_mt);
+
+        checkpoint.is_found_feasible_solution =
+            incumbent_holder.is_found_feasible_solution();
+        checkpoint.global_augmented_incumbent_solution =
+            incumbent_holder.global_augmented_incumbent_solution();
+        checkpoint.global_augmented_incumbent_score =
+            incumbent_holder.global_augmented_incumbent_score();
+        checkpoint.feasible_incumbent_solution =
+            incumbent_holder.feasible_incumbent_solution();
+        checkpoint.feasible_incumbent_score =
+            incumbent_holder.feasible_incumbent_score();
+
+        checkpoint.current_solution        = current_solution;
+        checkpoint.current_solution_score  = current_solution_score;
+        checkpoint.previous_solution       = previous_solution;
+        checkpoint.previous_solution_score = previous_solution_score;
+
+        checkpoint.iteration = iteration;
+        checkpoint.no_global_augmented_incumbent_update_count =
+            no_global_augmented_incumbent_update_count;
+        checkpoint.no_update_count = no_update_count;
+        checkpoint.termination_status = static_cast<int>(termination_status);
+        checkpoint.penalty_coefficient_reset_flag =
+            penalty_coefficient_reset_flag;
+        checkpoint.initial_tabu_tenure    = inital_tabu_tenure;
+        checkpoint.pruning_rate_threshold = pruning_rate_threshold;
+        checkpoint.number_of_initial_modification =
+            number_of_initial_modification;
+        checkpoint.iteration_max = iteration_max;
+        checkpoint.improvability_screening_mode =
+            static_cast<int>(improvability_screening_mode);
+
+        checkpoint.number_of_lagrange_dual_iterations =
+            number_of_lagrange_dual_iterations;
+        checkpoint.number_of_local_search_iterations =
+            number_of_local_search_iterations;
+        checkpoint.number_of_tabu_search_iterations =
+            number_of_tabu_search_iterations;
+        checkpoint.number_of_tabu_search_loops = number_of_tabu_search_loops;
+
+        checkpoint.elapsed_time = a_ELAPSED_TIME;
+    };
+
+    auto write_checkpoint = [&](const double a_ELAPSED_TIME) {
+        Checkpoint_T checkpoint;
+        export_checkpoint(&checkpoint, a_ELAPSED_TIME);
+
+        if (!checkpoint.write(master_option.checkpoint_file_name)) {
+            utility::print_warning(
+                "The checkpoint could not be written to " +
+                    master_option.checkpoint_file_name + ".",
+                master_option.verbose >= Verbose::Warning);
+        }
+    };
+
     while (!is_terminated) {
         utility::print_single_line(master_option.verbose == Verbose::Outer);
         /**
          *  Check the terminating condition.
          */
-        double elapsed_time = time_keeper.clock();
+        double elapsed_time = time_keeper.clock() + elapsed_time_offset;
         if (elapsed_time > master_option.time_max) {
             utility::print_message(
                 "Outer loop was terminated because of time-over (" +
@@ -589,6 +868,15 @@ Result<T_Variable, T_Expression> solve(
                 "found.",
                 master_option.verbose >= Verbose::Outer);
             is_terminated = true;
+        } else if (utility::TerminationSignalHandler::is_received()) {
+            utility::print_message(
+                "Outer loop was terminated because of the termination "
+                "signal.",
+                master_option.verbose >= Verbose::Outer);
+            if (master_option.is_enabled_checkpoint) {
+                write_checkpoint(elapsed_time);
+            }
+            is_terminated = true;
         }
 
         if (is_terminated) {
@@ -616,18 +904,18 @@ Result<T_Variable, T_Expression> solve(
         /**
          * Prepare the initial variable values.
          */
-        std::vector<model::ValueProxy<T_Variable>>
-            initial_variable_value_proxies =
-                current_solution.variable_value_proxies;
+        std::vector<T_Variable> initial_variable_values =
+            current_solution.variables;
 
         /**
          * Run the tabu search.
          */
-        auto result = tabu_search::solve(model,                           //
-                                         option,                          //
-                                         initial_variable_value_proxies,  //
-                                         incumbent_holder,                //
-                                         memory);
+        auto result = tabu_search::solve(model,                    //
+                                         option,                   //
+                                         initial_variable_values,  //
+                                         incumbent_holder,         //
+                                         &memory,                  //
+                                         parallel_controller);
 
         /**
          * Update the global augmented incumbent solution if it was improved
@@ -648,9 +936,9 @@ Result<T_Variable, T_Expression> solve(
         }
 
         /**
-         * Update the memory.
+         * Update the parallel controller.
          */
-        memory = result.memory;
+        parallel_controller = result.parallel_controller;
 
         /**
          * Update the termination status.
@@ -918,8 +1206,8 @@ Result<T_Variable, T_Expression> solve(
         /**
          * This flag will be used to control the initial modification.
          */
-        bool is_changed = current_solution.variable_value_proxies !=
-                          previous_solution.variable_value_proxies;
+        bool is_changed =
+            current_solution.variables != previous_solution.variables;
 
         /**
          * Update the historical data.
@@ -948,30 +1236,26 @@ Result<T_Variable, T_Expression> solve(
              */
             double total_penalty           = 0.0;
             double total_squared_violation = 0.0;
-            for (const auto& proxy : result_local_augmented_incumbent_solution
-                                         .violation_value_proxies) {
-                for (const auto& element : proxy.flat_indexed_values()) {
-                    total_penalty += element;
-                    total_squared_violation += element * element;
-                }
+            for (const auto& element :
+                 result_local_augmented_incumbent_solution.violations) {
+                total_penalty += element;
+                total_squared_violation += element * element;
             }
 
             double balance = master_option.penalty_coefficient_updating_balance;
             double gap     = result_global_augmented_incumbent_objective -
                          result_local_augmented_incumbent_objective;
 
-            for (auto&& proxy : model->constraint_proxies()) {
-                const auto& violation_values =
-                    result_local_augmented_incumbent_solution
-                        .violation_value_proxies[proxy.index()]
-                        .flat_indexed_values();
+            const auto& violation_values =
+                result_local_augmented_incumbent_solution.violations;
 
+            for (auto&& proxy : model->constraint_proxies()) {
                 for (auto&& constraint : proxy.flat_indexed_constraints()) {
                     double delta_penalty_constant =
                         std::max(0.0, gap) / total_penalty;
                     double delta_penalty_proportional =
                         std::max(0.0, gap) / total_squared_violation *
-                        violation_values[constraint.flat_index()];
+                        violation_values[constraint.global_index()];
 
                     constraint.local_penalty_coefficient() +=
                         master_option.penalty_coefficient_tightening_rate *
@@ -1019,13 +1303,11 @@ Result<T_Variable, T_Expression> solve(
                 }
             }
 
-            for (auto&& proxy : model->constraint_proxies()) {
-                const auto& violation_values =
-                    current_solution.violation_value_proxies[proxy.index()]
-                        .flat_indexed_values();
+            const auto& violation_values = current_solution.violations;
 
+            for (auto&& proxy : model->constraint_proxies()) {
                 for (auto&& constraint : proxy.flat_indexed_constraints()) {
-                    if (violation_values[constraint.flat_index()] <
+                    if (violation_values[constraint.global_index()] <
                         constant::EPSILON) {
                         constraint.local_penalty_coefficient() *=
                             penalty_coefficient_relaxing_rate;
@@ -1298,13 +1580,14 @@ Result<T_Variable, T_Expression> solve(
         /**
          * Preserve the number of iterations of the previous loop.
          */
+        profiler.merge(result.profiler);
         number_of_tabu_search_iterations += result.number_of_iterations;
         number_of_tabu_search_loops++;
 
         /**
          * Update the elapsed time.
          */
-        elapsed_time = time_keeper.clock();
+        elapsed_time = time_keeper.clock() + elapsed_time_offset;
 
         /**
          * Print the summary.
@@ -1370,21 +1653,22 @@ Result<T_Variable, T_Expression> solve(
                 "constraints:",
                 master_option.verbose >= Verbose::Outer);
 
-            for (const auto& proxy : current_solution.violation_value_proxies) {
-                const auto& values      = proxy.flat_indexed_values();
-                const auto& names       = proxy.flat_indexed_names();
-                const int   VALUES_SIZE = values.size();
-
-                for (auto i = 0; i < VALUES_SIZE; i++) {
-                    if (values[i] > 0) {
-                        number_of_violative_constraints++;
-                        if (number_of_violative_constraints <=
-                            MAX_NUMBER_OF_PRINT_ITEMS) {
-                            utility::print_info(
-                                " -- " + names[i] + " (violation: " +
-                                    std::to_string(values[i]) + ")",
-                                master_option.verbose >= Verbose::Outer);
-                        }
+            const auto& constraint_ptrs =
+                model->constraint_reference().constraint_ptrs;
+
+            const auto& violations      = current_solution.violations;
+            const int   VIOLATIONS_SIZE = violations.size();
+
+            for (auto i = 0; i < VIOLATIONS_SIZE; i++) {
+                if (violations[i] > 0) {
+                    number_of_violative_constraints++;
+                    if (number_of_violative_constraints <=
+                        MAX_NUMBER_OF_PRINT_ITEMS) {
+                        utility::print_info(
+                            " -- " + constraint_ptrs[i]->name() +
+                                " (violation: " +
+                                std::to_string(violations[i]) + ")",
+                            master_option.verbose >= Verbose::Outer);
                     }
                 }
             }
@@ -1537,12 +1821,30 @@ Result<T_Variable, T_Expression> solve(
 
         model->callback();
         iteration++;
+
+        /**
+         * Write the checkpoint for every specified number of loops.
+         */
+        if (master_option.is_enabled_checkpoint &&
+            iteration % std::max(1, master_option.checkpoint_interval) == 0) {
+            write_checkpoint(time_keeper.clock() + elapsed_time_offset);
+        }
     }
 
     /**
-     * Get the finish time.
+     * Get the finish time, and the elapsed wall-clock and CPU times.
      */
     std::string finish_date_time = utility::date_time();
+    time_keeper.clock();
+    time_keeper.cpu_clock();
+
+    /**
+     * Export the last state for the continuation of the search (optional).
+     */
+    if (a_last_checkpoint_ptr != nullptr) {
+        export_checkpoint(a_last_checkpoint_ptr,
+                          time_keeper.elapsed_time() + elapsed_time_offset);
+    }
 
     /**
      * If a feasible solution is found in optimization, the incumbent
@@ -1561,11 +1863,14 @@ Result<T_Variable, T_Expression> solve(
      * All value of the expressions and the constraints are updated forcibly
      * to take into account the cases they are disabled.
      */
-    model->import_variable_values(incumbent.variable_value_proxies);
+    model->import_variable_values(incumbent.variables);
     model->update();
-    incumbent = model->export_solution();
 
-    auto named_solution = model->convert_to_named_solution(incumbent);
+    /**
+     * The incumbent solutions are held as compact ones in the search, and the
+     * named solution is materialized only here.
+     */
+    auto named_solution = model->export_named_solution();
 
     /**
      * Export the final penalty coefficient values.
@@ -1590,7 +1895,7 @@ Result<T_Variable, T_Expression> solve(
     const int   VARIABLE_PROXIES_SIZE = model->variable_proxies().size();
     const auto& variable_names        = model->variable_names();
 
-    const auto& update_counts = memory.update_counts();
+    const auto update_counts = memory.export_update_count_proxies(model);
     for (auto i = 0; i < VARIABLE_PROXIES_SIZE; i++) {
         named_update_counts[variable_names[i]] = update_counts[i];
     }
@@ -1603,9 +1908,13 @@ Result<T_Variable, T_Expression> solve(
     result.status.penalty_coefficients       = named_penalty_coefficients;
     result.status.update_counts              = named_update_counts;
     result.status.is_found_feasible_solution = named_solution.is_feasible();
+    result.status.is_found_lagrangian_bound  = is_found_lagrangian_bound;
+    result.status.lagrangian_bound           = lagrangian_bound;
     result.status.start_date_time            = start_date_time;
     result.status.finish_date_time           = finish_date_time;
-    result.status.elapsed_time               = time_keeper.elapsed_time();
+    result.status.elapsed_time =
+        time_keeper.elapsed_time() + elapsed_time_offset;
+    result.status.elapsed_cpu_time           = time_keeper.elapsed_cpu_time();
     result.status.number_of_lagrange_dual_iterations =
         number_of_lagrange_dual_iterations;
     result.status.number_of_local_search_iterations =
@@ -1613,6 +1922,11 @@ Result<T_Variable, T_Expression> solve(
     result.status.number_of_tabu_search_iterations =
         number_of_tabu_search_iterations;
     result.status.number_of_tabu_search_loops = number_of_tabu_search_loops;
+    result.status.profiler                    = profiler;
+    result.status.neighborhood_update_parallel_mode =
+        parallel_controller.last_mode(ParallelPhase::NeighborhoodUpdate);
+    result.status.evaluation_parallel_mode =
+        parallel_controller.last_mode(ParallelPhase::Evaluation);
     result.solution_archive                   = solution_archive;
 
     return result;
@@ -7,6 +7,8 @@
 #define PRINTEMPS_SOLVER_STATUS_H__
 
 #include "../model/model.h"
+#include "profiler.h"
+#include "parallel_controller.h"
 
 namespace printemps {
 namespace solver {
@@ -19,15 +21,30 @@ struct Status {
 
     bool is_found_feasible_solution;
 
+    /**
+     * The best Lagrangian of the Lagrange dual search, which is a lower bound
+     * of the objective for a minimization problem and an upper bound for a
+     * maximization problem. It is valid only if is_found_lagrangian_bound is
+     * true.
+     */
+    bool   is_found_lagrangian_bound;
+    double lagrangian_bound;
+
     std::string start_date_time;
     std::string finish_date_time;
 
     double elapsed_time;
+    double elapsed_cpu_time;
     int    number_of_lagrange_dual_iterations;
     int    number_of_local_search_iterations;
     int    number_of_tabu_search_iterations;
     int    number_of_tabu_search_loops;
 
+    ParallelMode neighborhood_update_parallel_mode;
+    ParallelMode evaluation_parallel_mode;
+
+    Profiler profiler;
+
     /*************************************************************************/
     Status(void) {
         this->initialize();
@@ -43,13 +60,19 @@ struct Status {
         this->penalty_coefficients.clear();
         this->update_counts.clear();
         this->is_found_feasible_solution = false;
+        this->is_found_lagrangian_bound  = false;
+        this->lagrangian_bound           = 0.0;
         this->start_date_time.clear();
         this->finish_date_time.clear();
         this->elapsed_time                       = 0.0;
+        this->elapsed_cpu_time                   = 0.0;
         this->number_of_local_search_iterations  = 0;
         this->number_of_lagrange_dual_iterations = 0;
         this->number_of_tabu_search_iterations   = 0;
         this->number_of_tabu_search_loops        = 0;
+        this->neighborhood_update_parallel_mode  = ParallelMode::Serial;
+        this->evaluation_parallel_mode           = ParallelMode::Serial;
+        this->profiler.initialize();
     }
 
     /*************************************************************************/
@@ -62,6 +85,29 @@ struct Status {
         model::print_values(this->update_counts, "update_counts");
     }
 
+    /*************************************************************************/
+    inline void write_profile(std::ofstream *a_ofs,
+                              const int      a_INDENT_LEVEL) const {
+        int indent_level = a_INDENT_LEVEL;
+
+        *a_ofs << utility::indent_spaces(indent_level) << "\"profile\" : {"
+               << std::endl;
+        indent_level++;
+        for (auto i = 0; i < ProfilerConstant::NUMBER_OF_PHASES; i++) {
+            const auto PHASE = static_cast<ProfilePhase>(i);
+            *a_ofs << utility::indent_spaces(indent_level) << "\""
+                   << profile_phase_name(PHASE) << "\" : {"
+                   << "\"elapsed_time\" : "
+                   << std::to_string(this->profiler.elapsed_time(PHASE))
+                   << ", \"count\" : "
+                   << std::to_string(this->profiler.count(PHASE)) << "}"
+                   << (i + 1 < ProfilerConstant::NUMBER_OF_PHASES ? "," : "")
+                   << std::endl;
+        }
+        indent_level--;
+        *a_ofs << utility::indent_spaces(indent_level) << "}," << std::endl;
+    }
+
     /*************************************************************************/
     void write_json_by_name(const std::string&         a_FILE_NAME,
                             const model::ModelSummary& a_MODEL_SUMMARY) const {
@@ -103,6 +149,11 @@ struct Status {
             << "\"elapsed_time\" : " + std::to_string(this->elapsed_time) << ","
             << std::endl;
 
+        ofs << utility::indent_spaces(indent_level)
+            << "\"elapsed_cpu_time\" : " +
+                   std::to_string(this->elapsed_cpu_time)
+            << "," << std::endl;
+
         ofs << utility::indent_spaces(indent_level)
             << "\"number_of_lagrange_dual_iterations\" : " +
                    std::to_string(this->number_of_lagrange_dual_iterations)
@@ -123,6 +174,28 @@ struct Status {
                    std::to_string(this->number_of_tabu_search_loops)
             << "," << std::endl;
 
+        ofs << utility::indent_spaces(indent_level)
+            << "\"lagrangian_bound\" : " +
+                   (this->is_found_lagrangian_bound
+                        ? utility::to_string(this->lagrangian_bound, "%.10e")
+                        : "null")
+            << "," << std::endl;
+
+        /// Parallel modes
+        ofs << utility::indent_spaces(indent_level)
+            << "\"neighborhood_update_parallel_mode\" : \"" +
+                   parallel_mode_name(this->neighborhood_update_parallel_mode) +
+                   "\""
+            << "," << std::endl;
+
+        ofs << utility::indent_spaces(indent_level)
+            << "\"evaluation_parallel_mode\" : \"" +
+                   parallel_mode_name(this->evaluation_parallel_mode) + "\""
+            << "," << std::endl;
+
+        /// Profile
+        this->write_profile(&ofs, indent_level);
+
         /// Penalty coefficients
         model::write_values_by_name(&ofs,                        //
                                     this->penalty_coefficients,  //
@@ -183,6 +256,11 @@ struct Status {
             << "\"elapsed_time\" : " + std::to_string(this->elapsed_time) << ","
             << std::endl;
 
+        ofs << utility::indent_spaces(indent_level)
+            << "\"elapsed_cpu_time\" : " +
+                   std::to_string(this->elapsed_cpu_time)
+            << "," << std::endl;
+
         ofs << utility::indent_spaces(indent_level)
             << "\"number_of_lagrange_dual_iterations\" : " +
                    std::to_string(this->number_of_lagrange_dual_iterations)
@@ -203,6 +281,28 @@ struct Status {
                    std::to_string(this->number_of_tabu_search_loops)
             << "," << std::endl;
 
+        ofs << utility::indent_spaces(indent_level)
+            << "\"lagrangian_bound\" : " +
+                   (this->is_found_lagrangian_bound
+                        ? utility::to_string(this->lagrangian_bound, "%.10e")
+                        : "null")
+            << "," << std::endl;
+
+        /// Parallel modes
+        ofs << utility::indent_spaces(indent_level)
+            << "\"neighborhood_update_parallel_mode\" : \"" +
+                   parallel_mode_name(this->neighborhood_update_parallel_mode) +
+                   "\""
+            << "," << std::endl;
+
+        ofs << utility::indent_spaces(indent_level)
+            << "\"evaluation_parallel_mode\" : \"" +
+                   parallel_mode_name(this->evaluation_parallel_mode) + "\""
+            << "," << std::endl;
+
+        /// Profile
+        this->write_profile(&ofs, indent_level);
+
         /// Penalty coefficients
         model::write_values_by_array(&ofs,                        //
                                      this->penalty_coefficients,  //
@@ -10,7 +10,14 @@
 #include <omp.h>
 #endif
 
+#include <chrono>
+
 #include "../memory.h"
+#include "../parallel_controller.h"
+#include "../profiler.h"
+#include "../trace_writer.h"
+#include "tabu_search_evaluation_scheduler.h"
+#include "tabu_search_move_evaluation_cache.h"
 #include "tabu_search_move_score.h"
 #include "tabu_search_option.h"
 #include "tabu_search_print.h"
@@ -31,11 +38,12 @@ template <class T_Variable, class T_Expression>
 TabuSearchResult<T_Variable, T_Expression> solve(
     model::Model<T_Variable, T_Expression>* a_model,   //
     const Option&                           a_OPTION,  //
-    const std::vector<model::ValueProxy<T_Variable>>&  //
-        a_INITIAL_VARIABLE_VALUE_PROXIES,              //
+    const std::vector<T_Variable>&                     //
+        a_INITIAL_VARIABLE_VALUES,                     //
     const IncumbentHolder<T_Variable, T_Expression>&   //
-                 a_INCUMBENT_HOLDER,                   //
-    const Memory a_MEMORY) {
+            a_INCUMBENT_HOLDER,                        //
+    Memory* a_memory,                                  //
+    const ParallelController& a_PARALLEL_CONTROLLER) {
     /**
      * Define type aliases.
      */
@@ -55,7 +63,13 @@ TabuSearchResult<T_Variable, T_Expression> solve(
      */
     Model_T* model  = a_model;
     Option   option = a_OPTION;
-    Memory   memory = a_MEMORY;
+
+    /**
+     * The memory is shared with the caller and updated in place.
+     */
+    Memory& memory = *a_memory;
+
+    ParallelController parallel_controller = a_PARALLEL_CONTROLLER;
 
     IncumbentHolder_T incumbent_holder = a_INCUMBENT_HOLDER;
 
@@ -72,7 +86,7 @@ TabuSearchResult<T_Variable, T_Expression> solve(
     /**
      * Initialize the solution and update the model.
      */
-    model->import_variable_values(a_INITIAL_VARIABLE_VALUE_PROXIES);
+    model->import_variable_values(a_INITIAL_VARIABLE_VALUES);
     model->update();
 
     model::SolutionScore current_solution_score = model->evaluate({});
@@ -113,6 +127,61 @@ TabuSearchResult<T_Variable, T_Expression> solve(
     model->reset_variable_objective_improvability();
     model->reset_variable_feasibility_improvability();
 
+    /**
+     * Prepare the cache of move evaluations (optional). The cache is available
+     * only for linear models with fast evaluation, where the differences of
+     * the solution scores by a move are independent of the variables which
+     * do not share constraints with the move.
+     */
+    const bool IS_ENABLED_MOVE_EVALUATION_CACHE =
+        option.tabu_search.is_enabled_move_evaluation_cache &&
+        model->is_linear() && model->is_enabled_fast_evaluation();
+
+    MoveEvaluationCache<T_Variable, T_Expression> move_evaluation_cache;
+    if (IS_ENABLED_MOVE_EVALUATION_CACHE) {
+        move_evaluation_cache.setup(model->number_of_variables(),         //
+                                    model->neighborhood().binary_moves(),   //
+                                    model->neighborhood().integer_moves(),  //
+                                    model->neighborhood().selection_moves());
+    }
+
+    /**
+     * Check whether the moves flipping one binary variable can be evaluated by
+     * the specialized kernel over the constraint matrix (optional). The
+     * evaluator copies the constraints only here, since the penalty
+     * coefficients are fixed during the tabu search, and then it is kept up
+     * to date by model->update() for the constraints changed by each move.
+     */
+    const bool IS_ENABLED_BINARY_FLIP_EVALUATION =
+        option.tabu_search.is_enabled_binary_flip_evaluation &&
+        model->is_enabled_fast_evaluation() &&
+        model->is_enabled_binary_flip_evaluation();
+
+    if (IS_ENABLED_BINARY_FLIP_EVALUATION) {
+        model->setup_binary_flip_evaluation();
+    }
+
+    /**
+     * Prepare the scheduler which distributes the moves to the threads in
+     * chunks of nearly equal estimated cost.
+     */
+    EvaluationScheduler<T_Variable, T_Expression> evaluation_scheduler;
+#ifdef _OPENMP
+    if (option.is_enabled_parallel_evaluation) {
+        evaluation_scheduler.setup(omp_get_max_threads());
+    }
+#endif
+
+    /**
+     * Prepare the profiler of the phases and the trace writer (optional).
+     */
+    Profiler profiler;
+    profiler.setup(option.is_enabled_profile ||
+                   option.trace_mode != TraceMode::None);
+
+    TraceWriter trace_writer;
+    trace_writer.open(option.trace_file_name, option.trace_mode);
+
     /**
      * Prepare other local variables.
      */
@@ -120,13 +189,6 @@ TabuSearchResult<T_Variable, T_Expression> solve(
     std::vector<model::SolutionScore> trial_solution_scores;
     std::vector<MoveScore>            trial_move_scores;
 
-    std::vector<double> objective_improvements;
-    std::vector<double> local_penalties;
-
-    std::vector<double> local_augmented_objectives;
-    std::vector<double> global_augmented_objectives;
-    std::vector<double> total_scores;
-
     int last_local_augmented_incumbent_update_iteration  = -1;
     int last_global_augmented_incumbent_update_iteration = -1;
     int last_feasible_incumbent_update_iteration         = -1;
@@ -187,6 +249,11 @@ TabuSearchResult<T_Variable, T_Expression> solve(
             break;
         }
 
+        if (utility::TerminationSignalHandler::is_received()) {
+            termination_status = TabuSearchTerminationStatus::INTERRUPTED;
+            break;
+        }
+
         if (incumbent_holder.feasible_incumbent_objective() <=
             option.target_objective_value) {
             termination_status = TabuSearchTerminationStatus::REACH_TARGET;
@@ -200,9 +267,12 @@ TabuSearchResult<T_Variable, T_Expression> solve(
             break;
         }
 
+        profiler.start_iteration();
+
         /**
          * Update the moves.
          */
+        profiler.start();
         bool is_enabled_improvability_screening =
             (option.improvability_screening_mode !=
              ImprovabilityScreeningMode::Off);
@@ -290,14 +360,50 @@ TabuSearchResult<T_Variable, T_Expression> solve(
                 }
             }
         }
+        profiler.stop(ProfilePhase::ImprovabilityUpdate);
+
+        /**
+         * Whether the moves are updated in parallel is decided by the
+         * parallel controller for the number of the enabled moves. During the
+         * calibration, the elapsed wall-clock time is measured and recorded;
+         * the clock is not read otherwise.
+         */
+        profiler.start();
+        const int NUMBER_OF_ENABLED_MOVES =
+            model->neighborhood().number_of_enabled_moves();
+        const bool IS_CALIBRATING_NEIGHBORHOOD_UPDATE =
+            parallel_controller.is_calibrating(
+                ParallelPhase::NeighborhoodUpdate, NUMBER_OF_ENABLED_MOVES);
+        const bool IS_PARALLEL_NEIGHBORHOOD_UPDATE =
+            parallel_controller.is_parallel(ParallelPhase::NeighborhoodUpdate,
+                                            NUMBER_OF_ENABLED_MOVES);
+
+        std::chrono::steady_clock::time_point neighborhood_update_start;
+        if (IS_CALIBRATING_NEIGHBORHOOD_UPDATE) {
+            neighborhood_update_start = std::chrono::steady_clock::now();
+        }
+
         model->neighborhood().update_moves(
             accept_all,                     //
             accept_objective_improvable,    //
             accept_feasibility_improvable,  //
-            option.is_enabled_parallel_neighborhood_update);
+            IS_PARALLEL_NEIGHBORHOOD_UPDATE);
+
+        if (IS_CALIBRATING_NEIGHBORHOOD_UPDATE) {
+            parallel_controller.record(
+                ParallelPhase::NeighborhoodUpdate,  //
+                NUMBER_OF_ENABLED_MOVES,            //
+                IS_PARALLEL_NEIGHBORHOOD_UPDATE,    //
+                std::chrono::duration<double>(std::chrono::steady_clock::now() -
+                                              neighborhood_update_start)
+                    .count());
+        }
+        profiler.stop(ProfilePhase::MoveUpdate);
 
         if (option.tabu_search.is_enabled_shuffle) {
+            profiler.start();
             model->neighborhood().shuffle_moves(&get_rand_mt);
+            profiler.stop(ProfilePhase::Shuffle);
         }
 
         const auto& trial_move_ptrs = model->neighborhood().move_ptrs();
@@ -340,83 +446,149 @@ TabuSearchResult<T_Variable, T_Expression> solve(
          * required for each iteration because the number of the moves can be
          * changed.
          */
+        profiler.start();
         trial_solution_scores.resize(number_of_moves);
         trial_move_scores.resize(number_of_moves);
 
-        objective_improvements.resize(number_of_moves);
-        local_penalties.resize(number_of_moves);
+        if (IS_ENABLED_MOVE_EVALUATION_CACHE) {
+            move_evaluation_cache.prepare(trial_move_ptrs, number_of_moves);
+        }
+
+        /**
+         * The moves will be evaluated in serial if the number of the moves is
+         * less than the threshold, since entering a parallel region costs
+         * more than evaluating a small neighborhood. Otherwise, the mode is
+         * decided by the parallel controller.
+         */
+        const bool IS_CALIBRATING_EVALUATION =
+            parallel_controller.is_calibrating(ParallelPhase::Evaluation,
+                                               number_of_moves);
+        const bool IS_PARALLEL_EVALUATION = parallel_controller.is_parallel(
+            ParallelPhase::Evaluation, number_of_moves);
+
+        evaluation_scheduler.prepare(trial_move_ptrs,  //
+                                     number_of_moves,  //
+                                     IS_PARALLEL_EVALUATION);
 
-        local_augmented_objectives.resize(number_of_moves);
-        global_augmented_objectives.resize(number_of_moves);
-        total_scores.resize(number_of_moves);
+        const int   NUMBER_OF_CHUNKS = evaluation_scheduler.number_of_chunks();
+        const auto& chunk_begins     = evaluation_scheduler.chunk_begins();
+
+        /**
+         * The argmins and the statistics of the moves required after the
+         * loop are reduced over the threads in the loop, instead of being
+         * computed by serial scans over the per-move arrays.
+         */
+        EvaluationSummary evaluation_summary;
+
+        std::chrono::steady_clock::time_point evaluation_start;
+        if (IS_CALIBRATING_EVALUATION) {
+            evaluation_start = std::chrono::steady_clock::now();
+        }
 
 #ifdef _OPENMP
-#pragma omp parallel for if (option.is_enabled_parallel_evaluation) \
-    schedule(static)
+#pragma omp parallel for if (IS_PARALLEL_EVALUATION) schedule(dynamic, 1) \
+    reduction(merge_evaluation_summary : evaluation_summary)
 #endif
-        for (auto i = 0; i < number_of_moves; i++) {
-            /**
-             * The neighborhood solutions will be evaluated in parallel by fast
-             * or ordinary(slow) evaluation methods.
-             */
+        for (auto chunk = 0; chunk < NUMBER_OF_CHUNKS; chunk++) {
+            for (auto i = chunk_begins[chunk]; i < chunk_begins[chunk + 1];
+                 i++) {
+                /**
+                 * The neighborhood solutions will be evaluated in parallel by
+                 * fast or ordinary(slow) evaluation methods. If the move
+                 * evaluation cache is enabled, the cached score will be
+                 * restored for a move unaffected by the moves after its last
+                 * evaluation. The moves flipping one binary variable are
+                 * evaluated by the specialized kernel if it is enabled.
+                 */
+                const bool IS_RESTORED =
+                    IS_ENABLED_MOVE_EVALUATION_CACHE &&
+                    move_evaluation_cache.restore(&trial_solution_scores[i],  //
+                                                  i,                          //
+                                                  *trial_move_ptrs[i],        //
+                                                  current_solution_score);
+                if (!IS_RESTORED) {
+                    if (IS_ENABLED_BINARY_FLIP_EVALUATION &&
+                        model::BinaryFlipEvaluator<T_Variable, T_Expression>::
+                            is_applicable(*trial_move_ptrs[i])) {
+                        model->evaluate_binary_flip(
+                            &trial_solution_scores[i],  //
+                            *trial_move_ptrs[i],        //
+                            current_solution_score);
+                    } else {
 #ifndef _MPS_SOLVER
-            if (model->is_enabled_fast_evaluation()) {
+                        if (model->is_enabled_fast_evaluation()) {
 #endif
-                model->evaluate(&trial_solution_scores[i],  //
-                                *trial_move_ptrs[i],        //
-                                current_solution_score);
+                            model->evaluate(&trial_solution_scores[i],  //
+                                            *trial_move_ptrs[i],        //
+                                            current_solution_score);
 #ifndef _MPS_SOLVER
-            } else {
-                model->evaluate(&trial_solution_scores[i],  //
-                                *trial_move_ptrs[i]);
-            }
+                        } else {
+                            model->evaluate(&trial_solution_scores[i],  //
+                                            *trial_move_ptrs[i]);
+                        }
 #endif
-            evaluate_move(&trial_move_scores[i], *trial_move_ptrs[i],  //
-                          iteration,                                   //
-                          memory,                                      //
-                          option,                                      //
-                          tabu_tenure);
-
-            objective_improvements[i] =
-                trial_solution_scores[i].objective_improvement;
-
-            local_penalties[i] = trial_solution_scores[i].local_penalty;
+                    }
+                    if (IS_ENABLED_MOVE_EVALUATION_CACHE) {
+                        move_evaluation_cache.store(
+                            i,                         //
+                            trial_solution_scores[i],  //
+                            current_solution_score,    //
+                            iteration);
+                    }
+                }
+                evaluate_move(&trial_move_scores[i], *trial_move_ptrs[i],  //
+                              iteration,                                   //
+                              memory,                                      //
+                              option,                                      //
+                              tabu_tenure);
 
-            local_augmented_objectives[i] =
-                trial_solution_scores[i].local_augmented_objective;
-            global_augmented_objectives[i] =
-                trial_solution_scores[i].global_augmented_objective;
+                double total_score =
+                    trial_solution_scores[i].local_augmented_objective +
+                    trial_move_scores[i].frequency_penalty;
 
-            total_scores[i] =
-                trial_solution_scores[i].local_augmented_objective +
-                trial_move_scores[i].frequency_penalty;
+                /**
+                 * If the move is "tabu", it will be set lower priorities in
+                 * selecting a move for the next solution.
+                 */
+                if (!trial_move_scores[i].is_permissible) {
+                    total_score += constant::LARGE_VALUE_50;
+                }
 
-            /**
-             * If the move is "tabu", it will be set lower priorities in
-             * selecting a move for the next solution.
-             */
-            if (!trial_move_scores[i].is_permissible) {
-                total_scores[i] += constant::LARGE_VALUE_50;
+                /**
+                 * If the move is special neighborhood moves, it must improves
+                 * objective or feasibility.
+                 */
+                if (trial_move_ptrs[i]->is_special_neighborhood_move &&
+                    !(trial_solution_scores[i].is_objective_improvable ||
+                      trial_solution_scores[i].is_feasibility_improvable)) {
+                    total_score += constant::LARGE_VALUE_100;
+                }
+                evaluation_summary.update(i,                         //
+                                          trial_solution_scores[i],  //
+                                          trial_move_scores[i].is_permissible,
+                                          total_score);
             }
+        }
 
-            /**
-             * If the move is special neighborhood moves, it must improves
-             * objective or feasibility.
-             */
-            if (trial_move_ptrs[i]->is_special_neighborhood_move &&
-                !(trial_solution_scores[i].is_objective_improvable ||
-                  trial_solution_scores[i].is_feasibility_improvable)) {
-                total_scores[i] += constant::LARGE_VALUE_100;
-            }
+        if (IS_CALIBRATING_EVALUATION) {
+            parallel_controller.record(
+                ParallelPhase::Evaluation,  //
+                number_of_moves,            //
+                IS_PARALLEL_EVALUATION,     //
+                std::chrono::duration<double>(std::chrono::steady_clock::now() -
+                                              evaluation_start)
+                    .count());
         }
+        profiler.stop(ProfilePhase::Evaluation);
 
         /**
          * Select moves for the next solution.
          */
+        profiler.start();
         int argmin_global_augmented_objective =
-            utility::argmin(global_augmented_objectives);
+            evaluation_summary.argmin_global_augmented_objective;
 
-        int  argmin_total_score = utility::argmin(total_scores);
+        int  argmin_total_score = evaluation_summary.argmin_total_score;
         int  selected_index     = 0;
         bool is_aspirated       = false;
 
@@ -449,6 +621,8 @@ TabuSearchResult<T_Variable, T_Expression> solve(
                 }
             }
         }
+        profiler.stop(ProfilePhase::Selection);
+
         /**
          * Backup the previous solution score and move.
          */
@@ -459,8 +633,15 @@ TabuSearchResult<T_Variable, T_Expression> solve(
          * Update the model by the selected move.
          */
         Move_T* move_ptr = trial_move_ptrs[selected_index];
+
+        profiler.start();
         model->update(*move_ptr);
 
+        if (IS_ENABLED_MOVE_EVALUATION_CACHE) {
+            move_evaluation_cache.invalidate(*move_ptr, iteration);
+        }
+        profiler.stop(ProfilePhase::ModelUpdate);
+
         /**
          * Update the current solution score and move.
          */
@@ -479,6 +660,7 @@ TabuSearchResult<T_Variable, T_Expression> solve(
         /**
          * Update the status.
          */
+        profiler.start();
         update_status = incumbent_holder.try_update_incumbent(
             model, current_solution_score);
         total_update_status = update_status | total_update_status;
@@ -495,16 +677,19 @@ TabuSearchResult<T_Variable, T_Expression> solve(
             historical_feasible_solutions.push_back(
                 model->export_plain_solution());
         }
+        profiler.stop(ProfilePhase::IncumbentUpdate);
 
         /**
          * Update the memory.
          */
+        profiler.start();
         int random_width = static_cast<int>(
             option.tabu_search.tabu_tenure_randomize_rate * tabu_tenure);
         memory.update(*move_ptr,     //
                       iteration,     //
                       random_width,  //
                       &get_rand_mt);
+        profiler.stop(ProfilePhase::MemoryUpdate);
 
         /**
          * To avoid cycling, each special neighborhood can be used only once in
@@ -548,29 +733,15 @@ TabuSearchResult<T_Variable, T_Expression> solve(
         /**
          * Calculate the number of moves for each type.
          */
-        int number_of_all_neighborhoods         = number_of_moves;
-        int number_of_feasible_neighborhoods    = 0;
-        int number_of_infeasible_neighborhood   = 0;
-        int number_of_permissible_neighborhoods = 0;
-        int number_of_improvable_neighborhoods  = 0;
-
-        for (const auto& score : trial_solution_scores) {
-            if (score.is_feasible) {
-                number_of_feasible_neighborhoods++;
-            }
-            if (score.is_objective_improvable ||
-                score.is_feasibility_improvable) {
-                number_of_improvable_neighborhoods++;
-            }
-        }
-
-        for (const auto& score : trial_move_scores) {
-            if (score.is_permissible) {
-                number_of_permissible_neighborhoods++;
-            }
-        }
-        number_of_infeasible_neighborhood =
+        int number_of_all_neighborhoods = number_of_moves;
+        int number_of_feasible_neighborhoods =
+            evaluation_summary.number_of_feasible_moves;
+        int number_of_infeasible_neighborhood =
             number_of_all_neighborhoods - number_of_feasible_neighborhoods;
+        int number_of_permissible_neighborhoods =
+            evaluation_summary.number_of_permissible_moves;
+        int number_of_improvable_neighborhoods =
+            evaluation_summary.number_of_improvable_moves;
 
         if (number_of_permissible_neighborhoods == 0) {
             is_few_permissible_neighborhood = true;
@@ -580,6 +751,7 @@ TabuSearchResult<T_Variable, T_Expression> solve(
          * Register a chain move.
          */
         if (iteration > 0 && option.is_enabled_chain_move) {
+            profiler.start();
             if ((previous_move.sense == model::MoveSense::Binary &&
                  current_move.sense == model::MoveSense::Binary &&
                  previous_move.alterations.front().second !=
@@ -605,6 +777,7 @@ TabuSearchResult<T_Variable, T_Expression> solve(
                     model->neighborhood().register_chain_move(back_chain_move);
                 }
             }
+            profiler.stop(ProfilePhase::ChainMoveRegistration);
         }
 
         if (option.tabu_search.is_enabled_automatic_tabu_tenure_adjustment) {
@@ -688,6 +861,19 @@ TabuSearchResult<T_Variable, T_Expression> solve(
                              option.verbose >= Verbose::Full);
         }
 
+        /**
+         * Write the trace of the iteration (optional).
+         */
+        if (trace_writer.is_enabled()) {
+            trace_writer.write(
+                "tabu_search",                                  //
+                iteration,                                      //
+                elapsed_time + option.tabu_search.time_offset,  //
+                current_solution_score,                         //
+                number_of_moves,                                //
+                profiler);
+        }
+
         if (option.tabu_search.is_enabled_automatic_break) {
             /**
              * If the local penalty us sufficiently larger than objective
@@ -700,20 +886,10 @@ TabuSearchResult<T_Variable, T_Expression> solve(
             if (iteration > ITERATION_MIN              //
                 && current_solution_score.is_feasible  //
                 && number_of_infeasible_neighborhood > 0) {
-                std::vector<double> infeasible_local_penalties(
-                    number_of_infeasible_neighborhood);
-                int count = 0;
-                for (auto i = 0; i < number_of_all_neighborhoods; i++) {
-                    if (!trial_solution_scores[i].is_feasible) {
-                        infeasible_local_penalties[count++] =
-                            local_penalties[i];
-                    }
-                }
-
                 double max_objective_sensitivity =
-                    utility::max_abs(objective_improvements);
+                    evaluation_summary.max_abs_objective_improvement;
                 if (max_objective_sensitivity * MARGIN <
-                    utility::min(infeasible_local_penalties)) {
+                    evaluation_summary.min_infeasible_local_penalty) {
                     termination_status =
                         TabuSearchTerminationStatus::EARLY_STOP;
                     break;
@@ -729,12 +905,17 @@ TabuSearchResult<T_Variable, T_Expression> solve(
      */
     print_table_footer(option.verbose >= Verbose::Full);
 
+    /**
+     * Fill the violations of the incumbent solutions, which are stored
+     * without them in the iterations.
+     */
+    incumbent_holder.fill_violations(model);
+
     /**
      * Prepare the result.
      */
     Result_T result;
     result.incumbent_holder     = incumbent_holder;
-    result.memory               = memory;
     result.total_update_status  = total_update_status;
     result.tabu_tenure          = tabu_tenure;
     result.number_of_iterations = iteration;
@@ -758,6 +939,8 @@ TabuSearchResult<T_Variable, T_Expression> solve(
 
     result.termination_status            = termination_status;
     result.historical_feasible_solutions = historical_feasible_solutions;
+    result.profiler                      = profiler;
+    result.parallel_controller           = parallel_controller;
 
     return result;
 }
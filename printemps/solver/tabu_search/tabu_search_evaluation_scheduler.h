@@ -0,0 +1,275 @@
+/*****************************************************************************/
+// Copyright (c) 2020 Yuji KOGUMA
+// Released under the MIT license
+// https://opensource.org/licenses/mit-license.php
+/*****************************************************************************/
+#ifndef PRINTEMPS_SOLVER_TABU_SEARCH_TABU_SEARCH_EVALUATION_SCHEDULER_H__
+#define PRINTEMPS_SOLVER_TABU_SEARCH_TABU_SEARCH_EVALUATION_SCHEDULER_H__
+
+#include <vector>
+#include <limits>
+#include <cmath>
+#include <algorithm>
+
+namespace printemps {
+namespace solver {
+namespace tabu_search {
+/*****************************************************************************/
+struct EvaluationSchedulerConstant {
+    static constexpr int DEFAULT_NUMBER_OF_CHUNKS_PER_THREAD = 8;
+};
+
+/*****************************************************************************/
+struct EvaluationSummary {
+    /**
+     * EvaluationSummary keeps the statistics of the evaluated moves which are
+     * required after the evaluation loop: the indices of the moves with the
+     * minimum total score and the minimum global augmented objective, the
+     * numbers of the feasible, permissible, and improvable moves, the maximum
+     * absolute objective improvement, and the minimum local penalty of the
+     * infeasible moves. It is updated by each thread for the moves it
+     * evaluates, and the results of the threads are merged. Ties of the
+     * argmins are broken by the smaller index so that the result is the same
+     * as that of utility::argmin() regardless of the thread schedule.
+     */
+    double min_total_score;
+    int    argmin_total_score;
+    double min_global_augmented_objective;
+    int    argmin_global_augmented_objective;
+
+    int number_of_feasible_moves;
+    int number_of_permissible_moves;
+    int number_of_improvable_moves;
+
+    double max_abs_objective_improvement;
+    double min_infeasible_local_penalty;
+
+    /*************************************************************************/
+    EvaluationSummary(void) {
+        this->initialize();
+    }
+
+    /*************************************************************************/
+    virtual ~EvaluationSummary(void) {
+        /// nothing to do
+    }
+
+    /*************************************************************************/
+    inline void initialize(void) {
+        this->min_total_score    = std::numeric_limits<double>::max();
+        this->argmin_total_score = std::numeric_limits<int>::max();
+        this->min_global_augmented_objective =
+            std::numeric_limits<double>::max();
+        this->argmin_global_augmented_objective =
+            std::numeric_limits<int>::max();
+
+        this->number_of_feasible_moves    = 0;
+        this->number_of_permissible_moves = 0;
+        this->number_of_improvable_moves  = 0;
+
+        this->max_abs_objective_improvement = 0.0;
+        this->min_infeasible_local_penalty =
+            std::numeric_limits<double>::max();
+    }
+
+    /*************************************************************************/
+    inline void update_argmin(
+        const int    a_INDEX,        //
+        const double a_TOTAL_SCORE,  //
+        const double a_GLOBAL_AUGMENTED_OBJECTIVE) noexcept {
+        if (a_TOTAL_SCORE < this->min_total_score ||
+            (a_TOTAL_SCORE == this->min_total_score &&
+             a_INDEX < this->argmin_total_score)) {
+            this->min_total_score    = a_TOTAL_SCORE;
+            this->argmin_total_score = a_INDEX;
+        }
+        if (a_GLOBAL_AUGMENTED_OBJECTIVE <
+                this->min_global_augmented_objective ||
+            (a_GLOBAL_AUGMENTED_OBJECTIVE ==
+                 this->min_global_augmented_objective &&
+             a_INDEX < this->argmin_global_augmented_objective)) {
+            this->min_global_augmented_objective =
+                a_GLOBAL_AUGMENTED_OBJECTIVE;
+            this->argmin_global_augmented_objective = a_INDEX;
+        }
+    }
+
+    /*************************************************************************/
+    inline void update(const int                   a_INDEX,           //
+                       const model::SolutionScore &a_SOLUTION_SCORE,  //
+                       const bool                  a_IS_PERMISSIBLE,  //
+                       const double                a_TOTAL_SCORE) noexcept {
+        this->update_argmin(a_INDEX, a_TOTAL_SCORE,
+                            a_SOLUTION_SCORE.global_augmented_objective);
+
+        if (a_SOLUTION_SCORE.is_feasible) {
+            this->number_of_feasible_moves++;
+        } else {
+            this->min_infeasible_local_penalty =
+                std::min(this->min_infeasible_local_penalty,
+                         a_SOLUTION_SCORE.local_penalty);
+        }
+        if (a_IS_PERMISSIBLE) {
+            this->number_of_permissible_moves++;
+        }
+        if (a_SOLUTION_SCORE.is_objective_improvable ||
+            a_SOLUTION_SCORE.is_feasibility_improvable) {
+            this->number_of_improvable_moves++;
+        }
+        this->max_abs_objective_improvement =
+            std::max(this->max_abs_objective_improvement,
+                     std::fabs(a_SOLUTION_SCORE.objective_improvement));
+    }
+
+    /*************************************************************************/
+    inline void merge(const EvaluationSummary &a_OTHER) noexcept {
+        if (a_OTHER.min_total_score < this->min_total_score ||
+            (a_OTHER.min_total_score == this->min_total_score &&
+             a_OTHER.argmin_total_score < this->argmin_total_score)) {
+            this->min_total_score    = a_OTHER.min_total_score;
+            this->argmin_total_score = a_OTHER.argmin_total_score;
+        }
+        if (a_OTHER.min_global_augmented_objective <
+                this->min_global_augmented_objective ||
+            (a_OTHER.min_global_augmented_objective ==
+                 this->min_global_augmented_objective &&
+             a_OTHER.argmin_global_augmented_objective <
+                 this->argmin_global_augmented_objective)) {
+            this->min_global_augmented_objective =
+                a_OTHER.min_global_augmented_objective;
+            this->argmin_global_augmented_objective =
+                a_OTHER.argmin_global_augmented_objective;
+        }
+
+        this->number_of_feasible_moves += a_OTHER.number_of_feasible_moves;
+        this->number_of_permissible_moves +=
+            a_OTHER.number_of_permissible_moves;
+        this->number_of_improvable_moves += a_OTHER.number_of_improvable_moves;
+
+        this->max_abs_objective_improvement =
+            std::max(this->max_abs_objective_improvement,
+                     a_OTHER.max_abs_objective_improvement);
+        this->min_infeasible_local_penalty =
+            std::min(this->min_infeasible_local_penalty,
+                     a_OTHER.min_infeasible_local_penalty);
+    }
+};
+
+/*****************************************************************************/
+#ifdef _OPENMP
+#pragma omp declare reduction(merge_evaluation_summary : EvaluationSummary : \
+                              omp_out.merge(omp_in))                          \
+    initializer(omp_priv = EvaluationSummary())
+#endif
+
+/*****************************************************************************/
+template <class T_Variable, class T_Expression>
+class EvaluationScheduler {
+    /**
+     * EvaluationScheduler partitions the moves to be evaluated into chunks of
+     * nearly equal estimated cost, where the cost of a move is estimated by
+     * the number of its related constraints. The chunks are distributed to the
+     * threads dynamically, so that a thread which has finished cheap moves
+     * takes over the remaining chunks instead of waiting for the others. If
+     * only one thread is available, all moves are put into one chunk. The
+     * summaries of the moves evaluated by each thread are merged by the
+     * reduction merge_evaluation_summary.
+     */
+   private:
+    int              m_number_of_chunks_max;
+    std::vector<int> m_chunk_begins;
+
+   public:
+    /*************************************************************************/
+    EvaluationScheduler(void) {
+        this->initialize();
+    }
+
+    /*************************************************************************/
+    virtual ~EvaluationScheduler(void) {
+        /// nothing to do
+    }
+
+    /*************************************************************************/
+    inline void initialize(void) {
+        m_number_of_chunks_max = 1;
+        m_chunk_begins.clear();
+    }
+
+    /*************************************************************************/
+    inline void setup(const int a_NUMBER_OF_THREADS) {
+        this->initialize();
+        if (a_NUMBER_OF_THREADS > 1) {
+            m_number_of_chunks_max =
+                a_NUMBER_OF_THREADS * EvaluationSchedulerConstant::
+                                          DEFAULT_NUMBER_OF_CHUNKS_PER_THREAD;
+        }
+    }
+
+    /*************************************************************************/
+    inline void prepare(
+        const std::vector<model::Move<T_Variable, T_Expression> *>
+            &      a_MOVE_PTRS,        //
+        const int  a_NUMBER_OF_MOVES,  //
+        const bool a_IS_ENABLED_PARALLEL) {
+        /**
+         * This method computes the chunk boundaries for the moves to be
+         * evaluated in the current iteration. The constant 1 is added to the
+         * cost of each move to account for the overhead independent of the
+         * constraints. If the moves are evaluated in serial, all moves are
+         * put into one chunk.
+         */
+        m_chunk_begins.clear();
+        m_chunk_begins.push_back(0);
+
+        if (!a_IS_ENABLED_PARALLEL || m_number_of_chunks_max == 1 ||
+            a_NUMBER_OF_MOVES <= 1) {
+            m_chunk_begins.push_back(a_NUMBER_OF_MOVES);
+            return;
+        }
+
+        long total_cost = 0;
+        for (auto i = 0; i < a_NUMBER_OF_MOVES; i++) {
+            total_cost += a_MOVE_PTRS[i]->related_constraint_ptrs.size() + 1;
+        }
+
+        const double CHUNK_COST =
+            static_cast<double>(total_cost) / m_number_of_chunks_max;
+
+        long   cost      = 0;
+        double threshold = CHUNK_COST;
+        for (auto i = 0; i < a_NUMBER_OF_MOVES - 1; i++) {
+            cost += a_MOVE_PTRS[i]->related_constraint_ptrs.size() + 1;
+            if (cost >= threshold) {
+                m_chunk_begins.push_back(i + 1);
+                while (threshold <= cost) {
+                    threshold += CHUNK_COST;
+                }
+            }
+        }
+        m_chunk_begins.push_back(a_NUMBER_OF_MOVES);
+    }
+
+    /*************************************************************************/
+    inline constexpr int number_of_chunks_max(void) const noexcept {
+        return m_number_of_chunks_max;
+    }
+
+    /*************************************************************************/
+    inline constexpr int number_of_chunks(void) const noexcept {
+        return static_cast<int>(m_chunk_begins.size()) - 1;
+    }
+
+    /*************************************************************************/
+    inline constexpr const std::vector<int> &chunk_begins(void) const noexcept {
+        return m_chunk_begins;
+    }
+};
+}  // namespace tabu_search
+}  // namespace solver
+}  // namespace printemps
+
+#endif
+/*****************************************************************************/
+// END
+/*****************************************************************************/
@@ -0,0 +1,264 @@
+/*****************************************************************************/
+// Copyright (c) 2020 Yuji KOGUMA
+// Released under the MIT license
+// https://opensource.org/licenses/mit-license.php
+/*****************************************************************************/
+#ifndef PRINTEMPS_SOLVER_TABU_SEARCH_TABU_SEARCH_MOVE_EVALUATION_CACHE_H__
+#define PRINTEMPS_SOLVER_TABU_SEARCH_TABU_SEARCH_MOVE_EVALUATION_CACHE_H__
+
+#include <functional>
+#include <vector>
+
+namespace printemps {
+namespace solver {
+namespace tabu_search {
+/*****************************************************************************/
+struct MoveEvaluationCacheEntry {
+    int    evaluated_iteration;
+    double objective_difference;
+    double total_violation_difference;
+    double local_penalty_difference;
+    double global_penalty_difference;
+    bool   is_feasibility_improvable;
+};
+
+/*****************************************************************************/
+template <class T_Variable, class T_Expression>
+class MoveEvaluationCache {
+    /**
+     * MoveEvaluationCache keeps the differences of the solution scores
+     * evaluated for the moves in the previous iterations. For a linear model,
+     * the differences by a move are not changed unless the move includes a
+     * variable which shares a constraint with the variables altered in the
+     * following iterations. Therefore, the score of such a move can be
+     * restored from the cached differences and the current solution score
+     * without evaluating the related constraints again.
+     *
+     * Only the moves in the static neighborhoods (binary, integer, and
+     * selection moves) are cached, because the objects of the other moves can
+     * be reconstructed during the search. The objects of the static moves are
+     * never reallocated after the setup of the neighborhood, so that the
+     * entries are kept in a flat vector indexed by the positions of the moves
+     * in the static neighborhood arrays.
+     */
+   private:
+    using Move_T = model::Move<T_Variable, T_Expression>;
+
+    const Move_T *m_binary_moves_begin;
+    const Move_T *m_integer_moves_begin;
+    const Move_T *m_selection_moves_begin;
+    int           m_binary_moves_size;
+    int           m_integer_moves_size;
+    int           m_selection_moves_size;
+
+    std::vector<MoveEvaluationCacheEntry> m_entries;
+    std::vector<int>                      m_last_changed_iterations;
+    std::vector<int>                      m_move_entry_indices;
+
+   public:
+    /*************************************************************************/
+    MoveEvaluationCache(void) {
+        this->initialize();
+    }
+
+    /*************************************************************************/
+    virtual ~MoveEvaluationCache(void) {
+        /// nothing to do
+    }
+
+    /*************************************************************************/
+    inline void initialize(void) {
+        m_binary_moves_begin    = nullptr;
+        m_integer_moves_begin   = nullptr;
+        m_selection_moves_begin = nullptr;
+        m_binary_moves_size     = 0;
+        m_integer_moves_size    = 0;
+        m_selection_moves_size  = 0;
+
+        m_entries.clear();
+        m_last_changed_iterations.clear();
+        m_move_entry_indices.clear();
+    }
+
+    /*************************************************************************/
+    inline void setup(const int                  a_NUMBER_OF_VARIABLES,  //
+                      const std::vector<Move_T> &a_BINARY_MOVES,         //
+                      const std::vector<Move_T> &a_INTEGER_MOVES,        //
+                      const std::vector<Move_T> &a_SELECTION_MOVES) {
+        this->initialize();
+        m_last_changed_iterations.resize(a_NUMBER_OF_VARIABLES, -1);
+
+        m_binary_moves_begin    = a_BINARY_MOVES.data();
+        m_integer_moves_begin   = a_INTEGER_MOVES.data();
+        m_selection_moves_begin = a_SELECTION_MOVES.data();
+        m_binary_moves_size     = a_BINARY_MOVES.size();
+        m_integer_moves_size    = a_INTEGER_MOVES.size();
+        m_selection_moves_size  = a_SELECTION_MOVES.size();
+
+        m_entries.resize(
+            m_binary_moves_size + m_integer_moves_size + m_selection_moves_size,
+            {-1, 0.0, 0.0, 0.0, 0.0, false});
+    }
+
+    /*************************************************************************/
+    inline void prepare(const std::vector<Move_T *> &a_MOVE_PTRS,  //
+                        const int                    a_NUMBER_OF_MOVES) {
+        /**
+         * This method assigns the cache entries to the moves to be evaluated
+         * in the current iteration. It must be called in serial before
+         * restore() and store(), which can be called in parallel for the
+         * distinct moves.
+         */
+        m_move_entry_indices.resize(a_NUMBER_OF_MOVES);
+        for (auto i = 0; i < a_NUMBER_OF_MOVES; i++) {
+            m_move_entry_indices[i] = this->compute_entry_index(a_MOVE_PTRS[i]);
+        }
+    }
+
+    /*************************************************************************/
+    inline bool restore(model::SolutionScore *     a_score_ptr,      //
+                        const int                  a_MOVE_INDEX,     //
+                        const model::Move<T_Variable, T_Expression>  //
+                            &                      a_MOVE,           //
+                        const model::SolutionScore &a_CURRENT_SCORE) const {
+        const int ENTRY_INDEX = m_move_entry_indices[a_MOVE_INDEX];
+        if (ENTRY_INDEX < 0) {
+            return false;
+        }
+
+        const auto &entry = m_entries[ENTRY_INDEX];
+        if (entry.evaluated_iteration < 0) {
+            return false;
+        }
+
+        for (const auto &alteration : a_MOVE.alterations) {
+            if (m_last_changed_iterations[alteration.first->global_index()] >=
+                entry.evaluated_iteration) {
+                return false;
+            }
+        }
+
+        const double OBJECTIVE =
+            a_CURRENT_SCORE.objective + entry.objective_difference;
+        const double TOTAL_VIOLATION =
+            a_CURRENT_SCORE.total_violation + entry.total_violation_difference;
+        const double LOCAL_PENALTY =
+            a_CURRENT_SCORE.local_penalty + entry.local_penalty_difference;
+        const double GLOBAL_PENALTY =
+            a_CURRENT_SCORE.global_penalty + entry.global_penalty_difference;
+
+        a_score_ptr->objective                  = OBJECTIVE;
+        a_score_ptr->objective_improvement      = -entry.objective_difference;
+        a_score_ptr->total_violation            = TOTAL_VIOLATION;
+        a_score_ptr->local_penalty              = LOCAL_PENALTY;
+        a_score_ptr->global_penalty             = GLOBAL_PENALTY;
+        a_score_ptr->local_augmented_objective  = OBJECTIVE + LOCAL_PENALTY;
+        a_score_ptr->global_augmented_objective = OBJECTIVE + GLOBAL_PENALTY;
+        a_score_ptr->is_feasible = !(TOTAL_VIOLATION > constant::EPSILON);
+        a_score_ptr->is_objective_improvable =
+            -entry.objective_difference > constant::EPSILON;
+        a_score_ptr->is_feasibility_improvable =
+            entry.is_feasibility_improvable;
+
+        return true;
+    }
+
+    /*************************************************************************/
+    inline void store(const int                   a_MOVE_INDEX,     //
+                      const model::SolutionScore &a_SCORE,          //
+                      const model::SolutionScore &a_CURRENT_SCORE,  //
+                      const int                   a_ITERATION) {
+        const int ENTRY_INDEX = m_move_entry_indices[a_MOVE_INDEX];
+        if (ENTRY_INDEX < 0) {
+            return;
+        }
+
+        auto &entry               = m_entries[ENTRY_INDEX];
+        entry.evaluated_iteration = a_ITERATION;
+        entry.objective_difference =
+            a_SCORE.objective - a_CURRENT_SCORE.objective;
+        entry.total_violation_difference =
+            a_SCORE.total_violation - a_CURRENT_SCORE.total_violation;
+        entry.local_penalty_difference =
+            a_SCORE.local_penalty - a_CURRENT_SCORE.local_penalty;
+        entry.global_penalty_difference =
+            a_SCORE.global_penalty - a_CURRENT_SCORE.global_penalty;
+        entry.is_feasibility_improvable = a_SCORE.is_feasibility_improvable;
+    }
+
+    /*************************************************************************/
+    inline void invalidate(const model::Move<T_Variable, T_Expression> &a_MOVE,
+                           const int a_ITERATION) {
+        /**
+         * This method invalidates the cache entries of the moves which
+         * include the variables altered by the given move or the variables
+         * sharing the constraints related to the move.
+         */
+        for (const auto &alteration : a_MOVE.alterations) {
+            m_last_changed_iterations[alteration.first->global_index()] =
+                a_ITERATION;
+        }
+        for (const auto &constraint_ptr : a_MOVE.related_constraint_ptrs) {
+            for (const auto &sensitivity :
+                 constraint_ptr->expression().sensitivities()) {
+                m_last_changed_iterations[sensitivity.first->global_index()] =
+                    a_ITERATION;
+            }
+        }
+    }
+
+    /*************************************************************************/
+    inline int number_of_entries(void) const {
+        return m_entries.size();
+    }
+
+   private:
+    /*************************************************************************/
+    inline int compute_entry_index(const Move_T *a_MOVE_PTR) const noexcept {
+        /**
+         * This method returns the position of the move in the static
+         * neighborhood arrays, or -1 if the move is not one of them.
+         */
+        int offset = 0;
+        int size   = 0;
+
+        const Move_T *begin = nullptr;
+        switch (a_MOVE_PTR->sense) {
+            case model::MoveSense::Binary: {
+                begin = m_binary_moves_begin;
+                size  = m_binary_moves_size;
+                break;
+            }
+            case model::MoveSense::Integer: {
+                begin  = m_integer_moves_begin;
+                size   = m_integer_moves_size;
+                offset = m_binary_moves_size;
+                break;
+            }
+            case model::MoveSense::Selection: {
+                begin  = m_selection_moves_begin;
+                size   = m_selection_moves_size;
+                offset = m_binary_moves_size + m_integer_moves_size;
+                break;
+            }
+            default: {
+                return -1;
+            }
+        }
+
+        std::less<const Move_T *> less;
+        if (size == 0 || less(a_MOVE_PTR, begin) ||
+            !less(a_MOVE_PTR, begin + size)) {
+            return -1;
+        }
+        return offset + static_cast<int>(a_MOVE_PTR - begin);
+    }
+};
+}  // namespace tabu_search
+}  // namespace solver
+}  // namespace printemps
+
+#endif
+/*****************************************************************************/
+// END
+/*****************************************************************************/
@@ -34,8 +34,7 @@ constexpr bool compute_permissibility(
              */
             for (const auto &alteration : a_MOVE.alterations) {
                 const int last_update_iteration =
-                    last_update_iterations[alteration.first->proxy_index()]
-                                          [alteration.first->flat_index()];
+                    last_update_iterations[alteration.first->global_index()];
                 if (a_ITERATION - last_update_iteration >= a_TABU_TENURE) {
                     return true;
                 }
@@ -51,8 +50,7 @@ constexpr bool compute_permissibility(
              */
             for (const auto &alteration : a_MOVE.alterations) {
                 const int last_update_iteration =
-                    last_update_iterations[alteration.first->proxy_index()]
-                                          [alteration.first->flat_index()];
+                    last_update_iterations[alteration.first->global_index()];
                 if (a_ITERATION - last_update_iteration < a_TABU_TENURE) {
                     return false;
                 }
@@ -88,8 +86,7 @@ constexpr double compute_frequency_penalty(
 
     int move_update_count = 0;
     for (const auto &alteration : a_MOVE.alterations) {
-        move_update_count += update_counts[alteration.first->proxy_index()]
-                                          [alteration.first->flat_index()];
+        move_update_count += update_counts[alteration.first->global_index()];
     }
     return move_update_count *
            a_OPTION.tabu_search.frequency_penalty_coefficient /
@@ -44,6 +44,9 @@ struct TabuSearchOptionConstant {
     static constexpr double DEFAULT_IGNORE_TABU_IF_GLOBAL_INCUMBENT = true;
     static constexpr bool   DEFAULT_NUMBER_OF_INITIAL_MODIFICATION  = 0;
     static constexpr int    DEFAULT_SEED                            = 1;
+
+    static constexpr bool DEFAULT_IS_ENABLED_MOVE_EVALUATION_CACHE = false;
+    static constexpr bool DEFAULT_IS_ENABLED_BINARY_FLIP_EVALUATION = true;
 };
 
 /*****************************************************************************/
@@ -72,6 +75,8 @@ struct TabuSearchOption {
     double   iteration_decrease_rate;                      // hidden
     bool     ignore_tabu_if_global_incumbent;              // hidden
     int      number_of_initial_modification;               // hidden
+    bool     is_enabled_move_evaluation_cache;             // hidden
+    bool     is_enabled_binary_flip_evaluation;            // hidden
     int      seed;                                         // hidden
 
     /*************************************************************************/
@@ -131,6 +136,10 @@ struct TabuSearchOption {
             TabuSearchOptionConstant::DEFAULT_IGNORE_TABU_IF_GLOBAL_INCUMBENT;
         this->number_of_initial_modification =
             TabuSearchOptionConstant::DEFAULT_NUMBER_OF_INITIAL_MODIFICATION;
+        this->is_enabled_move_evaluation_cache =
+            TabuSearchOptionConstant::DEFAULT_IS_ENABLED_MOVE_EVALUATION_CACHE;
+        this->is_enabled_binary_flip_evaluation =
+            TabuSearchOptionConstant::DEFAULT_IS_ENABLED_BINARY_FLIP_EVALUATION;
         this->seed = TabuSearchOptionConstant::DEFAULT_SEED;
     }
 };
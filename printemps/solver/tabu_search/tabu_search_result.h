@@ -20,14 +20,14 @@ enum class TabuSearchTerminationStatus {
     NO_MOVE,
     REACH_TARGET,
     EARLY_STOP,
-    OPTIMAL
+    OPTIMAL,
+    INTERRUPTED
 };
 
 /*****************************************************************************/
 template <class T_Variable, class T_Expression>
 struct TabuSearchResult {
     IncumbentHolder<T_Variable, T_Expression> incumbent_holder;
-    Memory                                    memory;
 
     int tabu_tenure;
     int total_update_status;
@@ -47,6 +47,9 @@ struct TabuSearchResult {
     std::vector<model::PlainSolution<T_Variable, T_Expression>>
         historical_feasible_solutions;
 
+    Profiler           profiler;
+    ParallelController parallel_controller;
+
     /*************************************************************************/
     TabuSearchResult(void) {
         this->initialize();
@@ -60,7 +63,6 @@ struct TabuSearchResult {
     /*************************************************************************/
     void initialize(void) {
         this->incumbent_holder.initialize();
-        this->memory.initialize();
 
         this->tabu_tenure          = 0;
         this->total_update_status  = 0;
@@ -78,6 +80,8 @@ struct TabuSearchResult {
         this->termination_status = TabuSearchTerminationStatus::ITERATION_OVER;
 
         this->historical_feasible_solutions.clear();
+        this->profiler.initialize();
+        this->parallel_controller.initialize();
     }
 };
 }  // namespace tabu_search
@@ -0,0 +1,193 @@
+/*****************************************************************************/
+// Copyright (c) 2020 Yuji KOGUMA
+// Released under the MIT license
+// https://opensource.org/licenses/mit-license.php
+/*****************************************************************************/
+#ifndef PRINTEMPS_SOLVER_TRACE_WRITER_H__
+#define PRINTEMPS_SOLVER_TRACE_WRITER_H__
+
+#include <cmath>
+#include <fstream>
+#include <iomanip>
+#include <limits>
+#include <string>
+
+#include "../model/model.h"
+#include "profiler.h"
+
+namespace printemps {
+namespace solver {
+/*****************************************************************************/
+enum class TraceMode : int { None, CSV, JSONL };
+
+/*****************************************************************************/
+class TraceWriter {
+    /**
+     * TraceWriter appends one record per search iteration to the trace file,
+     * in CSV or JSON Lines format. A record consists of the search name, the
+     * iteration, the elapsed time, the solution score, the number of the
+     * candidate moves, and the elapsed times of the phases in the iteration.
+     * The file name is given without the extension, which is added according
+     * to the mode. The values are written with the precision to be restored
+     * exactly, and the non-finite values are written as null in JSON Lines
+     * format, since JSON has no literals for them.
+     */
+   private:
+    TraceMode     m_mode;
+    std::ofstream m_ofs;
+
+    /*************************************************************************/
+    inline void write_csv_header(void) {
+        m_ofs << "search,iteration,elapsed_time,objective,total_violation,"
+                 "global_augmented_objective,is_feasible,number_of_moves";
+        for (auto i = 0; i < ProfilerConstant::NUMBER_OF_PHASES; i++) {
+            m_ofs << ","
+                  << profile_phase_name(static_cast<ProfilePhase>(i));
+        }
+        m_ofs << std::endl;
+    }
+
+    /*************************************************************************/
+    inline void write_json_number(const double a_VALUE) {
+        if (std::isfinite(a_VALUE)) {
+            m_ofs << a_VALUE;
+        } else {
+            m_ofs << "null";
+        }
+    }
+
+   public:
+    /*************************************************************************/
+    TraceWriter(void) {
+        this->initialize();
+    }
+
+    /*************************************************************************/
+    virtual ~TraceWriter(void) {
+        this->close();
+    }
+
+    /*************************************************************************/
+    inline void initialize(void) {
+        this->close();
+        m_mode = TraceMode::None;
+    }
+
+    /*************************************************************************/
+    inline static std::string file_name(const std::string &a_FILE_NAME,
+                                        const TraceMode    a_MODE) {
+        return a_FILE_NAME + (a_MODE == TraceMode::JSONL ? ".jsonl" : ".csv");
+    }
+
+    /*************************************************************************/
+    inline void create(const std::string &a_FILE_NAME, const TraceMode a_MODE) {
+        /**
+         * Create an empty trace file, or truncate the existing one.
+         */
+        this->initialize();
+        if (a_MODE == TraceMode::None) {
+            return;
+        }
+        std::ofstream ofs(file_name(a_FILE_NAME, a_MODE).c_str(),
+                          std::ios::trunc);
+        ofs.close();
+    }
+
+    /*************************************************************************/
+    inline void open(const std::string &a_FILE_NAME, const TraceMode a_MODE) {
+        /**
+         * Open the trace file in append mode. The CSV header is written if the
+         * file is empty.
+         */
+        this->initialize();
+        if (a_MODE == TraceMode::None) {
+            return;
+        }
+        const std::string FILE_NAME = file_name(a_FILE_NAME, a_MODE);
+
+        std::ifstream ifs(FILE_NAME.c_str(), std::ios::ate);
+        const bool    IS_EMPTY = !ifs.is_open() || ifs.tellg() <= 0;
+        ifs.close();
+
+        m_mode = a_MODE;
+        m_ofs.open(FILE_NAME.c_str(), std::ios::app);
+        m_ofs << std::setprecision(std::numeric_limits<double>::max_digits10);
+        if (IS_EMPTY && m_mode == TraceMode::CSV) {
+            this->write_csv_header();
+        }
+    }
+
+    /*************************************************************************/
+    inline void close(void) {
+        if (m_ofs.is_open()) {
+            m_ofs.close();
+        }
+    }
+
+    /*************************************************************************/
+    inline bool is_enabled(void) const {
+        return m_mode != TraceMode::None;
+    }
+
+    /*************************************************************************/
+    inline void write(const std::string &         a_SEARCH_NAME,     //
+                      const int                   a_ITERATION,       //
+                      const double                a_ELAPSED_TIME,    //
+                      const model::SolutionScore &a_SCORE,           //
+                      const int                   a_NUMBER_OF_MOVES,  //
+                      const Profiler &            a_PROFILER) {
+        switch (m_mode) {
+            case TraceMode::CSV: {
+                m_ofs << a_SEARCH_NAME << ","                        //
+                      << a_ITERATION << ","                          //
+                      << a_ELAPSED_TIME << ","                       //
+                      << a_SCORE.objective << ","                    //
+                      << a_SCORE.total_violation << ","              //
+                      << a_SCORE.global_augmented_objective << ","   //
+                      << (a_SCORE.is_feasible ? 1 : 0) << ","        //
+                      << a_NUMBER_OF_MOVES;
+                for (auto i = 0; i < ProfilerConstant::NUMBER_OF_PHASES; i++) {
+                    m_ofs << "," << a_PROFILER.iteration_elapsed_time(
+                                        static_cast<ProfilePhase>(i));
+                }
+                m_ofs << "\n";
+                break;
+            }
+            case TraceMode::JSONL: {
+                m_ofs << "{\"search\":\"" << a_SEARCH_NAME << "\","  //
+                      << "\"iteration\":" << a_ITERATION << ","       //
+                      << "\"elapsed_time\":";
+                this->write_json_number(a_ELAPSED_TIME);
+                m_ofs << ",\"objective\":";
+                this->write_json_number(a_SCORE.objective);
+                m_ofs << ",\"total_violation\":";
+                this->write_json_number(a_SCORE.total_violation);
+                m_ofs << ",\"global_augmented_objective\":";
+                this->write_json_number(a_SCORE.global_augmented_objective);
+                m_ofs << ",\"is_feasible\":"
+                      << (a_SCORE.is_feasible ? "true" : "false") << ","
+                      << "\"number_of_moves\":" << a_NUMBER_OF_MOVES << ","
+                      << "\"profile\":{";
+                for (auto i = 0; i < ProfilerConstant::NUMBER_OF_PHASES; i++) {
+                    const auto PHASE = static_cast<ProfilePhase>(i);
+                    m_ofs << (i > 0 ? "," : "") << "\""
+                          << profile_phase_name(PHASE) << "\":";
+                    this->write_json_number(
+                        a_PROFILER.iteration_elapsed_time(PHASE));
+                }
+                m_ofs << "}}\n";
+                break;
+            }
+            default: {
+                break;
+            }
+        }
+    }
+};
+}  // namespace solver
+}  // namespace printemps
+
+#endif
+/*****************************************************************************/
+// END
+/*****************************************************************************/
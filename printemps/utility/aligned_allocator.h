@@ -0,0 +1,88 @@
+/*****************************************************************************/
+// Copyright (c) 2020 Yuji KOGUMA
+// Released under the MIT license
+// https://opensource.org/licenses/mit-license.php
+/*****************************************************************************/
+#ifndef PRINTEMPS_UTILITY_ALIGNED_ALLOCATOR_H__
+#define PRINTEMPS_UTILITY_ALIGNED_ALLOCATOR_H__
+
+#include <cstddef>
+#include <cstdint>
+#include <new>
+
+namespace printemps {
+namespace utility {
+/*****************************************************************************/
+struct AlignedAllocatorConstant {
+    static constexpr std::size_t CACHE_LINE_SIZE = 64;
+};
+
+/*****************************************************************************/
+template <class T, std::size_t T_ALIGNMENT>
+class AlignedAllocator {
+    /**
+     * AlignedAllocator is a minimal allocator for std::vector which returns
+     * memory aligned to T_ALIGNMENT bytes. Since the aligned operator new is
+     * not available in C++14, a larger block is allocated and the original
+     * address is stored just before the aligned address.
+     */
+   public:
+    using value_type = T;
+
+    /*************************************************************************/
+    template <class U>
+    struct rebind {
+        using other = AlignedAllocator<U, T_ALIGNMENT>;
+    };
+
+    /*************************************************************************/
+    AlignedAllocator(void) noexcept {
+        /// nothing to do
+    }
+
+    /*************************************************************************/
+    template <class U>
+    AlignedAllocator(const AlignedAllocator<U, T_ALIGNMENT> &) noexcept {
+        /// nothing to do
+    }
+
+    /*************************************************************************/
+    inline T *allocate(const std::size_t a_SIZE) {
+        const std::size_t HEADER_SIZE = sizeof(void *) + T_ALIGNMENT - 1;
+        void *            original_ptr =
+            ::operator new(a_SIZE * sizeof(T) + HEADER_SIZE);
+
+        const std::uintptr_t ADDRESS =
+            (reinterpret_cast<std::uintptr_t>(original_ptr) + HEADER_SIZE) &
+            ~(static_cast<std::uintptr_t>(T_ALIGNMENT) - 1);
+
+        void **aligned_ptr = reinterpret_cast<void **>(ADDRESS);
+        aligned_ptr[-1]    = original_ptr;
+        return reinterpret_cast<T *>(aligned_ptr);
+    }
+
+    /*************************************************************************/
+    inline void deallocate(T *a_ptr, const std::size_t) noexcept {
+        ::operator delete(reinterpret_cast<void **>(a_ptr)[-1]);
+    }
+};
+
+/*****************************************************************************/
+template <class T, class U, std::size_t T_ALIGNMENT>
+inline bool operator==(const AlignedAllocator<T, T_ALIGNMENT> &,
+                       const AlignedAllocator<U, T_ALIGNMENT> &) noexcept {
+    return true;
+}
+
+/*****************************************************************************/
+template <class T, class U, std::size_t T_ALIGNMENT>
+inline bool operator!=(const AlignedAllocator<T, T_ALIGNMENT> &,
+                       const AlignedAllocator<U, T_ALIGNMENT> &) noexcept {
+    return false;
+}
+}  // namespace utility
+}  // namespace printemps
+#endif
+/*****************************************************************************/
+// END
+/*****************************************************************************/
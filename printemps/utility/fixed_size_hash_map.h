@@ -9,27 +9,48 @@
 #include <vector>
 #include <unordered_map>
 #include <cmath>
+#include <stdexcept>
+
+#include "aligned_allocator.h"
+#include "string_utility.h"
 
 namespace printemps {
 namespace utility {
 /*****************************************************************************/
 struct FixedSizeHashMapConstant {
     static constexpr std::uint_fast32_t DEFAULT_BUCKET_SIZE = 1;
-    static constexpr int                LOAD_MARGIN         = 10;
+    static constexpr double             DEFAULT_LOAD_FACTOR = 0.5;
+};
+
+/*****************************************************************************/
+template <class T_Key, class T_Value>
+struct FixedSizeHashMapBucket {
+    T_Key   key;
+    T_Value value;
 };
 
 /*****************************************************************************/
 template <class T_Key, class T_Value>
 class FixedSizeHashMap {
+    /**
+     * FixedSizeHashMap is an open-addressing hash map with linear probing for
+     * pointer keys, which is built once by setup() and is read-only after
+     * that. The key and the value are interleaved in each bucket so that a
+     * probe touches one cache line, and the buckets are aligned to the cache
+     * line. An empty bucket is marked by the null key, so the null pointer
+     * cannot be stored as a key. Since the buckets are held by std::vector,
+     * the map can be safely copied and moved.
+     */
    private:
+    using Bucket = FixedSizeHashMapBucket<T_Key, T_Value>;
+
     std::uint_fast8_t  m_shift_size;
     std::uint_fast32_t m_bucket_size;
     std::uint_fast32_t m_mask;
 
-    bool     m_is_memory_allocated;
-    T_Key *  m_keys;
-    T_Value *m_values;
-    bool *   m_is_occupied;
+    std::vector<Bucket, AlignedAllocator<
+                            Bucket, AlignedAllocatorConstant::CACHE_LINE_SIZE>>
+        m_buckets;
 
     /*************************************************************************/
     inline constexpr std::uint_fast32_t compute_hash(const T_Key a_KEY) const
@@ -48,14 +69,13 @@ class FixedSizeHashMap {
         /**
          * This method is provided as private and is called only by setup().
          */
-        std::uint_fast32_t index = this->compute_hash(a_KEY) & m_mask;
-        while (m_is_occupied[index]) {
+        std::uint_fast32_t index =
+            this->compute_index(this->compute_hash(a_KEY));
+        while (m_buckets[index].key != static_cast<T_Key>(0)) {
             index = (index + 1) & m_mask;
         }
-
-        m_is_occupied[index] = 1;
-        m_keys[index]        = a_KEY;
-        m_values[index]      = a_VALUE;
+        m_buckets[index].key   = a_KEY;
+        m_buckets[index].value = a_VALUE;
     }
 
    public:
@@ -66,57 +86,63 @@ class FixedSizeHashMap {
 
     /*************************************************************************/
     virtual ~FixedSizeHashMap(void) {
-        if (m_is_memory_allocated) {
-            delete[] m_is_occupied;
-            delete[] m_keys;
-            delete[] m_values;
-            m_is_memory_allocated = false;
-        }
+        /// nothing to do
     }
 
     /*************************************************************************/
     FixedSizeHashMap(const std::unordered_map<T_Key, T_Value> &a_UNORDERED_MAP,
-                     const std::uint_fast32_t                  a_KEY_SIZE) {
-        this->setup(a_UNORDERED_MAP, a_KEY_SIZE);
+                     const std::uint_fast32_t                  a_KEY_SIZE,
+                     const double                              a_LOAD_FACTOR =
+                         FixedSizeHashMapConstant::DEFAULT_LOAD_FACTOR) {
+        this->setup(a_UNORDERED_MAP, a_KEY_SIZE, a_LOAD_FACTOR);
     }
 
     /*************************************************************************/
-    inline constexpr void initialize(void) {
-        m_shift_size          = 0;
-        m_bucket_size         = FixedSizeHashMapConstant::DEFAULT_BUCKET_SIZE;
-        m_mask                = m_bucket_size - 1;
-        m_is_memory_allocated = false;
-
-        m_keys        = nullptr;
-        m_values      = nullptr;
-        m_is_occupied = nullptr;
+    inline void initialize(void) {
+        m_shift_size  = 0;
+        m_bucket_size = FixedSizeHashMapConstant::DEFAULT_BUCKET_SIZE;
+        m_mask        = m_bucket_size - 1;
+
+        /**
+         * One empty bucket is kept so that at() can be called before setup().
+         */
+        m_buckets.assign(m_bucket_size, Bucket{static_cast<T_Key>(0),
+                                               static_cast<T_Value>(0)});
     }
 
     /*************************************************************************/
     inline void setup(const std::unordered_map<T_Key, T_Value> &a_UNORDERED_MAP,
-                      const std::uint_fast32_t                  a_KEY_SIZE) {
+                      const std::uint_fast32_t                  a_KEY_SIZE,
+                      const double                              a_LOAD_FACTOR =
+                          FixedSizeHashMapConstant::DEFAULT_LOAD_FACTOR) {
+        if (a_LOAD_FACTOR <= 0.0 || a_LOAD_FACTOR >= 1.0) {
+            throw std::logic_error(utility::format_error_location(
+                __FILE__, __LINE__, __func__,
+                "The load factor must be in (0, 1)."));
+        }
+
         m_shift_size = floor(log2(a_KEY_SIZE));
 
-        std::uint_fast32_t minimum_bucket_size =
-            a_UNORDERED_MAP.size() * FixedSizeHashMapConstant::LOAD_MARGIN;
+        const std::uint_fast32_t MINIMUM_BUCKET_SIZE =
+            static_cast<std::uint_fast32_t>(
+                std::ceil(a_UNORDERED_MAP.size() / a_LOAD_FACTOR));
         std::uint_fast32_t bucket_size = 1;
-        while (bucket_size < minimum_bucket_size) {
+        while (bucket_size < MINIMUM_BUCKET_SIZE) {
             bucket_size <<= 1;
         }
-        m_bucket_size = bucket_size;
-        m_mask        = m_bucket_size - 1;
 
-        m_keys                = new T_Key[m_bucket_size];
-        m_values              = new T_Value[m_bucket_size];
-        m_is_occupied         = new bool[m_bucket_size];
-        m_is_memory_allocated = true;
-
-        for (std::uint_fast32_t i = 0; i < bucket_size; i++) {
-            m_keys[i]        = static_cast<T_Key>(0);
-            m_values[i]      = static_cast<T_Value>(0);
-            m_is_occupied[i] = false;
+        /**
+         * At least one bucket must be empty to terminate the probing.
+         */
+        if (bucket_size == a_UNORDERED_MAP.size()) {
+            bucket_size <<= 1;
         }
 
+        m_bucket_size = bucket_size;
+        m_mask        = m_bucket_size - 1;
+        m_buckets.assign(m_bucket_size, Bucket{static_cast<T_Key>(0),
+                                               static_cast<T_Value>(0)});
+
         for (const auto &item : a_UNORDERED_MAP) {
             this->insert(item.first, item.second);
         }
@@ -128,17 +154,40 @@ class FixedSizeHashMap {
             (reinterpret_cast<std::uint_fast64_t>(a_KEY) >> m_shift_size) &
             m_mask;
 
-        if (!m_is_occupied[index]) {
-            return 0;
-        }
-
-        while (m_keys[index] != a_KEY) {
-            if (!m_is_occupied[index]) {
+        const Bucket *buckets = m_buckets.data();
+        while (buckets[index].key != a_KEY) {
+            if (buckets[index].key == static_cast<T_Key>(0)) {
                 return 0;
             }
             index = (index + 1) & m_mask;
         }
-        return m_values[index];
+        return buckets[index].value;
+    }
+
+    /*************************************************************************/
+    inline void at(T_Value *a_values, const T_Key *a_KEYS,
+                   const int a_SIZE) const noexcept {
+        /**
+         * This method looks up the values for a_SIZE keys. The home buckets
+         * of all keys are prefetched before the lookups so that the memory
+         * accesses overlap.
+         */
+        for (auto i = 0; i < a_SIZE; i++) {
+            this->prefetch(a_KEYS[i]);
+        }
+        for (auto i = 0; i < a_SIZE; i++) {
+            a_values[i] = this->at(a_KEYS[i]);
+        }
+    }
+
+    /*************************************************************************/
+    inline void prefetch(const T_Key a_KEY) const noexcept {
+#if defined(__GNUC__) || defined(__clang__)
+        __builtin_prefetch(
+            m_buckets.data() + this->compute_index(this->compute_hash(a_KEY)));
+#else
+        static_cast<void>(a_KEY);
+#endif
     }
 
     /*************************************************************************/
@@ -156,4 +205,4 @@ class FixedSizeHashMap {
 #endif
 /*****************************************************************************/
 // END
-/*****************************************************************************/
\ No newline at end of file
+/*****************************************************************************/
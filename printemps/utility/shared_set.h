@@ -0,0 +1,166 @@
+/*****************************************************************************/
+// Copyright (c) 2020 Yuji KOGUMA
+// Released under the MIT license
+// https://opensource.org/licenses/mit-license.php
+/*****************************************************************************/
+#ifndef PRINTEMPS_UTILITY_SHARED_SET_H__
+#define PRINTEMPS_UTILITY_SHARED_SET_H__
+
+#include <algorithm>
+#include <functional>
+#include <initializer_list>
+#include <memory>
+#include <unordered_set>
+#include <vector>
+
+namespace printemps {
+namespace utility {
+/*****************************************************************************/
+template <class T>
+class SharedSet {
+    /**
+     * SharedSet is a set whose elements are stored in a sorted vector shared
+     * among the copies of the set. Copying a set only increments the
+     * reference count, and the elements are copied only if a set sharing
+     * them with others is modified (copy-on-write). It is designed for sets
+     * which are built in setting up and are copied frequently afterward.
+     */
+   private:
+    std::shared_ptr<std::vector<T>> m_elements_ptr;
+
+    /*************************************************************************/
+    inline std::vector<T> &mutable_elements(void) {
+        if (!m_elements_ptr) {
+            m_elements_ptr = std::make_shared<std::vector<T>>();
+        } else if (m_elements_ptr.use_count() > 1) {
+            m_elements_ptr = std::make_shared<std::vector<T>>(*m_elements_ptr);
+        }
+        return *m_elements_ptr;
+    }
+
+    /*************************************************************************/
+    inline void normalize(std::vector<T> *a_elements_ptr) {
+        std::sort(a_elements_ptr->begin(), a_elements_ptr->end(),
+                  std::less<T>());
+        a_elements_ptr->erase(
+            std::unique(a_elements_ptr->begin(), a_elements_ptr->end()),
+            a_elements_ptr->end());
+    }
+
+   public:
+    /*************************************************************************/
+    SharedSet(void) {
+        this->initialize();
+    }
+
+    /*************************************************************************/
+    SharedSet(std::initializer_list<T> a_ELEMENTS) {
+        this->initialize();
+        this->insert(a_ELEMENTS.begin(), a_ELEMENTS.end());
+    }
+
+    /*************************************************************************/
+    SharedSet(const std::unordered_set<T> &a_ELEMENTS) {
+        this->initialize();
+        this->insert(a_ELEMENTS.begin(), a_ELEMENTS.end());
+    }
+
+    /*************************************************************************/
+    virtual ~SharedSet(void) {
+        /// nothing to do
+    }
+
+    /*************************************************************************/
+    SharedSet(const SharedSet<T> &) = default;
+
+    /*************************************************************************/
+    SharedSet<T> &operator=(const SharedSet<T> &) = default;
+
+    /*************************************************************************/
+    inline void initialize(void) {
+        m_elements_ptr.reset();
+    }
+
+    /*************************************************************************/
+    inline void clear(void) {
+        m_elements_ptr.reset();
+    }
+
+    /*************************************************************************/
+    inline void insert(const T &a_ELEMENT) {
+        auto &elements = this->mutable_elements();
+        auto  position = std::lower_bound(elements.begin(), elements.end(),
+                                         a_ELEMENT, std::less<T>());
+        if (position == elements.end() || *position != a_ELEMENT) {
+            elements.insert(position, a_ELEMENT);
+        }
+    }
+
+    /*************************************************************************/
+    template <class T_Iterator>
+    inline void insert(T_Iterator a_first, T_Iterator a_last) {
+        if (a_first == a_last) {
+            return;
+        }
+        auto &elements = this->mutable_elements();
+        for (auto it = a_first; it != a_last; ++it) {
+            elements.push_back(*it);
+        }
+        this->normalize(&elements);
+    }
+
+    /*************************************************************************/
+    inline const T *find(const T &a_ELEMENT) const {
+        auto position = std::lower_bound(this->begin(), this->end(),
+                                         a_ELEMENT, std::less<T>());
+        if (position != this->end() && *position == a_ELEMENT) {
+            return position;
+        }
+        return this->end();
+    }
+
+    /*************************************************************************/
+    inline int count(const T &a_ELEMENT) const {
+        return this->find(a_ELEMENT) != this->end();
+    }
+
+    /*************************************************************************/
+    inline const T *begin(void) const noexcept {
+        return m_elements_ptr ? m_elements_ptr->data() : nullptr;
+    }
+
+    /*************************************************************************/
+    inline const T *end(void) const noexcept {
+        return m_elements_ptr ? m_elements_ptr->data() + m_elements_ptr->size()
+                              : nullptr;
+    }
+
+    /*************************************************************************/
+    inline int size(void) const noexcept {
+        return m_elements_ptr ? m_elements_ptr->size() : 0;
+    }
+
+    /*************************************************************************/
+    inline bool empty(void) const noexcept {
+        return this->size() == 0;
+    }
+
+    /*************************************************************************/
+    inline bool is_shared_with(const SharedSet<T> &a_OTHER) const noexcept {
+        return m_elements_ptr && m_elements_ptr == a_OTHER.m_elements_ptr;
+    }
+};
+
+/*****************************************************************************/
+template <class T>
+inline std::vector<T> to_vector(const SharedSet<T> &a_SHARED_SET) {
+    std::vector<T> result(a_SHARED_SET.begin(), a_SHARED_SET.end());
+    return result;
+}
+}  // namespace utility
+}  // namespace printemps
+
+#endif
+/*****************************************************************************/
+// END
+/*****************************************************************************/
@@ -0,0 +1,185 @@
+/*****************************************************************************/
+// Copyright (c) 2020 Yuji KOGUMA
+// Released under the MIT license
+// https://opensource.org/licenses/mit-license.php
+/*****************************************************************************/
+#ifndef PRINTEMPS_UTILITY_SMALL_VECTOR_H__
+#define PRINTEMPS_UTILITY_SMALL_VECTOR_H__
+
+#include <algorithm>
+#include <array>
+#include <initializer_list>
+#include <stdexcept>
+#include <vector>
+
+#include "string_utility.h"
+
+namespace printemps {
+namespace utility {
+/*****************************************************************************/
+template <class T, int N>
+class SmallVector {
+    /**
+     * SmallVector is a sequence container which stores up to N elements in
+     * the inline buffer, and moves them to a heap-allocated vector only if
+     * the number of elements exceeds N. Since the heap-allocated vector keeps
+     * its capacity after clear(), refilling the container and copying the
+     * container with at most N elements are free from heap allocation.
+     */
+   private:
+    std::array<T, N> m_buffer;
+    std::vector<T>   m_overflow;
+    int              m_size;
+
+    /*************************************************************************/
+    inline constexpr bool is_overflowed(void) const noexcept {
+        return m_size > N;
+    }
+
+   public:
+    /*************************************************************************/
+    SmallVector(void) {
+        this->initialize();
+    }
+
+    /*************************************************************************/
+    SmallVector(std::initializer_list<T> a_ELEMENTS) {
+        this->initialize();
+        this->insert(this->end(), a_ELEMENTS.begin(), a_ELEMENTS.end());
+    }
+
+    /*************************************************************************/
+    virtual ~SmallVector(void) {
+        /// nothing to do
+    }
+
+    /*************************************************************************/
+    inline constexpr void initialize(void) {
+        m_overflow.clear();
+        m_size = 0;
+    }
+
+    /*************************************************************************/
+    inline constexpr void clear(void) noexcept {
+        m_overflow.clear();
+        m_size = 0;
+    }
+
+    /*************************************************************************/
+    inline constexpr void push_back(const T &a_ELEMENT) {
+        if (m_size < N) {
+            m_buffer[m_size] = a_ELEMENT;
+        } else {
+            if (m_size == N) {
+                m_overflow.assign(m_buffer.begin(), m_buffer.end());
+            }
+            m_overflow.push_back(a_ELEMENT);
+        }
+        m_size++;
+    }
+
+    /*************************************************************************/
+    template <class... T_Args>
+    inline constexpr void emplace_back(T_Args &&... a_args) {
+        this->push_back(T(std::forward<T_Args>(a_args)...));
+    }
+
+    /*************************************************************************/
+    template <class T_Iterator>
+    inline constexpr void insert(const T *a_POSITION, T_Iterator a_first,
+                                 T_Iterator a_last) {
+        /**
+         * Only insertion at the end is supported.
+         */
+        if (a_POSITION != this->end()) {
+            throw std::logic_error(utility::format_error_location(
+                __FILE__, __LINE__, __func__,
+                "Insertion is supported only at the end."));
+        }
+        for (auto it = a_first; it != a_last; ++it) {
+            this->push_back(*it);
+        }
+    }
+
+    /*************************************************************************/
+    inline constexpr T *data(void) noexcept {
+        return this->is_overflowed() ? m_overflow.data() : m_buffer.data();
+    }
+
+    /*************************************************************************/
+    inline constexpr const T *data(void) const noexcept {
+        return this->is_overflowed() ? m_overflow.data() : m_buffer.data();
+    }
+
+    /*************************************************************************/
+    inline constexpr T *begin(void) noexcept {
+        return this->data();
+    }
+
+    /*************************************************************************/
+    inline constexpr const T *begin(void) const noexcept {
+        return this->data();
+    }
+
+    /*************************************************************************/
+    inline constexpr T *end(void) noexcept {
+        return this->data() + m_size;
+    }
+
+    /*************************************************************************/
+    inline constexpr const T *end(void) const noexcept {
+        return this->data() + m_size;
+    }
+
+    /*************************************************************************/
+    inline constexpr T &operator[](const int a_INDEX) noexcept {
+        return this->data()[a_INDEX];
+    }
+
+    /*************************************************************************/
+    inline constexpr const T &operator[](const int a_INDEX) const noexcept {
+        return this->data()[a_INDEX];
+    }
+
+    /*************************************************************************/
+    inline constexpr T &front(void) noexcept {
+        return this->data()[0];
+    }
+
+    /*************************************************************************/
+    inline constexpr const T &front(void) const noexcept {
+        return this->data()[0];
+    }
+
+    /*************************************************************************/
+    inline constexpr T &back(void) noexcept {
+        return this->data()[m_size - 1];
+    }
+
+    /*************************************************************************/
+    inline constexpr const T &back(void) const noexcept {
+        return this->data()[m_size - 1];
+    }
+
+    /*************************************************************************/
+    inline constexpr int size(void) const noexcept {
+        return m_size;
+    }
+
+    /*************************************************************************/
+    inline constexpr bool empty(void) const noexcept {
+        return m_size == 0;
+    }
+
+    /*************************************************************************/
+    inline constexpr int capacity(void) const noexcept {
+        return std::max(N, static_cast<int>(m_overflow.capacity()));
+    }
+};
+}  // namespace utility
+}  // namespace printemps
+
+#endif
+/*****************************************************************************/
+// END
+/*****************************************************************************/
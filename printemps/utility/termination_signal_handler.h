@@ -0,0 +1,96 @@
+/*****************************************************************************/
+// Copyright (c) 2020 Yuji KOGUMA
+// Released under the MIT license
+// https://opensource.org/licenses/mit-license.php
+/*****************************************************************************/
+#ifndef PRINTEMPS_UTILITY_TERMINATION_SIGNAL_HANDLER_H__
+#define PRINTEMPS_UTILITY_TERMINATION_SIGNAL_HANDLER_H__
+
+#include <csignal>
+
+namespace printemps {
+namespace utility {
+/*****************************************************************************/
+inline volatile std::sig_atomic_t &termination_signal_flag(void) {
+    static volatile std::sig_atomic_t flag = 0;
+    return flag;
+}
+
+/*****************************************************************************/
+inline void handle_termination_signal(int) {
+    termination_signal_flag() = 1;
+}
+
+/*****************************************************************************/
+class TerminationSignalHandler {
+    /**
+     * TerminationSignalHandler replaces the handler of SIGTERM so that the
+     * signal only raises a flag instead of terminating the process. The
+     * searches check the flag by is_received() and stop at the next
+     * iteration, which gives the solver a chance to write a checkpoint before
+     * exit. The previous handler is restored by restore() or the destructor,
+     * which also clears the flag so that a signal caught in a search does not
+     * stop the later ones in the same process.
+     */
+   private:
+    bool m_is_installed;
+    void (*m_previous_handler)(int);
+
+   public:
+    /*************************************************************************/
+    TerminationSignalHandler(void) {
+        this->initialize();
+    }
+
+    /*************************************************************************/
+    virtual ~TerminationSignalHandler(void) {
+        this->restore();
+    }
+
+    /*************************************************************************/
+    inline void initialize(void) {
+        m_is_installed     = false;
+        m_previous_handler = SIG_DFL;
+    }
+
+    /*************************************************************************/
+    inline void install(void) {
+        if (m_is_installed) {
+            return;
+        }
+        termination_signal_flag() = 0;
+
+        auto previous_handler =
+            std::signal(SIGTERM, handle_termination_signal);
+        if (previous_handler != SIG_ERR) {
+            m_previous_handler = previous_handler;
+            m_is_installed     = true;
+        }
+    }
+
+    /*************************************************************************/
+    inline void restore(void) {
+        if (!m_is_installed) {
+            return;
+        }
+        std::signal(SIGTERM, m_previous_handler);
+        termination_signal_flag() = 0;
+        this->initialize();
+    }
+
+    /*************************************************************************/
+    inline constexpr bool is_installed(void) const {
+        return m_is_installed;
+    }
+
+    /*************************************************************************/
+    inline static bool is_received(void) {
+        return termination_signal_flag() != 0;
+    }
+};
+}  // namespace utility
+}  // namespace printemps
+#endif
+/*****************************************************************************/
+// END
+/*****************************************************************************/
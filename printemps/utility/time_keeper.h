@@ -9,35 +9,31 @@
 
 #include <iostream>
 #include <cstdlib>
-
+#include <chrono>
 #include <ctime>
-#ifdef _OPENMP
-#include <omp.h>
-#endif
 
 namespace printemps {
 namespace utility {
 /*****************************************************************************/
 class TimeKeeper {
+    /**
+     * TimeKeeper measures the elapsed wall-clock time with the monotonic
+     * std::chrono::steady_clock, so that the time limits are honored
+     * regardless of the number of threads used in parallel evaluations. The
+     * elapsed CPU time of the process, which is accumulated over all of the
+     * threads, is measured separately by std::clock() for reporting.
+     */
    private:
-    double m_start_time;
-    double m_elapsed_time;
+    std::chrono::steady_clock::time_point m_start_time_point;
+    std::clock_t                          m_start_cpu_clock;
 
-    /*************************************************************************/
-    inline double get_time(void) {
-#ifdef _OPENMP
-        return omp_get_wtime();
-#else
-        clock_t now = std::clock();
-        return static_cast<double>(now) / CLOCKS_PER_SEC;
-#endif
-    }
+    double m_elapsed_time;
+    double m_elapsed_cpu_time;
 
    public:
     /*************************************************************************/
     TimeKeeper(void) {
         this->initialize();
-        m_start_time = get_time();
     }
 
     /*************************************************************************/
@@ -47,32 +43,43 @@ class TimeKeeper {
 
     /*************************************************************************/
     void initialize(void) {
-        m_start_time   = 0.0;
-        m_elapsed_time = 0.0;
+        m_start_time_point = std::chrono::steady_clock::now();
+        m_start_cpu_clock  = std::clock();
+
+        m_elapsed_time     = 0.0;
+        m_elapsed_cpu_time = 0.0;
     }
 
     /*************************************************************************/
-    inline constexpr void setup(void) {
-        m_start_time   = 0.0;
-        m_elapsed_time = 0.0;
+    inline void setup(void) {
+        this->initialize();
     }
 
     /*************************************************************************/
     inline double clock(void) {
-        double now     = get_time();
-        m_elapsed_time = now - m_start_time;
+        const auto NOW = std::chrono::steady_clock::now();
+        m_elapsed_time =
+            std::chrono::duration<double>(NOW - m_start_time_point).count();
         return m_elapsed_time;
     }
 
     /*************************************************************************/
-    inline constexpr double start_time(void) const {
-        return m_start_time;
+    inline double cpu_clock(void) {
+        const auto NOW = std::clock();
+        m_elapsed_cpu_time =
+            static_cast<double>(NOW - m_start_cpu_clock) / CLOCKS_PER_SEC;
+        return m_elapsed_cpu_time;
     }
 
     /*************************************************************************/
     inline constexpr double elapsed_time(void) const {
         return m_elapsed_time;
     }
+
+    /*************************************************************************/
+    inline constexpr double elapsed_cpu_time(void) const {
+        return m_elapsed_cpu_time;
+    }
 };
 }  // namespace utility
 }  // namespace printemps
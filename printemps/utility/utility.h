@@ -15,6 +15,9 @@
 #include "time_keeper.h"
 #include "fixed_size_hash_map.h"
 #include "fixed_size_queue.h"
+#include "small_vector.h"
+#include "shared_set.h"
+#include "termination_signal_handler.h"
 
 #endif
 /*****************************************************************************/
@@ -0,0 +1,142 @@
+/*****************************************************************************/
+// Copyright (c) 2020 Yuji KOGUMA
+// Released under the MIT license
+// https://opensource.org/licenses/mit-license.php
+/*****************************************************************************/
+#include <gtest/gtest.h>
+#include <cstdio>
+#include <fstream>
+
+#include "../../application/printemps/utility/mps_utility.h"
+
+namespace {
+/*****************************************************************************/
+class TestMPSUtility : public ::testing::Test {
+   protected:
+    const std::string MPS_FILE_NAME = "test_mps_utility.mps";
+
+    virtual void SetUp(void) {
+        std::ofstream ofs(MPS_FILE_NAME.c_str());
+        ofs << "NAME TEST" << std::endl;
+        ofs << "ROWS" << std::endl;
+        ofs << " N obj" << std::endl;
+        ofs << " G c0" << std::endl;
+        ofs << " G c1" << std::endl;
+        ofs << " L c2" << std::endl;
+        ofs << "COLUMNS" << std::endl;
+        ofs << "    MARKER 'MARKER' 'INTORG'" << std::endl;
+        ofs << "    x0 obj 2 c0 1" << std::endl;
+        ofs << "    x1 obj 3 c0 1 c1 1" << std::endl;
+        ofs << "    x2 obj 4 c1 1 c2 1" << std::endl;
+        ofs << "    x3 obj 1 c2 1" << std::endl;
+        ofs << "    MARKER 'MARKER' 'INTEND'" << std::endl;
+        ofs << "RHS" << std::endl;
+        ofs << "    rhs c0 1 c1 1 c2 1" << std::endl;
+        ofs << "BOUNDS" << std::endl;
+        ofs << " UP bnd x0 1" << std::endl;
+        ofs << " UP bnd x1 1" << std::endl;
+        ofs << " UP bnd x2 1" << std::endl;
+        ofs << " UP bnd x3 1" << std::endl;
+        ofs << "ENDATA" << std::endl;
+    }
+    virtual void TearDown() {
+        std::remove(MPS_FILE_NAME.c_str());
+    }
+};
+
+/*****************************************************************************/
+TEST_F(TestMPSUtility, solve_mps_model) {
+    printemps::solver::Option option;
+    option.iteration_max                = 4;
+    option.verbose                      = printemps::solver::None;
+    option.tabu_search.iteration_max    = 20;
+    option.multi_start.number_of_chains = 2;
+    option.multi_start.number_of_rounds = 2;
+
+    std::unordered_map<std::string, int> initial_solution;
+
+    /// Single-start search
+    printemps::utility::MPSReader single_start_mps_reader;
+
+    auto &single_start_model =
+        single_start_mps_reader.create_model_from_mps(MPS_FILE_NAME, false,
+                                                      false);
+    single_start_model.set_name("test");
+
+    option.is_enabled_multi_start = false;
+    auto single_start_result      = printemps::utility::solve_mps_model(
+        &single_start_mps_reader, &single_start_model, option,
+        initial_solution, "");
+    auto single_start_summary = single_start_model.export_summary();
+
+    /// Multi-start search
+    printemps::utility::MPSReader multi_start_mps_reader;
+
+    auto &multi_start_model = multi_start_mps_reader.create_model_from_mps(
+        MPS_FILE_NAME, false, false);
+    multi_start_model.set_name("test");
+
+    option.is_enabled_multi_start = true;
+    auto multi_start_result       = printemps::utility::solve_mps_model(
+        &multi_start_mps_reader, &multi_start_model, option, initial_solution,
+        "");
+    auto multi_start_summary = multi_start_model.export_summary();
+
+    EXPECT_EQ(4, single_start_summary.number_of_variables);
+    EXPECT_EQ(3, single_start_summary.number_of_constraints);
+
+    EXPECT_EQ(single_start_summary.name, multi_start_summary.name);
+    EXPECT_EQ(single_start_summary.number_of_variables,
+              multi_start_summary.number_of_variables);
+    EXPECT_EQ(single_start_summary.number_of_constraints,
+              multi_start_summary.number_of_constraints);
+
+    EXPECT_EQ(true, single_start_result.solution.is_feasible());
+    EXPECT_EQ(true, multi_start_result.solution.is_feasible());
+}
+
+/*****************************************************************************/
+TEST_F(TestMPSUtility, solve_mps_model_with_checkpoint) {
+    const std::string CHECKPOINT_FILE_NAME = "test_mps_utility_checkpoint.bin";
+
+    printemps::solver::Option option;
+    option.iteration_max             = 2;
+    option.verbose                   = printemps::solver::None;
+    option.tabu_search.iteration_max = 20;
+    option.is_enabled_checkpoint     = true;
+    option.checkpoint_file_name      = CHECKPOINT_FILE_NAME;
+
+    std::unordered_map<std::string, int> initial_solution;
+
+    printemps::utility::MPSReader mps_reader;
+
+    auto &model = mps_reader.create_model_from_mps(MPS_FILE_NAME, false, false);
+    auto  result = printemps::utility::solve_mps_model(
+        &mps_reader, &model, option, initial_solution, "");
+
+    /**
+     * The search on the model built from the same MPS file is resumed from
+     * the checkpoint, even if the multi-start search is enabled.
+     */
+    printemps::utility::MPSReader resumed_mps_reader;
+
+    auto &resumed_model = resumed_mps_reader.create_model_from_mps(
+        MPS_FILE_NAME, false, false);
+
+    option.iteration_max          = 4;
+    option.is_enabled_multi_start = true;
+    auto resumed_result           = printemps::utility::solve_mps_model(
+        &resumed_mps_reader, &resumed_model, option, initial_solution,
+        CHECKPOINT_FILE_NAME);
+
+    EXPECT_EQ(true, resumed_model.is_solved());
+    EXPECT_LE(result.status.number_of_tabu_search_loops,
+              resumed_result.status.number_of_tabu_search_loops);
+    EXPECT_EQ(true, resumed_result.solution.is_feasible());
+
+    std::remove(CHECKPOINT_FILE_NAME.c_str());
+}
+}  // namespace
+/*****************************************************************************/
+// END
+/*****************************************************************************/
@@ -0,0 +1,230 @@
+/*****************************************************************************/
+// Copyright (c) 2020 Yuji KOGUMA
+// Released under the MIT license
+// https://opensource.org/licenses/mit-license.php
+/*****************************************************************************/
+#include <gtest/gtest.h>
+#include <printemps.h>
+
+namespace {
+/*****************************************************************************/
+class TestBinaryFlipEvaluator : public ::testing::Test {
+   protected:
+    virtual void SetUp(void) {
+        /// nothing to do
+    }
+    virtual void TearDown() {
+        /// nothing to do
+    }
+};
+
+/*****************************************************************************/
+TEST_F(TestBinaryFlipEvaluator, initialize) {
+    printemps::model::BinaryFlipEvaluator<int, double> evaluator;
+    EXPECT_EQ(0, evaluator.size());
+}
+
+/*****************************************************************************/
+TEST_F(TestBinaryFlipEvaluator, setup) {
+    printemps::model::Model<int, double> model;
+
+    auto& x = model.create_variables("x", 3, 0, 1);
+    model.create_constraint("g", x.sum() <= 1);
+    model.create_constraint("h", x(0) + x(1) == 1);
+    model.create_constraint("k", x(1) + x(2) >= 1);
+
+    model.categorize_variables();
+    model.categorize_constraints();
+    model.setup_is_enabled_fast_evaluation();
+    model.setup_constraint_matrix(false);
+
+    printemps::model::BinaryFlipEvaluator<int, double> evaluator;
+    evaluator.setup(model.constraint_matrix());
+    EXPECT_EQ(3, evaluator.size());
+    EXPECT_EQ(true, evaluator.is_setup());
+}
+
+/*****************************************************************************/
+TEST_F(TestBinaryFlipEvaluator, update_values) {
+    /// This method is tested in update_value().
+}
+
+/*****************************************************************************/
+TEST_F(TestBinaryFlipEvaluator, update_value) {
+    printemps::model::Model<int, double> model;
+
+    auto& x = model.create_variables("x", 3, 0, 1);
+    auto& g = model.create_constraint("g", x.sum() <= 1);
+    auto& h = model.create_constraint("h", x(0) + x(1) == 1);
+
+    g(0).local_penalty_coefficient()  = 100;
+    h(0).local_penalty_coefficient()  = 200;
+    g(0).global_penalty_coefficient() = 10000;
+    h(0).global_penalty_coefficient() = 20000;
+
+    model.setup_variable_related_constraints();
+    model.categorize_variables();
+    model.categorize_constraints();
+    model.setup_is_enabled_fast_evaluation();
+    model.setup_constraint_matrix(false);
+    model.update();
+
+    printemps::model::BinaryFlipEvaluator<int, double> evaluator;
+    evaluator.setup(model.constraint_matrix());
+
+    /**
+     * Change the solution and refresh the evaluator only for the changed
+     * constraints, which are all the constraints in this case.
+     */
+    x(0) = 1;
+    x(1) = 1;
+    model.update();
+    evaluator.update_value(0, &g(0));
+    evaluator.update_value(1, &h(0));
+
+    auto score_before = model.evaluate({});
+    for (auto i = 0; i < 3; i++) {
+        printemps::model::Move<int, double> move;
+        move.sense = printemps::model::MoveSense::Binary;
+        move.alterations.emplace_back(&x(i), 1 - x(i).value());
+        for (auto&& constraint_ptr : x(i).related_constraint_ptrs()) {
+            move.related_constraint_ptrs.insert(constraint_ptr);
+        }
+
+        auto expected = model.evaluate(move, score_before);
+
+        printemps::model::SolutionScore actual;
+        evaluator.evaluate(&actual, move, score_before,
+                           model.constraint_matrix());
+        EXPECT_EQ(expected.total_violation, actual.total_violation);
+        EXPECT_EQ(expected.local_penalty, actual.local_penalty);
+        EXPECT_EQ(expected.global_penalty, actual.global_penalty);
+    }
+
+    /**
+     * The same state is obtained by update_values().
+     */
+    printemps::model::BinaryFlipEvaluator<int, double> other_evaluator;
+    other_evaluator.setup(model.constraint_matrix());
+    x(2) = 1;
+    model.update();
+    evaluator.update_values(model.constraint_matrix());
+    other_evaluator.update_values(model.constraint_matrix());
+
+    printemps::model::Move<int, double> move;
+    move.sense = printemps::model::MoveSense::Binary;
+    move.alterations.emplace_back(&x(0), 0);
+    score_before = model.evaluate({});
+
+    printemps::model::SolutionScore actual;
+    printemps::model::SolutionScore other_actual;
+    evaluator.evaluate(&actual, move, score_before, model.constraint_matrix());
+    other_evaluator.evaluate(&other_actual, move, score_before,
+                             model.constraint_matrix());
+    EXPECT_EQ(other_actual.total_violation, actual.total_violation);
+    EXPECT_EQ(other_actual.local_penalty, actual.local_penalty);
+}
+
+/*****************************************************************************/
+TEST_F(TestBinaryFlipEvaluator, evaluate) {
+    printemps::model::Model<int, double> model;
+
+    auto sequence = printemps::utility::sequence(10);
+
+    auto& x = model.create_variables("x", 10, 0, 1);
+    auto& g = model.create_constraint("g", x.sum() <= 5);
+    auto& h = model.create_constraint("h", x(0) + x(1) == 1);
+    auto& k = model.create_constraint("k", 2 * x(2) - x(3) >= 1);
+    auto& l = model.create_constraint("l", x(4) + x(5) <= 1);
+
+    g(0).local_penalty_coefficient()  = 100;
+    h(0).local_penalty_coefficient()  = 200;
+    k(0).local_penalty_coefficient()  = 300;
+    l(0).local_penalty_coefficient()  = 400;
+    g(0).global_penalty_coefficient() = 10000;
+    h(0).global_penalty_coefficient() = 20000;
+    k(0).global_penalty_coefficient() = 30000;
+    l(0).global_penalty_coefficient() = 40000;
+    l(0).disable();
+
+    model.minimize(x.dot(sequence) + 1);
+
+    model.setup_variable_related_constraints();
+    model.categorize_variables();
+    model.categorize_constraints();
+    model.setup_fixed_sensitivities(false);
+    model.setup_is_enabled_fast_evaluation();
+    model.setup_constraint_matrix(false);
+
+    for (auto i = 0; i < 10; i++) {
+        x(i) = i % 3 == 0 ? 1 : 0;
+    }
+    model.update();
+    auto score_before = model.evaluate({});
+
+    printemps::model::BinaryFlipEvaluator<int, double> evaluator;
+    evaluator.setup(model.constraint_matrix());
+
+    for (auto i = 0; i < 10; i++) {
+        printemps::model::Move<int, double> move;
+        move.sense = printemps::model::MoveSense::Binary;
+        move.alterations.emplace_back(&x(i), 1 - x(i).value());
+        for (auto&& constraint_ptr : x(i).related_constraint_ptrs()) {
+            move.related_constraint_ptrs.insert(constraint_ptr);
+        }
+
+        auto expected = model.evaluate(move, score_before);
+
+        printemps::model::SolutionScore actual;
+        evaluator.evaluate(&actual, move, score_before,
+                           model.constraint_matrix());
+
+        EXPECT_EQ(expected.total_violation, actual.total_violation);
+        EXPECT_EQ(expected.local_penalty, actual.local_penalty);
+        EXPECT_EQ(expected.global_penalty, actual.global_penalty);
+        EXPECT_EQ(expected.is_feasible, actual.is_feasible);
+        EXPECT_EQ(expected.is_feasibility_improvable,
+                  actual.is_feasibility_improvable);
+    }
+}
+
+/*****************************************************************************/
+TEST_F(TestBinaryFlipEvaluator, is_applicable) {
+    printemps::model::Model<int, double> model;
+    auto& x = model.create_variables("x", 2, 0, 1);
+
+    printemps::model::Move<int, double> move;
+    move.sense = printemps::model::MoveSense::Binary;
+    move.alterations.emplace_back(&x(0), 1);
+    EXPECT_EQ(true,
+              (printemps::model::BinaryFlipEvaluator<int, double>::is_applicable(
+                  move)));
+
+    move.alterations.emplace_back(&x(1), 1);
+    EXPECT_EQ(false,
+              (printemps::model::BinaryFlipEvaluator<int, double>::is_applicable(
+                  move)));
+
+    printemps::model::Move<int, double> integer_move;
+    integer_move.sense = printemps::model::MoveSense::Integer;
+    integer_move.alterations.emplace_back(&x(0), 1);
+    EXPECT_EQ(false,
+              (printemps::model::BinaryFlipEvaluator<int, double>::is_applicable(
+                  integer_move)));
+}
+
+/*****************************************************************************/
+TEST_F(TestBinaryFlipEvaluator, size) {
+    /// This method is tested in initialize() and setup().
+}
+
+/*****************************************************************************/
+TEST_F(TestBinaryFlipEvaluator, is_setup) {
+    printemps::model::BinaryFlipEvaluator<int, double> evaluator;
+    EXPECT_EQ(false, evaluator.is_setup());
+    /// The other case is tested in setup().
+}
+}  // namespace
+/*****************************************************************************/
+// END
+/*****************************************************************************/
@@ -0,0 +1,327 @@
+/*****************************************************************************/
+// Copyright (c) 2020 Yuji KOGUMA
+// Released under the MIT license
+// https://opensource.org/licenses/mit-license.php
+/*****************************************************************************/
+#include <gtest/gtest.h>
+#include <map>
+#include <printemps.h>
+
+namespace {
+/*****************************************************************************/
+class TestConstraintMatrix : public ::testing::Test {
+   protected:
+    virtual void SetUp(void) {
+        /// nothing to do
+    }
+    virtual void TearDown() {
+        /// nothing to do
+    }
+};
+
+/*****************************************************************************/
+TEST_F(TestConstraintMatrix, initialize) {
+    printemps::model::ConstraintMatrix<int, double> matrix;
+
+    EXPECT_EQ(true, matrix.variable_ptrs().empty());
+    EXPECT_EQ(true, matrix.constraint_ptrs().empty());
+    EXPECT_EQ(true, matrix.row_begins().empty());
+    EXPECT_EQ(true, matrix.row_variable_indices().empty());
+    EXPECT_EQ(true, matrix.row_coefficients().empty());
+    EXPECT_EQ(true, matrix.column_begins().empty());
+    EXPECT_EQ(true, matrix.column_constraint_indices().empty());
+    EXPECT_EQ(true, matrix.column_coefficients().empty());
+    EXPECT_EQ(true, matrix.constants().empty());
+    EXPECT_EQ(true, matrix.objective_coefficients().empty());
+    EXPECT_EQ(false, matrix.is_enabled());
+    EXPECT_EQ(false, matrix.is_enabled_objective());
+}
+
+/*****************************************************************************/
+TEST_F(TestConstraintMatrix, setup) {
+    printemps::model::Model<int, double> model;
+
+    auto& x = model.create_variables("x", 3, 0, 1);
+    auto& g = model.create_constraint("g", x(0) + 2 * x(1) <= 1);
+    auto& h = model.create_constraint("h", 3 * x(1) - x(2) + 1 == 0);
+    model.minimize(4 * x(0) + 5 * x(2));
+
+    model.categorize_variables();
+    model.categorize_constraints();
+
+    printemps::model::ConstraintMatrix<int, double> matrix;
+    matrix.setup(model.variable_reference().variable_ptrs,
+                 model.constraint_reference().constraint_ptrs,
+                 &model.objective().expression());
+
+    EXPECT_EQ(true, matrix.is_enabled());
+    EXPECT_EQ(true, matrix.is_enabled_objective());
+    EXPECT_EQ(2, matrix.number_of_rows());
+    EXPECT_EQ(3, matrix.number_of_columns());
+    EXPECT_EQ(4, matrix.number_of_elements());
+
+    /// CSR
+    EXPECT_EQ(std::vector<int>({0, 2, 4}), matrix.row_begins());
+    EXPECT_EQ(std::vector<int>({0, 1, 1, 2}), matrix.row_variable_indices());
+    EXPECT_EQ(std::vector<double>({1, 2, 3, -1}), matrix.row_coefficients());
+    EXPECT_EQ(std::vector<double>({-1, 1}), matrix.constants());
+
+    /// CSC
+    EXPECT_EQ(std::vector<int>({0, 1, 3, 4}), matrix.column_begins());
+    EXPECT_EQ(std::vector<int>({0, 0, 1, 1}),
+              matrix.column_constraint_indices());
+    EXPECT_EQ(std::vector<double>({1, 2, 3, -1}),
+              matrix.column_coefficients());
+
+    /// Objective
+    EXPECT_EQ(std::vector<double>({4, 0, 5}), matrix.objective_coefficients());
+
+    EXPECT_EQ(&g(0), matrix.constraint_ptrs()[0]);
+    EXPECT_EQ(&h(0), matrix.constraint_ptrs()[1]);
+}
+
+/*****************************************************************************/
+TEST_F(TestConstraintMatrix, coefficient) {
+    printemps::model::Model<int, double> model;
+
+    auto& x = model.create_variables("x", 3, 0, 1);
+    model.create_constraint("g", x(0) + 2 * x(1) <= 1);
+    model.create_constraint("h", 3 * x(1) - x(2) + 1 == 0);
+
+    model.categorize_variables();
+    model.categorize_constraints();
+
+    printemps::model::ConstraintMatrix<int, double> matrix;
+    matrix.setup(model.variable_reference().variable_ptrs,
+                 model.constraint_reference().constraint_ptrs, nullptr);
+
+    EXPECT_EQ(false, matrix.is_enabled_objective());
+
+    EXPECT_EQ(1, matrix.coefficient(0, 0));
+    EXPECT_EQ(2, matrix.coefficient(0, 1));
+    EXPECT_EQ(0, matrix.coefficient(0, 2));
+    EXPECT_EQ(0, matrix.coefficient(1, 0));
+    EXPECT_EQ(3, matrix.coefficient(1, 1));
+    EXPECT_EQ(-1, matrix.coefficient(1, 2));
+}
+
+/*****************************************************************************/
+TEST_F(TestConstraintMatrix, has_element) {
+    printemps::model::Model<int, double> model;
+
+    auto& x = model.create_variables("x", 3, 0, 1);
+    model.create_constraint("g", x(0) + 2 * x(1) <= 1);
+    model.create_constraint("h", 3 * x(1) - x(2) + 1 == 0);
+
+    model.categorize_variables();
+    model.categorize_constraints();
+
+    printemps::model::ConstraintMatrix<int, double> matrix;
+    matrix.setup(model.variable_reference().variable_ptrs,
+                 model.constraint_reference().constraint_ptrs, nullptr);
+
+    EXPECT_EQ(true, matrix.has_element(0, 0));
+    EXPECT_EQ(true, matrix.has_element(0, 1));
+    EXPECT_EQ(false, matrix.has_element(0, 2));
+    EXPECT_EQ(false, matrix.has_element(1, 0));
+    EXPECT_EQ(true, matrix.has_element(1, 1));
+    EXPECT_EQ(true, matrix.has_element(1, 2));
+}
+
+/*****************************************************************************/
+TEST_F(TestConstraintMatrix, compute_row_value) {
+    printemps::model::Model<int, double> model;
+
+    auto& x = model.create_variables("x", 3, 0, 1);
+    model.create_constraint("g", x(0) + 2 * x(1) <= 1);
+    model.create_constraint("h", 3 * x(1) - x(2) + 1 == 0);
+
+    model.categorize_variables();
+    model.categorize_constraints();
+
+    printemps::model::ConstraintMatrix<int, double> matrix;
+    matrix.setup(model.variable_reference().variable_ptrs,
+                 model.constraint_reference().constraint_ptrs, nullptr);
+
+    x(0) = 1;
+    x(1) = 1;
+    x(2) = 0;
+
+    EXPECT_EQ(1 + 2 - 1, matrix.compute_row_value(0));
+    EXPECT_EQ(3 + 1, matrix.compute_row_value(1));
+}
+
+/*****************************************************************************/
+TEST_F(TestConstraintMatrix, compute_objective_difference) {
+    printemps::model::Model<int, double> model;
+
+    auto& x = model.create_variables("x", 3, 0, 1);
+    model.create_constraint("g", x(0) + 2 * x(1) <= 1);
+    model.minimize(4 * x(0) + 5 * x(2));
+
+    model.categorize_variables();
+    model.categorize_constraints();
+
+    printemps::model::ConstraintMatrix<int, double> matrix;
+    matrix.setup(model.variable_reference().variable_ptrs,
+                 model.constraint_reference().constraint_ptrs,
+                 &model.objective().expression());
+
+    x(0) = 1;
+
+    printemps::model::Move<int, double> move;
+    move.alterations.emplace_back(&x(0), 0);
+    move.alterations.emplace_back(&x(2), 1);
+
+    EXPECT_EQ(-4 + 5, matrix.compute_objective_difference(move));
+}
+
+/*****************************************************************************/
+TEST_F(TestConstraintMatrix, for_each_constraint_difference) {
+    printemps::model::Model<int, double> model;
+
+    auto& x = model.create_variables("x", 3, 0, 1);
+    model.create_constraint("g", x(0) + 2 * x(1) <= 1);
+    model.create_constraint("h", 3 * x(1) - x(2) + 1 == 0);
+
+    model.categorize_variables();
+    model.categorize_constraints();
+
+    printemps::model::ConstraintMatrix<int, double> matrix;
+    matrix.setup(model.variable_reference().variable_ptrs,
+                 model.constraint_reference().constraint_ptrs, nullptr);
+
+    x(0) = 1;
+
+    /// Single alteration
+    {
+        printemps::model::Move<int, double> move;
+        move.alterations.emplace_back(&x(1), 1);
+
+        std::vector<int>    indices;
+        std::vector<double> differences;
+        matrix.for_each_constraint_difference(
+            move, [&indices, &differences](const int    a_INDEX,
+                                           const double a_DIFFERENCE) {
+                indices.push_back(a_INDEX);
+                differences.push_back(a_DIFFERENCE);
+            });
+        EXPECT_EQ(std::vector<int>({0, 1}), indices);
+        EXPECT_EQ(std::vector<double>({2, 3}), differences);
+    }
+
+    /// Multiple alterations sharing a constraint
+    {
+        printemps::model::Move<int, double> move;
+        move.alterations.emplace_back(&x(0), 0);
+        move.alterations.emplace_back(&x(1), 1);
+        move.alterations.emplace_back(&x(2), 1);
+
+        std::vector<int>    indices;
+        std::vector<double> differences;
+        matrix.for_each_constraint_difference(
+            move, [&indices, &differences](const int    a_INDEX,
+                                           const double a_DIFFERENCE) {
+                indices.push_back(a_INDEX);
+                differences.push_back(a_DIFFERENCE);
+            });
+        EXPECT_EQ(std::vector<int>({0, 1}), indices);
+        EXPECT_EQ(std::vector<double>({-1 + 2, 3 - 1}), differences);
+    }
+
+    /// Multiple alterations in the reverse order of the variables
+    {
+        printemps::model::Move<int, double> move;
+        move.alterations.emplace_back(&x(2), 1);
+        move.alterations.emplace_back(&x(1), 1);
+        move.alterations.emplace_back(&x(0), 0);
+
+        std::vector<int>    indices;
+        std::vector<double> differences;
+        matrix.for_each_constraint_difference(
+            move, [&indices, &differences](const int    a_INDEX,
+                                           const double a_DIFFERENCE) {
+                indices.push_back(a_INDEX);
+                differences.push_back(a_DIFFERENCE);
+            });
+        EXPECT_EQ(std::vector<int>({0, 1}), indices);
+        EXPECT_EQ(std::vector<double>({2 - 1, -1 + 3}), differences);
+    }
+}
+
+/*****************************************************************************/
+TEST_F(TestConstraintMatrix, for_each_constraint_difference_by_coefficients) {
+    printemps::model::Model<int, double> model;
+
+    auto& x = model.create_variables("x", 3, 0, 1);
+    model.create_constraint("g", x(0) + 2 * x(1) <= 1);
+    model.create_constraint("h", 3 * x(1) - x(2) + 1 == 0);
+
+    model.setup_variable_related_constraints();
+    model.categorize_variables();
+    model.categorize_constraints();
+
+    printemps::model::ConstraintMatrix<int, double> matrix;
+    matrix.setup(model.variable_reference().variable_ptrs,
+                 model.constraint_reference().constraint_ptrs, nullptr);
+
+    x(0) = 1;
+
+    printemps::model::Move<int, double> move;
+    move.alterations.emplace_back(&x(2), 1);
+    move.alterations.emplace_back(&x(0), 0);
+    move.alterations.emplace_back(&x(1), 1);
+    move.coefficients = printemps::model::create_move_coefficients(
+        std::vector<printemps::model::Variable<int, double>*>(
+            {&x(2), &x(0), &x(1)}));
+
+    /// The differences must be the same as those without the coefficient
+    /// list, while the constraints are visited in the ascending order.
+    std::vector<int>    indices;
+    std::vector<double> differences;
+    matrix.for_each_constraint_difference(
+        move, [&indices, &differences](const int    a_INDEX,
+                                       const double a_DIFFERENCE) {
+            indices.push_back(a_INDEX);
+            differences.push_back(a_DIFFERENCE);
+        });
+    EXPECT_EQ(std::vector<int>({0, 1}), indices);
+    EXPECT_EQ(std::vector<double>({-1 + 2, -1 + 3}), differences);
+
+    auto move_without_coefficients = move;
+    move_without_coefficients.coefficients.reset();
+
+    std::map<int, double> expected_differences;
+    matrix.for_each_constraint_difference(
+        move_without_coefficients,
+        [&expected_differences](const int a_INDEX, const double a_DIFFERENCE) {
+            expected_differences[a_INDEX] = a_DIFFERENCE;
+        });
+    EXPECT_EQ(2, static_cast<int>(expected_differences.size()));
+    EXPECT_EQ(expected_differences[0], differences[0]);
+    EXPECT_EQ(expected_differences[1], differences[1]);
+}
+
+/*****************************************************************************/
+TEST_F(TestConstraintMatrix, constraint_ptrs) {
+    /// This method is tested in setup().
+}
+
+/*****************************************************************************/
+TEST_F(TestConstraintMatrix, variable_ptrs) {
+    /// This method is tested in setup().
+}
+
+/*****************************************************************************/
+TEST_F(TestConstraintMatrix, is_enabled) {
+    /// This method is tested in setup().
+}
+
+/*****************************************************************************/
+TEST_F(TestConstraintMatrix, is_enabled_objective) {
+    /// This method is tested in setup() and coefficient().
+}
+}  // namespace
+/*****************************************************************************/
+// END
+/*****************************************************************************/
\ No newline at end of file
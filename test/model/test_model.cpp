@@ -751,6 +751,10 @@ TEST_F(TestModel, setup_variable_related_constraints) {
     g(1)    = y.selection();
     g(2)    = x(0) + y.sum({0, printemps::model::All}) >= 1;
 
+    auto& p = model.create_expressions("p", 2);
+    p(0)    = x.sum();
+    p(1)    = x(0) + y(0, 0);
+
     model.setup_variable_related_constraints();
 
     for (auto i = 0; i < 10; i++) {
@@ -774,6 +778,25 @@ TEST_F(TestModel, setup_variable_related_constraints) {
                                   y(i, j).related_constraint_ptrs().end());
         }
     }
+
+    for (auto i = 0; i < 10; i++) {
+        EXPECT_EQ(true, x(i).related_expression_ptrs().find(&p(0)) !=
+                            x(i).related_expression_ptrs().end());
+        /// Only x(0) is related to p(1).
+        EXPECT_EQ(i == 0, x(i).related_expression_ptrs().find(&p(1)) !=
+                              x(i).related_expression_ptrs().end());
+    }
+
+    for (auto i = 0; i < 20; i++) {
+        for (auto j = 0; j < 30; j++) {
+            EXPECT_EQ(false, y(i, j).related_expression_ptrs().find(&p(0)) !=
+                                 y(i, j).related_expression_ptrs().end());
+            /// Only y(0,0) is related to p(1).
+            EXPECT_EQ(i == 0 && j == 0,
+                      y(i, j).related_expression_ptrs().find(&p(1)) !=
+                          y(i, j).related_expression_ptrs().end());
+        }
+    }
 }
 
 /*****************************************************************************/
@@ -1418,11 +1441,198 @@ TEST_F(TestModel, setup_neighborhood) {
     /// This method is tested in test_neighborhood.h
 }
 
+/*****************************************************************************/
+TEST_F(TestModel, setup_variable_state) {
+    printemps::model::Model<int, double> model;
+
+    auto& x = model.create_variables("x", 10, 0, 1);
+    model.create_constraint("g", x.sum() <= 5);
+
+    model.setup_variable_related_constraints();
+    model.categorize_variables();
+    model.categorize_constraints();
+    model.setup_variable_state();
+
+    EXPECT_EQ(true, model.variable_state().is_enabled());
+    EXPECT_EQ(10, model.variable_state().size());
+
+    /// The state is synchronized by update(move).
+    printemps::model::Move<int, double> move;
+    move.alterations.emplace_back(&x(3), 1);
+    model.update(move);
+    EXPECT_EQ(1, model.variable_state().values()[3]);
+
+    /// The state is synchronized by update().
+    x(3) = 0;
+    model.update();
+    EXPECT_EQ(0, model.variable_state().values()[3]);
+
+    /// The state is synchronized by the improvability updaters.
+    model.set_is_objective_improvable(&x(5), true);
+    EXPECT_EQ(true, x(5).is_objective_improvable());
+    EXPECT_EQ(1, model.variable_state().is_objective_improvable()[5]);
+    model.reset_variable_objective_improvability();
+    EXPECT_EQ(0, model.variable_state().is_objective_improvable()[5]);
+
+    model.set_is_feasibility_improvable(&x(7), true);
+    EXPECT_EQ(true, x(7).is_feasibility_improvable());
+    EXPECT_EQ(1, model.variable_state().is_feasibility_improvable()[7]);
+    model.reset_variable_feasibility_improvability();
+    EXPECT_EQ(0, model.variable_state().is_feasibility_improvable()[7]);
+}
+
 /*****************************************************************************/
 TEST_F(TestModel, setup_fixed_sensitivities) {
     /// This method is tested in test_expression.h
 }
 
+/*****************************************************************************/
+TEST_F(TestModel, setup_constraint_matrix) {
+    /// Constraint: linear
+    {
+        printemps::model::Model<int, double> model;
+
+        auto sequence = printemps::utility::sequence(10);
+
+        auto& x = model.create_variables("x", 10, 0, 1);
+        auto& g = model.create_constraint("g", x.sum() <= 5);
+        auto& h = model.create_constraint("h", x(0) + x(1) <= 1);
+
+        g(0).local_penalty_coefficient()  = 100;
+        h(0).local_penalty_coefficient()  = 100;
+        g(0).global_penalty_coefficient() = 10000;
+        h(0).global_penalty_coefficient() = 10000;
+
+        model.minimize(x.dot(sequence) + 1);
+
+        model.setup_variable_related_constraints();
+        model.categorize_variables();
+        model.categorize_constraints();
+        model.setup_fixed_sensitivities(false);
+        model.setup_is_enabled_fast_evaluation();
+        model.setup_constraint_matrix(false);
+
+        EXPECT_EQ(true, model.constraint_matrix().is_enabled());
+        EXPECT_EQ(true, model.constraint_matrix().is_enabled_objective());
+        EXPECT_EQ(10 + 2, model.constraint_matrix().number_of_elements());
+        EXPECT_EQ(0, g(0).global_index());
+        EXPECT_EQ(1, h(0).global_index());
+        for (auto i = 0; i < 10; i++) {
+            EXPECT_EQ(i, x(i).global_index());
+        }
+
+        for (auto&& element : x.flat_indexed_variables()) {
+            element = 1;
+        }
+        model.update();
+        EXPECT_EQ(5, g(0).constraint_value());
+        EXPECT_EQ(5, g(0).violation_value());
+        EXPECT_EQ(1, h(0).constraint_value());
+        EXPECT_EQ(1, h(0).violation_value());
+
+        auto score_before = model.evaluate({});
+
+        printemps::model::Move<int, double> move;
+        for (auto i = 0; i < 5; i++) {
+            move.alterations.emplace_back(&x(i), 0);
+            for (auto&& constraint_ptr : x(i).related_constraint_ptrs()) {
+                move.related_constraint_ptrs.insert(constraint_ptr);
+            }
+        }
+
+        auto score_after_0 = model.evaluate(move);
+        auto score_after_1 = model.evaluate(move, score_before);
+
+        EXPECT_EQ(score_after_0.objective, score_after_1.objective);
+        EXPECT_EQ(score_after_0.total_violation,
+                  score_after_1.total_violation);
+        EXPECT_EQ(score_after_0.local_penalty, score_after_1.local_penalty);
+        EXPECT_EQ(score_after_0.global_penalty, score_after_1.global_penalty);
+        EXPECT_EQ(score_after_0.is_feasibility_improvable,
+                  score_after_1.is_feasibility_improvable);
+        EXPECT_EQ(score_after_0.is_feasible, score_after_1.is_feasible);
+
+        model.update(move);
+        EXPECT_EQ(0, g(0).constraint_value());
+        EXPECT_EQ(0, g(0).violation_value());
+        EXPECT_EQ(-1, h(0).constraint_value());
+        EXPECT_EQ(0, h(0).violation_value());
+        EXPECT_EQ(0, g(0).expression().value());
+        EXPECT_EQ(-1, h(0).expression().value());
+        EXPECT_EQ(score_after_1.objective, model.objective().value());
+    }
+
+    /// Constraint: nonlinear (user-defined lambda)
+    {
+        printemps::model::Model<int, double> model;
+
+        auto& x = model.create_variable("x");
+
+        std::function<double(const printemps::model::Move<int, double>&)> g =
+            [&x](const printemps::model::Move<int, double>& a_MOVE) {
+                return x.evaluate(a_MOVE);
+            };
+
+        model.create_constraint("g", g <= 0);
+        model.minimize(x);
+
+        model.categorize_variables();
+        model.categorize_constraints();
+        model.setup_is_enabled_fast_evaluation();
+        model.setup_constraint_matrix(false);
+
+        EXPECT_EQ(false, model.constraint_matrix().is_enabled());
+    }
+}
+
+/*****************************************************************************/
+TEST_F(TestModel, setup_violative_constraint_set) {
+    printemps::model::Model<int, double> model;
+
+    auto& x = model.create_variables("x", 10, 0, 1);
+    auto& g = model.create_constraint("g", x.sum() <= 1);
+    auto& h = model.create_constraint("h", x(0) + x(1) >= 1);
+
+    model.setup_variable_related_constraints();
+    model.categorize_variables();
+    model.categorize_constraints();
+    model.setup_violative_constraint_set();
+
+    EXPECT_EQ(true, model.violative_constraint_set().is_enabled());
+
+    /// The set is synchronized by update().
+    model.update();
+    EXPECT_EQ(1, model.violative_constraint_set().size());
+    EXPECT_EQ(true, model.violative_constraint_set().contains(&h(0)));
+    EXPECT_EQ(false, model.is_feasible());
+
+    /// The set is synchronized by update(move).
+    {
+        printemps::model::Move<int, double> move;
+        move.alterations.emplace_back(&x(0), 1);
+        move.related_constraint_ptrs = {&g(0), &h(0)};
+        model.update(move);
+        EXPECT_EQ(true, model.violative_constraint_set().empty());
+        EXPECT_EQ(true, model.is_feasible());
+    }
+    {
+        printemps::model::Move<int, double> move;
+        move.alterations.emplace_back(&x(5), 1);
+        move.related_constraint_ptrs = {&g(0)};
+        model.update(move);
+        EXPECT_EQ(1, model.violative_constraint_set().size());
+        EXPECT_EQ(true, model.violative_constraint_set().contains(&g(0)));
+        EXPECT_EQ(false, model.is_feasible());
+    }
+
+    /// Only the violative constraint is scanned.
+    model.reset_variable_feasibility_improvability();
+    model.update_variable_feasibility_improvability();
+    for (auto i = 0; i < 10; i++) {
+        EXPECT_EQ(i == 0 || i == 5, x(i).is_feasibility_improvable());
+    }
+}
+
 /*****************************************************************************/
 TEST_F(TestModel, set_callback) {
     printemps::model::Model<int, double> model;
@@ -1478,6 +1688,41 @@ TEST_F(TestModel, import_variable_values) {
     }
 }
 
+/*****************************************************************************/
+TEST_F(TestModel, import_variable_values_arg_values) {
+    printemps::model::Model<int, double> model;
+
+    auto& x = model.create_variable("x");
+    auto& y = model.create_variables("y", 10);
+    auto& z = model.create_variables("z", {10, 10});
+    model.categorize_variables();
+
+    std::vector<int> values;
+    values.push_back(1);
+    for (auto i = 0; i < 10; i++) {
+        values.push_back(10 * i);
+    }
+    for (auto i = 0; i < 10; i++) {
+        for (auto j = 0; j < 10; j++) {
+            values.push_back(100 * (i + j));
+        }
+    }
+
+    model.import_variable_values(values);
+
+    EXPECT_EQ(1, x.value());
+
+    for (auto i = 0; i < 10; i++) {
+        EXPECT_EQ(10 * i, y(i).value());
+    }
+
+    for (auto i = 0; i < 10; i++) {
+        for (auto j = 0; j < 10; j++) {
+            EXPECT_EQ(100 * (i + j), z(i, j).value());
+        }
+    }
+}
+
 /*****************************************************************************/
 TEST_F(TestModel, update_arg_void) {
     printemps::model::Model<int, double> model;
@@ -1516,6 +1761,7 @@ TEST_F(TestModel, update_arg_move) {
     model.categorize_variables();
     model.categorize_constraints();
     model.extract_selections(printemps::model::SelectionMode::Defined);
+    model.setup_variable_related_constraints();
     model.setup_fixed_sensitivities(false);
 
     model.update();
@@ -2247,6 +2493,117 @@ TEST_F(TestModel, evaluate) {
     }
 }
 
+/*****************************************************************************/
+TEST_F(TestModel, evaluate_objective) {
+    /// This method is tested in evaluate() and evaluate_binary_flip().
+}
+
+/*****************************************************************************/
+TEST_F(TestModel, setup_binary_flip_evaluation) {
+    /// This method is tested in evaluate_binary_flip().
+}
+
+/*****************************************************************************/
+TEST_F(TestModel, evaluate_binary_flip) {
+    printemps::model::Model<int, double> model;
+
+    auto sequence = printemps::utility::sequence(10);
+
+    auto& x = model.create_variables("x", 10, 0, 1);
+    auto& g = model.create_constraint("g", x.sum() <= 5);
+    auto& h = model.create_constraint("h", x(0) + x(1) <= 1);
+
+    g(0).local_penalty_coefficient()  = 100;
+    h(0).local_penalty_coefficient()  = 100;
+    g(0).global_penalty_coefficient() = 10000;
+    h(0).global_penalty_coefficient() = 10000;
+
+    model.minimize(x.dot(sequence) + 1);
+
+    model.setup_variable_related_constraints();
+    model.categorize_variables();
+    model.categorize_constraints();
+    model.setup_fixed_sensitivities(false);
+    model.setup_is_enabled_fast_evaluation();
+    model.setup_constraint_matrix(false);
+    EXPECT_EQ(true, model.is_enabled_binary_flip_evaluation());
+
+    for (auto&& element : x.flat_indexed_variables()) {
+        element = 1;
+    }
+    model.update();
+    auto score_before = model.evaluate({});
+    model.setup_binary_flip_evaluation();
+
+    for (auto i = 0; i < 10; i++) {
+        printemps::model::Move<int, double> move;
+        move.sense = printemps::model::MoveSense::Binary;
+        move.alterations.emplace_back(&x(i), 0);
+        for (auto&& constraint_ptr : x(i).related_constraint_ptrs()) {
+            move.related_constraint_ptrs.insert(constraint_ptr);
+        }
+
+        auto expected = model.evaluate(move, score_before);
+
+        printemps::model::SolutionScore actual;
+        model.evaluate_binary_flip(&actual, move, score_before);
+
+        EXPECT_EQ(expected.objective, actual.objective);
+        EXPECT_EQ(expected.objective_improvement, actual.objective_improvement);
+        EXPECT_EQ(expected.total_violation, actual.total_violation);
+        EXPECT_EQ(expected.local_penalty, actual.local_penalty);
+        EXPECT_EQ(expected.global_penalty, actual.global_penalty);
+        EXPECT_EQ(expected.local_augmented_objective,
+                  actual.local_augmented_objective);
+        EXPECT_EQ(expected.global_augmented_objective,
+                  actual.global_augmented_objective);
+        EXPECT_EQ(expected.is_feasible, actual.is_feasible);
+        EXPECT_EQ(expected.is_objective_improvable,
+                  actual.is_objective_improvable);
+        EXPECT_EQ(expected.is_feasibility_improvable,
+                  actual.is_feasibility_improvable);
+    }
+
+    /**
+     * The evaluator is kept up to date by update() without calling
+     * setup_binary_flip_evaluation() again.
+     */
+    for (auto i = 0; i < 10; i++) {
+        printemps::model::Move<int, double> move;
+        move.sense = printemps::model::MoveSense::Binary;
+        move.alterations.emplace_back(&x(i), 1 - x(i).value());
+        for (auto&& constraint_ptr : x(i).related_constraint_ptrs()) {
+            move.related_constraint_ptrs.insert(constraint_ptr);
+        }
+        model.update(move);
+        score_before = model.evaluate({});
+
+        for (auto j = 0; j < 10; j++) {
+            printemps::model::Move<int, double> trial_move;
+            trial_move.sense = printemps::model::MoveSense::Binary;
+            trial_move.alterations.emplace_back(&x(j), 1 - x(j).value());
+            for (auto&& constraint_ptr : x(j).related_constraint_ptrs()) {
+                trial_move.related_constraint_ptrs.insert(constraint_ptr);
+            }
+
+            auto expected = model.evaluate(trial_move, score_before);
+
+            printemps::model::SolutionScore actual;
+            model.evaluate_binary_flip(&actual, trial_move, score_before);
+            EXPECT_EQ(expected.total_violation, actual.total_violation);
+            EXPECT_EQ(expected.local_penalty, actual.local_penalty);
+            EXPECT_EQ(expected.global_penalty, actual.global_penalty);
+            EXPECT_EQ(expected.is_feasibility_improvable,
+                      actual.is_feasibility_improvable);
+        }
+    }
+}
+
+/*****************************************************************************/
+TEST_F(TestModel, is_enabled_binary_flip_evaluation) {
+    /// This method is tested in evaluate_binary_flip().
+}
+
 /*****************************************************************************/
 TEST_F(TestModel, compute_lagrangian) {
     printemps::model::Model<int, double> model;
@@ -2732,6 +3089,68 @@ TEST_F(TestModel, export_plain_solution) {
     }
 }
 
+/*****************************************************************************/
+TEST_F(TestModel, export_compact_solution) {
+    printemps::model::Model<int, double> model;
+
+    auto& x = model.create_variable("x");
+    auto& y = model.create_variables("y", 10);
+    auto& g = model.create_constraints("g", 10);
+
+    for (auto i = 0; i < 10; i++) {
+        g(i) = x + y(i) <= i;
+    }
+    model.minimize(random_integer() * x.sum() + random_integer() * y.sum());
+
+    x = random_integer();
+    for (auto i = 0; i < 10; i++) {
+        y(i) = random_integer();
+    }
+
+    model.categorize_variables();
+    model.categorize_constraints();
+    model.update();
+
+    auto compact_solution = model.export_compact_solution();
+    EXPECT_EQ(model.objective().value(), compact_solution.objective);
+    EXPECT_EQ(model.is_feasible(), compact_solution.is_feasible);
+    EXPECT_EQ(11, static_cast<int>(compact_solution.variables.size()));
+    EXPECT_EQ(10, static_cast<int>(compact_solution.violations.size()));
+
+    EXPECT_EQ(x.value(), compact_solution.variables[x(0).global_index()]);
+
+    double total_violation = 0.0;
+    for (auto i = 0; i < 10; i++) {
+        EXPECT_EQ(y(i).value(),
+                  compact_solution.variables[y(i).global_index()]);
+        EXPECT_EQ(g(i).violation_value(),
+                  compact_solution.violations[g(i).global_index()]);
+        total_violation += g(i).violation_value();
+    }
+    EXPECT_EQ(total_violation, compact_solution.total_violation);
+
+    /// The violations are not stored, and the total violation and the
+    /// feasibility are taken from the score.
+    printemps::model::SolutionScore score;
+    score.total_violation = 123.0;
+    score.is_feasible     = true;
+
+    auto compact_solution_without_violations =
+        model.export_compact_solution(score);
+    EXPECT_EQ(compact_solution.variables,
+              compact_solution_without_violations.variables);
+    EXPECT_EQ(true, compact_solution_without_violations.violations.empty());
+    EXPECT_EQ(model.objective().value(),
+              compact_solution_without_violations.objective);
+    EXPECT_EQ(123.0, compact_solution_without_violations.total_violation);
+    EXPECT_EQ(true, compact_solution_without_violations.is_feasible);
+}
+
+/*****************************************************************************/
+TEST_F(TestModel, export_variable_values) {
+    /// This method is tested in export_compact_solution().
+}
+
 /*****************************************************************************/
 TEST_F(TestModel, convert_to_plain_solution) {
     printemps::model::Model<int, double> model;
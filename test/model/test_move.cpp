@@ -149,6 +149,61 @@ TEST_F(TestMove, compute_hash) {
     }
 }
 
+/*****************************************************************************/
+TEST_F(TestMove, create_move_coefficients) {
+    printemps::model::Model<int, double> model;
+
+    auto& x = model.create_variable("x", 0, 10);
+    auto& y = model.create_variable("y", 0, 10);
+    auto& z = model.create_variable("z", 0, 10);
+
+    model.create_constraint("g", 2 * x + 3 * y <= 10);
+    model.create_constraint("h", 4 * y + 5 * z <= 10);
+
+    model.setup_variable_related_constraints();
+    model.categorize_variables();
+    model.categorize_constraints();
+
+    /// Linear constraints
+    {
+        auto coefficients = printemps::model::create_move_coefficients(
+            std::vector<printemps::model::Variable<int, double>*>(
+                {&y(0), &x(0)}));
+        EXPECT_EQ(3, static_cast<int>(coefficients->size()));
+
+        EXPECT_EQ(0, (*coefficients)[0].constraint_index);
+        EXPECT_EQ(0, (*coefficients)[0].alteration_index);
+        EXPECT_EQ(3, (*coefficients)[0].coefficient);
+
+        EXPECT_EQ(0, (*coefficients)[1].constraint_index);
+        EXPECT_EQ(1, (*coefficients)[1].alteration_index);
+        EXPECT_EQ(2, (*coefficients)[1].coefficient);
+
+        EXPECT_EQ(1, (*coefficients)[2].constraint_index);
+        EXPECT_EQ(0, (*coefficients)[2].alteration_index);
+        EXPECT_EQ(4, (*coefficients)[2].coefficient);
+    }
+
+    /// Nonlinear constraint
+    {
+        std::function<double(const printemps::model::Move<int, double>&)> f =
+            [&z](const printemps::model::Move<int, double>& a_MOVE) {
+                static_cast<void>(a_MOVE);
+                return z.value() * z.value();
+            };
+        auto& v = model.create_constraint("v", f <= 10);
+        model.categorize_constraints();
+
+        /// The nonlinear constraint is registered manually since it has no
+        /// sensitivities.
+        z(0).register_related_constraint_ptr(&v(0));
+
+        auto coefficients = printemps::model::create_move_coefficients(
+            std::vector<printemps::model::Variable<int, double>*>({&z(0)}));
+        EXPECT_EQ(nullptr, coefficients);
+    }
+}
+
 /*****************************************************************************/
 TEST_F(TestMove, operator_plus) {
     printemps::model::Model<int, double> model;
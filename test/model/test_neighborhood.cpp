@@ -56,6 +56,8 @@ TEST_F(TestNeighborhood, initialize) {
     EXPECT_EQ(false, neighborhood.is_enabled_user_defined_move());
     EXPECT_EQ(false, neighborhood.is_enabled_selection_move());
 
+    EXPECT_EQ(0, neighborhood.parallel_size_threshold());
+
     /// Tests for updater functions are omitted.
 }
 
@@ -83,6 +85,18 @@ TEST_F(TestNeighborhood, set_has_selection_variables) {
     EXPECT_EQ(false, neighborhood.has_selection_variables());
 }
 
+/*****************************************************************************/
+TEST_F(TestNeighborhood, set_parallel_size_threshold) {
+    printemps::model::Neighborhood<int, double> neighborhood;
+    neighborhood.set_parallel_size_threshold(100);
+    EXPECT_EQ(100, neighborhood.parallel_size_threshold());
+}
+
+/*****************************************************************************/
+TEST_F(TestNeighborhood, parallel_size_threshold) {
+    /// This method is tested in set_parallel_size_threshold().
+}
+
 /*****************************************************************************/
 TEST_F(TestNeighborhood, setup_move_updater) {
     printemps::model::Model<int, double> model;
@@ -909,6 +923,36 @@ TEST_F(TestNeighborhood, is_enabled_special_neighborhood_move) {
     EXPECT_EQ(false, neighborhood.is_enabled_special_neighborhood_move());
 }
 
+/*****************************************************************************/
+TEST_F(TestNeighborhood, number_of_enabled_moves) {
+    printemps::model::Model<int, double> model;
+
+    auto& x = model.create_variables("x", 10, 0, 1);
+    auto& y = model.create_variables("y", 5, -10, 10);
+    model.create_constraint("c_0", x.sum() + y.sum() <= 10);
+
+    model.categorize_variables();
+    model.categorize_constraints();
+    model.setup_neighborhood(false, false, false, false, false, false, false);
+
+    auto& neighborhood = model.neighborhood();
+    EXPECT_EQ(0, neighborhood.number_of_enabled_moves());
+
+    const int BINARY_MOVES_SIZE  = neighborhood.binary_moves().size();
+    const int INTEGER_MOVES_SIZE = neighborhood.integer_moves().size();
+    EXPECT_EQ(10, BINARY_MOVES_SIZE);
+
+    neighborhood.enable_binary_move();
+    EXPECT_EQ(BINARY_MOVES_SIZE, neighborhood.number_of_enabled_moves());
+
+    neighborhood.enable_integer_move();
+    EXPECT_EQ(BINARY_MOVES_SIZE + INTEGER_MOVES_SIZE,
+              neighborhood.number_of_enabled_moves());
+
+    neighborhood.disable_binary_move();
+    EXPECT_EQ(INTEGER_MOVES_SIZE, neighborhood.number_of_enabled_moves());
+}
+
 /*****************************************************************************/
 }  // namespace
 /*****************************************************************************/
@@ -55,6 +55,7 @@ TEST_F(TestVariable, initialize) {
     EXPECT_EQ(nullptr, variable.selection_ptr());
     EXPECT_EQ(true, variable.related_constraint_ptrs().empty());
     EXPECT_EQ(true, variable.related_monic_constraint_ptrs().empty());
+    EXPECT_EQ(true, variable.related_expression_ptrs().empty());
     EXPECT_EQ(true, variable.constraint_sensitivities().empty());
     EXPECT_EQ(0.0, variable.objective_sensitivity());
 }
@@ -349,6 +350,43 @@ TEST_F(TestVariable, related_constraint_ptrs) {
     /// This method is tested in register_related_constraint_ptr().
 }
 
+/*****************************************************************************/
+TEST_F(TestVariable, register_related_expression_ptr) {
+    auto variable = printemps::model::Variable<int, double>::create_instance();
+    auto expression_0 =
+        printemps::model::Expression<int, double>::create_instance();
+    auto expression_1 =
+        printemps::model::Expression<int, double>::create_instance();
+
+    EXPECT_EQ(true, variable.related_expression_ptrs().empty());
+
+    variable.register_related_expression_ptr(&expression_0);
+    EXPECT_EQ(1, static_cast<int>(variable.related_expression_ptrs().size()));
+    EXPECT_EQ(true, variable.related_expression_ptrs().find(&expression_0) !=
+                        variable.related_expression_ptrs().end());
+    EXPECT_EQ(false, variable.related_expression_ptrs().find(&expression_1) !=
+                         variable.related_expression_ptrs().end());
+
+    variable.register_related_expression_ptr(&expression_1);
+    variable.register_related_expression_ptr(&expression_1);
+    EXPECT_EQ(2, static_cast<int>(variable.related_expression_ptrs().size()));
+    EXPECT_EQ(true, variable.related_expression_ptrs().find(&expression_1) !=
+                        variable.related_expression_ptrs().end());
+
+    variable.reset_related_expression_ptrs();
+    EXPECT_EQ(true, variable.related_expression_ptrs().empty());
+}
+
+/*****************************************************************************/
+TEST_F(TestVariable, reset_related_expression_ptrs) {
+    /// This method is tested in register_related_expression_ptr().
+}
+
+/*****************************************************************************/
+TEST_F(TestVariable, related_expression_ptrs) {
+    /// This method is tested in register_related_expression_ptr().
+}
+
 /*****************************************************************************/
 TEST_F(TestVariable, setup_related_monic_constraint_ptrs) {
     /// This method is tested in
@@ -0,0 +1,187 @@
+/*****************************************************************************/
+// Copyright (c) 2020 Yuji KOGUMA
+// Released under the MIT license
+// https://opensource.org/licenses/mit-license.php
+/*****************************************************************************/
+#include <gtest/gtest.h>
+#include <printemps.h>
+
+namespace {
+/*****************************************************************************/
+class TestVariableState : public ::testing::Test {
+   protected:
+    virtual void SetUp(void) {
+        /// nothing to do
+    }
+    virtual void TearDown() {
+        /// nothing to do
+    }
+};
+
+/*****************************************************************************/
+TEST_F(TestVariableState, initialize) {
+    printemps::model::VariableState<int, double> state;
+
+    EXPECT_EQ(true, state.variable_ptrs().empty());
+    EXPECT_EQ(true, state.values().empty());
+    EXPECT_EQ(true, state.lower_bounds().empty());
+    EXPECT_EQ(true, state.upper_bounds().empty());
+    EXPECT_EQ(true, state.senses().empty());
+    EXPECT_EQ(true, state.is_fixed().empty());
+    EXPECT_EQ(true, state.is_objective_improvable().empty());
+    EXPECT_EQ(true, state.is_feasibility_improvable().empty());
+    EXPECT_EQ(0, state.size());
+    EXPECT_EQ(false, state.is_enabled());
+}
+
+/*****************************************************************************/
+TEST_F(TestVariableState, setup) {
+    printemps::model::Model<int, double> model;
+
+    auto& x = model.create_variables("x", 2, 0, 1);
+    auto& y = model.create_variable("y", -10, 10);
+
+    x(0) = 1;
+    x(1).fix_by(0);
+    y(0) = 5;
+    y(0).set_is_objective_improvable(true);
+    x(0).set_is_feasibility_improvable(true);
+
+    model.categorize_variables();
+
+    printemps::model::VariableState<int, double> state;
+    state.setup(model.variable_reference().variable_ptrs);
+
+    EXPECT_EQ(3, state.size());
+    EXPECT_EQ(true, state.is_enabled());
+    EXPECT_EQ(std::vector<int>({1, 0, 5}), state.values());
+    EXPECT_EQ(std::vector<int>({0, 0, -10}), state.lower_bounds());
+    EXPECT_EQ(std::vector<int>({1, 1, 10}), state.upper_bounds());
+    EXPECT_EQ(printemps::model::VariableSense::Binary, state.senses()[0]);
+    EXPECT_EQ(printemps::model::VariableSense::Integer, state.senses()[2]);
+    EXPECT_EQ(std::vector<std::uint8_t>({0, 1, 0}), state.is_fixed());
+    EXPECT_EQ(std::vector<std::uint8_t>({0, 0, 1}),
+              state.is_objective_improvable());
+    EXPECT_EQ(std::vector<std::uint8_t>({1, 0, 0}),
+              state.is_feasibility_improvable());
+}
+
+/*****************************************************************************/
+TEST_F(TestVariableState, update_arg_void) {
+    printemps::model::Model<int, double> model;
+
+    auto& x = model.create_variables("x", 2, 0, 1);
+    model.categorize_variables();
+
+    printemps::model::VariableState<int, double> state;
+    state.setup(model.variable_reference().variable_ptrs);
+    EXPECT_EQ(std::vector<int>({0, 0}), state.values());
+
+    x(0) = 1;
+    x(1).set_is_objective_improvable(true);
+    state.update();
+    EXPECT_EQ(std::vector<int>({1, 0}), state.values());
+    EXPECT_EQ(std::vector<std::uint8_t>({0, 1}),
+              state.is_objective_improvable());
+}
+
+/*****************************************************************************/
+TEST_F(TestVariableState, update_arg_move) {
+    printemps::model::Model<int, double> model;
+
+    auto& x = model.create_variables("x", 2, 0, 1);
+    model.categorize_variables();
+
+    printemps::model::VariableState<int, double> state;
+    state.setup(model.variable_reference().variable_ptrs);
+
+    printemps::model::Move<int, double> move;
+    move.alterations.emplace_back(&x(1), 1);
+    x(1) = 1;
+    state.update(move);
+    EXPECT_EQ(std::vector<int>({0, 1}), state.values());
+}
+
+/*****************************************************************************/
+TEST_F(TestVariableState, set_is_objective_improvable) {
+    printemps::model::Model<int, double> model;
+
+    model.create_variables("x", 2, 0, 1);
+    model.categorize_variables();
+
+    printemps::model::VariableState<int, double> state;
+    state.setup(model.variable_reference().variable_ptrs);
+
+    state.set_is_objective_improvable(1, true);
+    EXPECT_EQ(std::vector<std::uint8_t>({0, 1}),
+              state.is_objective_improvable());
+}
+
+/*****************************************************************************/
+TEST_F(TestVariableState, set_is_feasibility_improvable) {
+    printemps::model::Model<int, double> model;
+
+    model.create_variables("x", 2, 0, 1);
+    model.categorize_variables();
+
+    printemps::model::VariableState<int, double> state;
+    state.setup(model.variable_reference().variable_ptrs);
+
+    state.set_is_feasibility_improvable(0, true);
+    EXPECT_EQ(std::vector<std::uint8_t>({1, 0}),
+              state.is_feasibility_improvable());
+}
+
+/*****************************************************************************/
+TEST_F(TestVariableState, variable_ptrs) {
+    /// This method is tested in setup().
+}
+
+/*****************************************************************************/
+TEST_F(TestVariableState, values) {
+    /// This method is tested in setup().
+}
+
+/*****************************************************************************/
+TEST_F(TestVariableState, lower_bounds) {
+    /// This method is tested in setup().
+}
+
+/*****************************************************************************/
+TEST_F(TestVariableState, upper_bounds) {
+    /// This method is tested in setup().
+}
+
+/*****************************************************************************/
+TEST_F(TestVariableState, senses) {
+    /// This method is tested in setup().
+}
+
+/*****************************************************************************/
+TEST_F(TestVariableState, is_fixed) {
+    /// This method is tested in setup().
+}
+
+/*****************************************************************************/
+TEST_F(TestVariableState, is_objective_improvable) {
+    /// This method is tested in setup().
+}
+
+/*****************************************************************************/
+TEST_F(TestVariableState, is_feasibility_improvable) {
+    /// This method is tested in setup().
+}
+
+/*****************************************************************************/
+TEST_F(TestVariableState, size) {
+    /// This method is tested in setup().
+}
+
+/*****************************************************************************/
+TEST_F(TestVariableState, is_enabled) {
+    /// This method is tested in setup().
+}
+}  // namespace
+/*****************************************************************************/
+// END
+/*****************************************************************************/
\ No newline at end of file
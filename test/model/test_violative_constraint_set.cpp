@@ -0,0 +1,151 @@
+/*****************************************************************************/
+// Copyright (c) 2020 Yuji KOGUMA
+// Released under the MIT license
+// https://opensource.org/licenses/mit-license.php
+/*****************************************************************************/
+#include <gtest/gtest.h>
+#include <printemps.h>
+
+namespace {
+/*****************************************************************************/
+class TestViolativeConstraintSet : public ::testing::Test {
+   protected:
+    virtual void SetUp(void) {
+        /// nothing to do
+    }
+    virtual void TearDown() {
+        /// nothing to do
+    }
+};
+
+/*****************************************************************************/
+TEST_F(TestViolativeConstraintSet, initialize) {
+    printemps::model::ViolativeConstraintSet<int, double> set;
+
+    EXPECT_EQ(true, set.constraint_ptrs().empty());
+    EXPECT_EQ(0, set.size());
+    EXPECT_EQ(true, set.empty());
+    EXPECT_EQ(false, set.is_enabled());
+}
+
+/*****************************************************************************/
+TEST_F(TestViolativeConstraintSet, setup) {
+    printemps::model::Model<int, double> model;
+
+    auto& x = model.create_variables("x", 3, 0, 1);
+    auto& g = model.create_constraints("g", 3);
+    g(0)    = x(0) >= 1;
+    g(1)    = x(1) >= 1;
+    g(2)    = x(2) <= 0;
+
+    x(1) = 1;
+    model.categorize_variables();
+    model.categorize_constraints();
+    model.update();
+
+    printemps::model::ViolativeConstraintSet<int, double> set;
+    set.setup(model.constraint_reference().constraint_ptrs);
+
+    EXPECT_EQ(true, set.is_enabled());
+    EXPECT_EQ(1, set.size());
+    EXPECT_EQ(false, set.empty());
+    EXPECT_EQ(true, set.contains(&g(0)));
+    EXPECT_EQ(false, set.contains(&g(1)));
+    EXPECT_EQ(false, set.contains(&g(2)));
+    EXPECT_EQ(&g(0), set.constraint_ptrs().front());
+}
+
+/*****************************************************************************/
+TEST_F(TestViolativeConstraintSet, update_arg_void) {
+    printemps::model::Model<int, double> model;
+
+    auto& x = model.create_variables("x", 3, 0, 1);
+    auto& g = model.create_constraints("g", 3);
+    g(0)    = x(0) >= 1;
+    g(1)    = x(1) >= 1;
+    g(2)    = x(2) >= 1;
+
+    model.categorize_variables();
+    model.categorize_constraints();
+    model.update();
+
+    printemps::model::ViolativeConstraintSet<int, double> set;
+    set.setup(model.constraint_reference().constraint_ptrs);
+    EXPECT_EQ(3, set.size());
+
+    x(0) = 1;
+    x(2) = 1;
+    model.update();
+    set.update();
+    EXPECT_EQ(1, set.size());
+    EXPECT_EQ(true, set.contains(&g(1)));
+}
+
+/*****************************************************************************/
+TEST_F(TestViolativeConstraintSet, update_arg_constraint_ptr) {
+    printemps::model::Model<int, double> model;
+
+    auto& x = model.create_variables("x", 3, 0, 1);
+    auto& g = model.create_constraints("g", 3);
+    g(0)    = x(0) >= 1;
+    g(1)    = x(1) >= 1;
+    g(2)    = x(2) >= 1;
+
+    model.categorize_variables();
+    model.categorize_constraints();
+    model.update();
+
+    printemps::model::ViolativeConstraintSet<int, double> set;
+    set.setup(model.constraint_reference().constraint_ptrs);
+
+    /// Remove the first member, which is replaced with the last one.
+    x(0) = 1;
+    g(0).update();
+    set.update(&g(0));
+    EXPECT_EQ(2, set.size());
+    EXPECT_EQ(false, set.contains(&g(0)));
+    EXPECT_EQ(true, set.contains(&g(1)));
+    EXPECT_EQ(true, set.contains(&g(2)));
+    EXPECT_EQ(&g(2), set.constraint_ptrs()[0]);
+    EXPECT_EQ(&g(1), set.constraint_ptrs()[1]);
+
+    /// Updating an unchanged constraint does nothing.
+    set.update(&g(1));
+    EXPECT_EQ(2, set.size());
+
+    /// Insert the removed member again.
+    x(0) = 0;
+    g(0).update();
+    set.update(&g(0));
+    EXPECT_EQ(3, set.size());
+    EXPECT_EQ(&g(0), set.constraint_ptrs()[2]);
+}
+
+/*****************************************************************************/
+TEST_F(TestViolativeConstraintSet, contains) {
+    /// This method is tested in setup() and update_arg_constraint_ptr().
+}
+
+/*****************************************************************************/
+TEST_F(TestViolativeConstraintSet, constraint_ptrs) {
+    /// This method is tested in setup() and update_arg_constraint_ptr().
+}
+
+/*****************************************************************************/
+TEST_F(TestViolativeConstraintSet, size) {
+    /// This method is tested in setup().
+}
+
+/*****************************************************************************/
+TEST_F(TestViolativeConstraintSet, empty) {
+    /// This method is tested in setup().
+}
+
+/*****************************************************************************/
+TEST_F(TestViolativeConstraintSet, is_enabled) {
+    /// This method is tested in setup().
+}
+}  // namespace
+/*****************************************************************************/
+// END
+/*****************************************************************************/
@@ -0,0 +1,537 @@
+/*****************************************************************************/
+// Copyright (c) 2020 Yuji KOGUMA
+// Released under the MIT license
+// https://opensource.org/licenses/mit-license.php
+/*****************************************************************************/
+#include <gtest/gtest.h>
+#include <csignal>
+#include <cstdio>
+#include <fstream>
+#include <iterator>
+#include <random>
+#include <printemps.h>
+
+namespace {
+/*****************************************************************************/
+class TestCheckpoint : public ::testing::Test {
+   protected:
+    virtual void SetUp(void) {
+        /// nothing to do
+    }
+    virtual void TearDown() {
+        /// nothing to do
+    }
+
+    /*************************************************************************/
+    void build_model(printemps::model::IPModel* a_model) {
+        auto& x = a_model->create_variables("x", 10, 0, 1);
+        auto& y = a_model->create_variables("y", 5, -10, 10);
+        a_model->create_constraint("c_0", x.sum() <= 5);
+        a_model->create_constraint("c_1", x.sum() + y.sum() >= 3);
+        a_model->minimize(x.sum() + 2 * y.sum());
+    }
+
+    /*************************************************************************/
+    void setup_model(printemps::model::IPModel* a_model) {
+        this->build_model(a_model);
+        a_model->setup(false, false, false, false, false, false, true, false,
+                       printemps::model::SelectionMode::None, false);
+    }
+
+    /*************************************************************************/
+    printemps::solver::Checkpoint<int, double> create_checkpoint(void) {
+        printemps::solver::Checkpoint<int, double> checkpoint;
+        checkpoint.number_of_variables                            = 2;
+        checkpoint.number_of_constraints                          = 1;
+        checkpoint.is_found_feasible_solution                     = true;
+        checkpoint.global_augmented_incumbent_solution.variables  = {1, 0};
+        checkpoint.global_augmented_incumbent_solution.violations = {0.0};
+        checkpoint.feasible_incumbent_solution.variables          = {1, 0};
+        checkpoint.feasible_incumbent_solution.violations         = {0.0};
+        checkpoint.feasible_incumbent_solution.objective          = 3.0;
+        checkpoint.feasible_incumbent_solution.is_feasible        = true;
+        checkpoint.feasible_incumbent_score.objective             = 3.0;
+        checkpoint.current_solution.variables                     = {0, 1};
+        checkpoint.current_solution.violations                    = {2.0};
+        checkpoint.current_solution_score.total_violation         = 2.0;
+        checkpoint.previous_solution.variables                    = {0, 0};
+        checkpoint.previous_solution.violations                   = {1.0};
+        checkpoint.local_penalty_coefficients                     = {5.0};
+        checkpoint.last_update_iterations                         = {-1000, 4};
+        checkpoint.update_counts                                  = {0, 2};
+        checkpoint.total_update_counts                            = 2;
+        checkpoint.chain_move_begins                              = {0, 2};
+        checkpoint.chain_move_variable_indices                    = {0, 1};
+        checkpoint.chain_move_values                              = {1, 0};
+        checkpoint.is_enabled_chain_move                          = true;
+        checkpoint.iteration                                      = 12;
+        checkpoint.pruning_rate_threshold                         = 0.5;
+        checkpoint.improvability_screening_mode                   = 2;
+        checkpoint.number_of_tabu_search_loops                    = 12;
+        checkpoint.elapsed_time                                   = 34.5;
+        checkpoint.random_generator_state                         = "1 2 3";
+        return checkpoint;
+    }
+};
+
+/*****************************************************************************/
+TEST_F(TestCheckpoint, initialize) {
+    printemps::solver::Checkpoint<int, double> checkpoint;
+
+    EXPECT_EQ(0, checkpoint.number_of_variables);
+    EXPECT_EQ(0, checkpoint.number_of_constraints);
+    EXPECT_EQ(false, checkpoint.is_found_feasible_solution);
+    EXPECT_EQ(true, checkpoint.current_solution.variables.empty());
+    EXPECT_EQ(true, checkpoint.local_penalty_coefficients.empty());
+    EXPECT_EQ(true, checkpoint.update_counts.empty());
+    EXPECT_EQ(0, checkpoint.total_update_counts);
+    EXPECT_EQ(1, static_cast<int>(checkpoint.chain_move_begins.size()));
+    EXPECT_EQ(true, checkpoint.chain_move_variable_indices.empty());
+    EXPECT_EQ(false, checkpoint.is_enabled_chain_move);
+    EXPECT_EQ(0, checkpoint.iteration);
+    EXPECT_EQ(0, checkpoint.number_of_tabu_search_loops);
+    EXPECT_EQ(0.0, checkpoint.elapsed_time);
+    EXPECT_EQ(true, checkpoint.random_generator_state.empty());
+}
+
+/*****************************************************************************/
+TEST_F(TestCheckpoint, export_model_state) {
+    printemps::model::IPModel model;
+    this->setup_model(&model);
+
+    const auto& constraint_ptrs =
+        model.constraint_reference().constraint_ptrs;
+
+    constraint_ptrs[0]->local_penalty_coefficient() = 10.0;
+    constraint_ptrs[1]->local_penalty_coefficient() = 20.0;
+
+    const auto& binary_moves = model.neighborhood().binary_moves();
+    model.neighborhood().register_chain_move(binary_moves[1] +
+                                             binary_moves[3]);
+    model.neighborhood().enable_chain_move();
+
+    printemps::solver::Checkpoint<int, double> checkpoint;
+    checkpoint.export_model_state(&model);
+
+    EXPECT_EQ(15, checkpoint.number_of_variables);
+    EXPECT_EQ(2, checkpoint.number_of_constraints);
+    EXPECT_EQ(10.0, checkpoint.local_penalty_coefficients[0]);
+    EXPECT_EQ(20.0, checkpoint.local_penalty_coefficients[1]);
+
+    EXPECT_EQ(2, static_cast<int>(checkpoint.chain_move_begins.size()));
+    EXPECT_EQ(2, checkpoint.chain_move_begins[1]);
+    EXPECT_EQ(binary_moves[1].alterations[0].first->global_index(),
+              checkpoint.chain_move_variable_indices[0]);
+    EXPECT_EQ(binary_moves[3].alterations[0].first->global_index(),
+              checkpoint.chain_move_variable_indices[1]);
+    EXPECT_EQ(binary_moves[1].alterations[0].second,
+              checkpoint.chain_move_values[0]);
+    EXPECT_EQ(binary_moves[3].alterations[0].second,
+              checkpoint.chain_move_values[1]);
+
+    EXPECT_EQ(true, checkpoint.is_enabled_chain_move);
+    EXPECT_EQ(false, checkpoint.is_enabled_aggregation_move);
+}
+
+/*****************************************************************************/
+TEST_F(TestCheckpoint, import_model_state) {
+    printemps::solver::Checkpoint<int, double> checkpoint;
+    {
+        printemps::model::IPModel model;
+        this->setup_model(&model);
+
+        model.constraint_reference()
+            .constraint_ptrs[1]
+            ->local_penalty_coefficient() = 20.0;
+
+        const auto& binary_moves = model.neighborhood().binary_moves();
+        model.neighborhood().register_chain_move(binary_moves[1] +
+                                                 binary_moves[3]);
+        model.neighborhood().enable_chain_move();
+        checkpoint.export_model_state(&model);
+    }
+
+    printemps::model::IPModel model;
+    this->setup_model(&model);
+    checkpoint.import_model_state(&model);
+
+    EXPECT_EQ(20.0, model.constraint_reference()
+                        .constraint_ptrs[1]
+                        ->local_penalty_coefficient());
+    EXPECT_EQ(true, model.neighborhood().is_enabled_chain_move());
+
+    const auto& chain_moves = model.neighborhood().chain_moves();
+    EXPECT_EQ(1, static_cast<int>(chain_moves.size()));
+
+    const auto& chain_move = chain_moves.front();
+    EXPECT_EQ(printemps::model::MoveSense::Chain, chain_move.sense);
+    EXPECT_EQ(true, chain_move.is_special_neighborhood_move);
+    EXPECT_EQ(true, chain_move.is_available);
+    EXPECT_EQ(2, static_cast<int>(chain_move.alterations.size()));
+    EXPECT_EQ(checkpoint.chain_move_variable_indices[0],
+              chain_move.alterations[0].first->global_index());
+    EXPECT_EQ(checkpoint.chain_move_variable_indices[1],
+              chain_move.alterations[1].first->global_index());
+    EXPECT_EQ(2, static_cast<int>(chain_move.related_constraint_ptrs.size()));
+
+    /// The checkpoint for another model cannot be imported.
+    printemps::model::IPModel other_model;
+    auto& x = other_model.create_variables("x", 3, 0, 1);
+    other_model.create_constraint("c_0", x.sum() <= 1);
+    other_model.minimize(x.sum());
+    other_model.setup(false, false, false, false, false, false, false, false,
+                      printemps::model::SelectionMode::None, false);
+    ASSERT_THROW(checkpoint.import_model_state(&other_model),
+                 std::logic_error);
+
+    /// The checkpoint with a chain move out of range cannot be imported.
+    checkpoint.chain_move_variable_indices[1] = checkpoint.number_of_variables;
+    ASSERT_THROW(checkpoint.import_model_state(&model), std::logic_error);
+}
+
+/*****************************************************************************/
+TEST_F(TestCheckpoint, export_memory) {
+    printemps::model::IPModel model;
+    this->setup_model(&model);
+
+    printemps::solver::Memory memory(&model);
+    memory.update(model.neighborhood().binary_moves()[2], 7);
+
+    printemps::solver::Checkpoint<int, double> checkpoint;
+    checkpoint.export_memory(memory);
+
+    EXPECT_EQ(15, static_cast<int>(checkpoint.last_update_iterations.size()));
+    EXPECT_EQ(15, static_cast<int>(checkpoint.update_counts.size()));
+    EXPECT_EQ(7, checkpoint.last_update_iterations[2]);
+    EXPECT_EQ(1, checkpoint.update_counts[2]);
+    EXPECT_EQ(0, checkpoint.update_counts[3]);
+    EXPECT_EQ(1, checkpoint.total_update_counts);
+}
+
+/*****************************************************************************/
+TEST_F(TestCheckpoint, import_memory) {
+    printemps::model::IPModel model;
+    this->setup_model(&model);
+
+    printemps::solver::Memory memory(&model);
+    memory.update(model.neighborhood().binary_moves()[2], 7);
+
+    printemps::solver::Checkpoint<int, double> checkpoint;
+    checkpoint.export_memory(memory);
+
+    printemps::solver::Memory restored_memory(&model);
+    checkpoint.import_memory(&restored_memory);
+
+    EXPECT_EQ(memory.last_update_iterations(),
+              restored_memory.last_update_iterations());
+    EXPECT_EQ(memory.update_counts(), restored_memory.update_counts());
+    EXPECT_EQ(1, restored_memory.total_update_counts());
+}
+
+/*****************************************************************************/
+TEST_F(TestCheckpoint, export_random_generator) {
+    std::mt19937 get_rand_mt(1);
+    get_rand_mt();
+
+    printemps::solver::Checkpoint<int, double> checkpoint;
+    checkpoint.export_random_generator(get_rand_mt);
+
+    std::mt19937 restored_get_rand_mt(2);
+    checkpoint.import_random_generator(&restored_get_rand_mt);
+
+    for (auto i = 0; i < 10; i++) {
+        EXPECT_EQ(get_rand_mt(), restored_get_rand_mt());
+    }
+}
+
+/*****************************************************************************/
+TEST_F(TestCheckpoint, import_random_generator) {
+    /// This method is tested in export_random_generator().
+}
+
+/*****************************************************************************/
+TEST_F(TestCheckpoint, write) {
+    const std::string FILE_NAME = "test_checkpoint.bin";
+
+    auto checkpoint = this->create_checkpoint();
+
+    EXPECT_EQ(true, checkpoint.write(FILE_NAME));
+
+    printemps::solver::Checkpoint<int, double> restored;
+    restored.read(FILE_NAME);
+
+    EXPECT_EQ(2, restored.number_of_variables);
+    EXPECT_EQ(1, restored.number_of_constraints);
+    EXPECT_EQ(true, restored.is_found_feasible_solution);
+    EXPECT_EQ(checkpoint.feasible_incumbent_solution.variables,
+              restored.feasible_incumbent_solution.variables);
+    EXPECT_EQ(3.0, restored.feasible_incumbent_solution.objective);
+    EXPECT_EQ(true, restored.feasible_incumbent_solution.is_feasible);
+    EXPECT_EQ(3.0, restored.feasible_incumbent_score.objective);
+    EXPECT_EQ(checkpoint.current_solution.variables,
+              restored.current_solution.variables);
+    EXPECT_EQ(checkpoint.current_solution.violations,
+              restored.current_solution.violations);
+    EXPECT_EQ(2.0, restored.current_solution_score.total_violation);
+    EXPECT_EQ(checkpoint.local_penalty_coefficients,
+              restored.local_penalty_coefficients);
+    EXPECT_EQ(checkpoint.last_update_iterations,
+              restored.last_update_iterations);
+    EXPECT_EQ(checkpoint.update_counts, restored.update_counts);
+    EXPECT_EQ(2, restored.total_update_counts);
+    EXPECT_EQ(checkpoint.chain_move_begins, restored.chain_move_begins);
+    EXPECT_EQ(checkpoint.chain_move_variable_indices,
+              restored.chain_move_variable_indices);
+    EXPECT_EQ(checkpoint.chain_move_values, restored.chain_move_values);
+    EXPECT_EQ(true, restored.is_enabled_chain_move);
+    EXPECT_EQ(12, restored.iteration);
+    EXPECT_EQ(0.5, restored.pruning_rate_threshold);
+    EXPECT_EQ(2, restored.improvability_screening_mode);
+    EXPECT_EQ(12, restored.number_of_tabu_search_loops);
+    EXPECT_EQ(34.5, restored.elapsed_time);
+    EXPECT_EQ("1 2 3", restored.random_generator_state);
+
+    std::remove(FILE_NAME.c_str());
+}
+
+/*****************************************************************************/
+TEST_F(TestCheckpoint, read) {
+    printemps::solver::Checkpoint<int, double> checkpoint;
+
+    /// The file does not exist.
+    ASSERT_THROW(checkpoint.read("not_existing_checkpoint.bin"),
+                 std::logic_error);
+
+    /// The file is not a checkpoint.
+    const std::string FILE_NAME = "test_invalid_checkpoint.bin";
+    {
+        std::ofstream ofs(FILE_NAME.c_str());
+        ofs << "This is not a checkpoint." << std::endl;
+    }
+    ASSERT_THROW(checkpoint.read(FILE_NAME), std::logic_error);
+    std::remove(FILE_NAME.c_str());
+
+    /// The file is truncated.
+    const std::string VALID_FILE_NAME = "test_valid_checkpoint.bin";
+    EXPECT_EQ(true, this->create_checkpoint().write(VALID_FILE_NAME));
+    std::string buffer;
+    {
+        std::ifstream ifs(VALID_FILE_NAME.c_str(), std::ios::binary);
+        buffer.assign(std::istreambuf_iterator<char>(ifs),
+                      std::istreambuf_iterator<char>());
+    }
+    std::remove(VALID_FILE_NAME.c_str());
+
+    {
+        std::ofstream ofs(FILE_NAME.c_str(), std::ios::binary);
+        ofs.write(buffer.data(), buffer.size() / 2);
+    }
+    ASSERT_THROW(checkpoint.read(FILE_NAME), std::logic_error);
+
+    /**
+     * The size of the first vector, which follows the header of 16 bytes,
+     * the numbers of the variables and the constraints, and the flag, is
+     * broken.
+     */
+    {
+        const std::size_t SIZE_POSITION = 16 + 2 * sizeof(int) + sizeof(bool);
+        std::string       broken_buffer = buffer;
+        for (auto i = 0; i < 8; i++) {
+            broken_buffer[SIZE_POSITION + i] = static_cast<char>(0xff);
+        }
+        std::ofstream ofs(FILE_NAME.c_str(), std::ios::binary);
+        ofs.write(broken_buffer.data(), broken_buffer.size());
+    }
+    ASSERT_THROW(checkpoint.read(FILE_NAME), std::logic_error);
+    std::remove(FILE_NAME.c_str());
+
+    /// The chain moves refer to a variable out of range.
+    {
+        auto broken_checkpoint = this->create_checkpoint();
+        broken_checkpoint.chain_move_variable_indices[1] = 2;
+        EXPECT_EQ(true, broken_checkpoint.write(FILE_NAME));
+    }
+    ASSERT_THROW(checkpoint.read(FILE_NAME), std::logic_error);
+
+    /// The beginnings of the chain moves are not monotone.
+    {
+        auto broken_checkpoint              = this->create_checkpoint();
+        broken_checkpoint.chain_move_begins = {0, 3, 2};
+        EXPECT_EQ(true, broken_checkpoint.write(FILE_NAME));
+    }
+    ASSERT_THROW(checkpoint.read(FILE_NAME), std::logic_error);
+
+    /// The memory does not match the number of the variables.
+    {
+        auto broken_checkpoint          = this->create_checkpoint();
+        broken_checkpoint.update_counts = {0, 2, 0};
+        EXPECT_EQ(true, broken_checkpoint.write(FILE_NAME));
+    }
+    ASSERT_THROW(checkpoint.read(FILE_NAME), std::logic_error);
+    std::remove(FILE_NAME.c_str());
+}
+
+/*****************************************************************************/
+TEST_F(TestCheckpoint, is_consistent) {
+    auto checkpoint = this->create_checkpoint();
+    EXPECT_EQ(true, checkpoint.is_consistent());
+
+    /// The feasible incumbent may be empty if no feasible solution is found.
+    checkpoint.feasible_incumbent_solution.initialize();
+    EXPECT_EQ(false, checkpoint.is_consistent());
+    checkpoint.is_found_feasible_solution = false;
+    EXPECT_EQ(true, checkpoint.is_consistent());
+
+    checkpoint.previous_solution.variables.pop_back();
+    EXPECT_EQ(false, checkpoint.is_consistent());
+}
+
+/*****************************************************************************/
+TEST_F(TestCheckpoint, is_consistent_model_state) {
+    auto checkpoint = this->create_checkpoint();
+    EXPECT_EQ(true, checkpoint.is_consistent_model_state());
+
+    checkpoint.local_penalty_coefficients.push_back(1.0);
+    EXPECT_EQ(false, checkpoint.is_consistent_model_state());
+    checkpoint.local_penalty_coefficients.pop_back();
+
+    checkpoint.chain_move_begins = {0, 1};
+    EXPECT_EQ(false, checkpoint.is_consistent_model_state());
+    checkpoint.chain_move_begins = {0, 2};
+
+    checkpoint.chain_move_variable_indices[0] = -1;
+    EXPECT_EQ(false, checkpoint.is_consistent_model_state());
+}
+
+/*****************************************************************************/
+TEST_F(TestCheckpoint, resume) {
+    const std::string FILE_NAME = "test_resume_checkpoint.bin";
+
+    printemps::solver::Option option;
+    option.iteration_max           = 3;
+    option.is_enabled_chain_move   = true;
+    option.is_enabled_checkpoint   = true;
+    option.checkpoint_file_name    = FILE_NAME;
+    option.verbose                 = printemps::solver::None;
+    option.tabu_search.iteration_max = 20;
+
+    printemps::model::IPModel model;
+    this->build_model(&model);
+    auto result = printemps::solver::solve(&model, option);
+
+    printemps::solver::Checkpoint<int, double> checkpoint;
+    checkpoint.read(FILE_NAME);
+    EXPECT_EQ(3, checkpoint.iteration);
+    EXPECT_EQ(result.status.number_of_tabu_search_loops,
+              checkpoint.number_of_tabu_search_loops);
+    EXPECT_EQ(result.status.number_of_tabu_search_iterations,
+              checkpoint.number_of_tabu_search_iterations);
+
+    /**
+     * The resumed search continues the loops from the checkpoint and never
+     * returns a solution worse than the incumbent of the previous run.
+     */
+    option.iteration_max = 5;
+    printemps::model::IPModel resumed_model;
+    this->build_model(&resumed_model);
+    auto resumed_result =
+        printemps::solver::resume(&resumed_model, option, FILE_NAME);
+
+    EXPECT_LE(result.status.number_of_tabu_search_loops,
+              resumed_result.status.number_of_tabu_search_loops);
+    EXPECT_EQ(result.solution.is_feasible(),
+              resumed_result.solution.is_feasible());
+    if (result.solution.is_feasible()) {
+        EXPECT_LE(resumed_result.solution.objective(),
+                  result.solution.objective());
+    }
+
+    checkpoint.read(FILE_NAME);
+    EXPECT_EQ(resumed_result.status.number_of_tabu_search_loops,
+              checkpoint.number_of_tabu_search_loops);
+
+    std::remove(FILE_NAME.c_str());
+}
+
+/*****************************************************************************/
+TEST_F(TestCheckpoint, resume_in_memory) {
+    printemps::solver::Option option;
+    option.iteration_max             = 3;
+    option.is_enabled_chain_move     = true;
+    option.verbose                   = printemps::solver::None;
+    option.tabu_search.iteration_max = 20;
+
+    printemps::model::IPModel model;
+    this->build_model(&model);
+
+    /**
+     * The last state is exported to the checkpoint without the file.
+     */
+    printemps::solver::Checkpoint<int, double> checkpoint;
+    auto result = printemps::solver::solve(
+        &model, option,
+        static_cast<const printemps::solver::Checkpoint<int, double>*>(nullptr),
+        &checkpoint);
+    EXPECT_EQ(3, checkpoint.iteration);
+    EXPECT_EQ(true, checkpoint.is_consistent_model_state());
+    EXPECT_EQ(result.status.number_of_tabu_search_loops,
+              checkpoint.number_of_tabu_search_loops);
+
+    /**
+     * The solved model can not be solved again from scratch, but the search
+     * on it can be resumed from the checkpoint.
+     */
+    ASSERT_THROW(printemps::solver::solve(&model, option), std::logic_error);
+
+    option.iteration_max = 5;
+    auto resumed_result =
+        printemps::solver::solve(&model, option, &checkpoint, &checkpoint);
+    EXPECT_EQ(5, checkpoint.iteration);
+    EXPECT_EQ(resumed_result.status.number_of_tabu_search_loops,
+              checkpoint.number_of_tabu_search_loops);
+    EXPECT_LE(result.status.number_of_tabu_search_loops,
+              resumed_result.status.number_of_tabu_search_loops);
+    if (result.solution.is_feasible()) {
+        EXPECT_EQ(true, resumed_result.solution.is_feasible());
+        EXPECT_LE(resumed_result.solution.objective(),
+                  result.solution.objective());
+    }
+}
+
+/*****************************************************************************/
+TEST_F(TestCheckpoint, solve_after_termination_signal) {
+    /**
+     * The first search is stopped by SIGTERM raised in the callback after the
+     * first loop. The next search in the same process must not be stopped by
+     * the signal, whether the checkpoint is enabled or not.
+     */
+    const std::string FILE_NAME = "test_termination_checkpoint.bin";
+
+    printemps::solver::Option option;
+    option.iteration_max             = 3;
+    option.is_enabled_checkpoint     = true;
+    option.checkpoint_file_name      = FILE_NAME;
+    option.verbose                   = printemps::solver::None;
+    option.tabu_search.iteration_max = 20;
+
+    printemps::model::IPModel model;
+    this->build_model(&model);
+    model.set_callback([](void) { std::raise(SIGTERM); });
+    auto result = printemps::solver::solve(&model, option);
+    EXPECT_EQ(1, result.status.number_of_tabu_search_loops);
+    EXPECT_EQ(false,
+              printemps::utility::TerminationSignalHandler::is_received());
+
+    option.is_enabled_checkpoint = false;
+    printemps::model::IPModel next_model;
+    this->build_model(&next_model);
+    auto next_result = printemps::solver::solve(&next_model, option);
+    EXPECT_EQ(3, next_result.status.number_of_tabu_search_loops);
+    EXPECT_LT(0, next_result.status.number_of_tabu_search_iterations);
+
+    std::remove(FILE_NAME.c_str());
+}
+}  // namespace
+/*****************************************************************************/
+// END
+/*****************************************************************************/
@@ -0,0 +1,169 @@
+/*****************************************************************************/
+// Copyright (c) 2020 Yuji KOGUMA
+// Released under the MIT license
+// https://opensource.org/licenses/mit-license.php
+/*****************************************************************************/
+#include <gtest/gtest.h>
+#include <printemps.h>
+
+namespace {
+/*****************************************************************************/
+class TestIncumbentHolder : public ::testing::Test {
+   protected:
+    virtual void SetUp(void) {
+        /// nothing to do
+    }
+    virtual void TearDown() {
+        /// nothing to do
+    }
+};
+
+/*****************************************************************************/
+TEST_F(TestIncumbentHolder, initialize) {
+    printemps::solver::IncumbentHolder<int, double> incumbent_holder;
+    EXPECT_EQ(false, incumbent_holder.is_found_feasible_solution());
+    const double DEFAULT_OBJECTIVE =
+        printemps::solver::IncumbentHolderConstant::DEFAULT_OBJECTIVE;
+    EXPECT_EQ(DEFAULT_OBJECTIVE,
+              incumbent_holder.local_augmented_incumbent_objective());
+    EXPECT_EQ(DEFAULT_OBJECTIVE,
+              incumbent_holder.global_augmented_incumbent_objective());
+    EXPECT_EQ(DEFAULT_OBJECTIVE,
+              incumbent_holder.feasible_incumbent_objective());
+}
+
+/*****************************************************************************/
+TEST_F(TestIncumbentHolder, try_update_incumbent) {
+    printemps::model::Model<int, double> model;
+
+    auto& x = model.create_variables("x", 4, 0, 1);
+    auto& g = model.create_constraints("g", 2);
+    g(0)    = x(0) + x(1) <= 1;
+    g(1)    = x(2) + x(3) >= 1;
+    model.minimize(x(0) + 2 * x(1) + 3 * x(2) + 4 * x(3));
+
+    model.categorize_variables();
+    model.categorize_constraints();
+
+    for (auto&& constraint_ptr : model.constraint_reference().constraint_ptrs) {
+        constraint_ptr->local_penalty_coefficient()  = 100.0;
+        constraint_ptr->global_penalty_coefficient() = 100.0;
+    }
+
+    /// An infeasible solution updates the augmented incumbents.
+    x(0) = 1;
+    x(1) = 1;
+    model.update();
+    auto infeasible_score = model.evaluate({});
+
+    printemps::solver::IncumbentHolder<int, double> incumbent_holder;
+    EXPECT_EQ(printemps::solver::IncumbentHolderConstant::
+                      STATUS_LOCAL_AUGMENTED_INCUMBENT_UPDATE +
+                  printemps::solver::IncumbentHolderConstant::
+                      STATUS_GLOBAL_AUGMENTED_INCUMBENT_UPDATE,
+              incumbent_holder.try_update_incumbent(&model, infeasible_score));
+    EXPECT_EQ(false, incumbent_holder.is_found_feasible_solution());
+
+    /// The violations are not stored, while the total violation and the
+    /// feasibility are taken from the score.
+    const auto& infeasible_solution =
+        incumbent_holder.local_augmented_incumbent_solution();
+    EXPECT_EQ(std::vector<int>({1, 1, 0, 0}), infeasible_solution.variables);
+    EXPECT_EQ(true, infeasible_solution.violations.empty());
+    EXPECT_EQ(infeasible_score.total_violation,
+              infeasible_solution.total_violation);
+    EXPECT_EQ(false, infeasible_solution.is_feasible);
+    EXPECT_EQ(infeasible_solution.variables,
+              incumbent_holder.global_augmented_incumbent_solution().variables);
+
+    /// A feasible solution updates all of the incumbents.
+    x(0) = 1;
+    x(1) = 0;
+    x(2) = 1;
+    model.update();
+    auto feasible_score = model.evaluate({});
+
+    EXPECT_EQ(printemps::solver::IncumbentHolderConstant::
+                      STATUS_LOCAL_AUGMENTED_INCUMBENT_UPDATE +
+                  printemps::solver::IncumbentHolderConstant::
+                      STATUS_GLOBAL_AUGMENTED_INCUMBENT_UPDATE +
+                  printemps::solver::IncumbentHolderConstant::
+                      STATUS_FEASIBLE_INCUMBENT_UPDATE,
+              incumbent_holder.try_update_incumbent(&model, feasible_score));
+    EXPECT_EQ(true, incumbent_holder.is_found_feasible_solution());
+    EXPECT_EQ(std::vector<int>({1, 0, 1, 0}),
+              incumbent_holder.feasible_incumbent_solution().variables);
+    EXPECT_EQ(true, incumbent_holder.feasible_incumbent_solution().is_feasible);
+    EXPECT_EQ(4.0, incumbent_holder.feasible_incumbent_objective());
+
+    /// A worse solution updates nothing.
+    const int STATUS_NO_UPDATED =
+        printemps::solver::IncumbentHolderConstant::STATUS_NO_UPDATED;
+    EXPECT_EQ(STATUS_NO_UPDATED,
+              incumbent_holder.try_update_incumbent(&model, infeasible_score));
+}
+
+/*****************************************************************************/
+TEST_F(TestIncumbentHolder, fill_violations) {
+    printemps::model::Model<int, double> model;
+
+    auto& x = model.create_variables("x", 4, 0, 1);
+    auto& g = model.create_constraints("g", 2);
+    g(0)    = x(0) + x(1) <= 1;
+    g(1)    = x(2) + x(3) >= 1;
+    model.minimize(x(0) + 2 * x(1) + 3 * x(2) + 4 * x(3));
+
+    model.categorize_variables();
+    model.categorize_constraints();
+
+    for (auto&& constraint_ptr : model.constraint_reference().constraint_ptrs) {
+        constraint_ptr->local_penalty_coefficient()  = 100.0;
+        constraint_ptr->global_penalty_coefficient() = 100.0;
+    }
+
+    x(0) = 1;
+    x(1) = 1;
+    model.update();
+
+    printemps::solver::IncumbentHolder<int, double> incumbent_holder;
+    incumbent_holder.try_update_incumbent(&model, model.evaluate({}));
+
+    /// Move the model to another solution which is not held.
+    x(0) = 0;
+    x(1) = 0;
+    x(3) = 1;
+    model.update();
+    const auto EXPECTED_SCORE    = model.evaluate({});
+    const auto EXPECTED_SOLUTION = model.export_compact_solution();
+
+    incumbent_holder.fill_violations(&model);
+
+    /// The violations of the held solution are filled.
+    for (const auto& solution :
+         {incumbent_holder.local_augmented_incumbent_solution(),
+          incumbent_holder.global_augmented_incumbent_solution()}) {
+        ASSERT_EQ(2, static_cast<int>(solution.violations.size()));
+        EXPECT_EQ(1.0, solution.violations[g(0).global_index()]);
+        EXPECT_EQ(1.0, solution.violations[g(1).global_index()]);
+    }
+
+    /// The feasible incumbent, which has not been found, is not filled.
+    EXPECT_EQ(
+        true,
+        incumbent_holder.feasible_incumbent_solution().violations.empty());
+
+    /// The state of the model is restored.
+    EXPECT_EQ(std::vector<int>({0, 0, 0, 1}), model.export_variable_values());
+    EXPECT_EQ(EXPECTED_SOLUTION.violations,
+              model.export_compact_solution().violations);
+    EXPECT_EQ(-1.0, g(0).constraint_value());
+    EXPECT_EQ(0.0, g(1).constraint_value());
+    EXPECT_EQ(4.0, model.objective().value());
+    EXPECT_EQ(EXPECTED_SCORE.total_violation,
+              model.evaluate({}).total_violation);
+    EXPECT_EQ(true, model.is_feasible());
+}
+}  // namespace
+/*****************************************************************************/
+// END
+/*****************************************************************************/
@@ -0,0 +1,138 @@
+/*****************************************************************************/
+// Copyright (c) 2020 Yuji KOGUMA
+// Released under the MIT license
+// https://opensource.org/licenses/mit-license.php
+/*****************************************************************************/
+#include <gtest/gtest.h>
+#include <printemps.h>
+
+namespace {
+/*****************************************************************************/
+class TestLagrangeDual : public ::testing::Test {
+   protected:
+    virtual void SetUp(void) {
+        /// nothing to do
+    }
+    virtual void TearDown() {
+        /// nothing to do
+    }
+};
+
+/*****************************************************************************/
+TEST_F(TestLagrangeDual, solve) {
+    /**
+     * The set partitioning problem
+     * (P):  minimize       3 x_0 + 2 x_1 + 2 x_2 + 2 x_3 + 4 x_4
+     *          x
+     *      subject to   x_0 + x_1       + x_4 = 1,
+     *                   x_0       + x_2 + x_4 = 1,
+     *                   x_0 + x_3 + x_4       = 1,
+     *                   x_1 + x_2 + x_3 + x_4 = 1,
+     *                   x_i in {0, 1} (i = 0, ..., 4),
+     * has an optimal solution x = (0, 0, 0, 0, 1) with the objective 4.
+     * The lagrangian must not exceed it for both of the methods.
+     */
+    using Method_T = printemps::solver::lagrange_dual::LagrangeDualMethod;
+    for (const auto METHOD : {Method_T::Subgradient, Method_T::Volume}) {
+        printemps::model::IPModel model;
+
+        auto& x = model.create_variables("x", 5, 0, 1);
+        auto& g = model.create_constraints("g", 4);
+
+        g(0) = x(0) + x(1) + x(4) == 1;
+        g(1) = x(0) + x(2) + x(4) == 1;
+        g(2) = x(0) + x(3) + x(4) == 1;
+        g(3) = x(1) + x(2) + x(3) + x(4) == 1;
+        model.minimize(3 * x(0) + 2 * x(1) + 2 * x(2) + 2 * x(3) + 4 * x(4));
+
+        model.setup(false, false, false, false, false, false, false, false,
+                    printemps::model::SelectionMode::None, false);
+
+        printemps::solver::Option option;
+        option.verbose                     = printemps::solver::None;
+        option.lagrange_dual.iteration_max = 1000;
+        option.lagrange_dual.method        = METHOD;
+
+        printemps::solver::IncumbentHolder<int, double> incumbent_holder;
+        auto result = printemps::solver::lagrange_dual::solve(
+            &model, option, std::vector<int>(5, 0), incumbent_holder);
+
+        EXPECT_GT(result.lagrangian, 0.0);
+        EXPECT_LE(result.lagrangian, 4.0 + printemps::constant::EPSILON);
+        EXPECT_EQ(4, result.dual_value_proxies[0].number_of_elements());
+
+        if (METHOD == Method_T::Volume) {
+            /**
+             * The primal estimate is a convex combination of the primal
+             * solutions.
+             */
+            EXPECT_EQ(5, static_cast<int>(result.primal_estimate.size()));
+            for (const auto& value : result.primal_estimate) {
+                EXPECT_GE(value, 0.0 - printemps::constant::EPSILON);
+                EXPECT_LE(value, 1.0 + printemps::constant::EPSILON);
+            }
+        } else {
+            EXPECT_EQ(true, result.primal_estimate.empty());
+        }
+
+        /**
+         * The violations of the incumbent solutions, which are stored without
+         * them in the iterations, are filled at the end of the search.
+         */
+        auto feasible_result = printemps::solver::lagrange_dual::solve(
+            &model, option, {0, 0, 0, 0, 1}, incumbent_holder);
+        const auto& incumbent_solution =
+            feasible_result.incumbent_holder.feasible_incumbent_solution();
+        EXPECT_EQ(std::vector<int>({0, 0, 0, 0, 1}),
+                  incumbent_solution.variables);
+        EXPECT_EQ(std::vector<double>(4, 0.0), incumbent_solution.violations);
+    }
+}
+
+/*****************************************************************************/
+TEST_F(TestLagrangeDual, lagrangian_bound) {
+    /**
+     * The best lagrangian is reported as the bound of the objective in the
+     * status of the solver. The problem is the same as the above, whose
+     * optimal objective is 4.
+     */
+    for (const auto IS_ENABLED_LAGRANGE_DUAL : {true, false}) {
+        printemps::model::IPModel model;
+
+        auto& x = model.create_variables("x", 5, 0, 1);
+        auto& g = model.create_constraints("g", 4);
+
+        g(0) = x(0) + x(1) + x(4) == 1;
+        g(1) = x(0) + x(2) + x(4) == 1;
+        g(2) = x(0) + x(3) + x(4) == 1;
+        g(3) = x(1) + x(2) + x(3) + x(4) == 1;
+        model.minimize(3 * x(0) + 2 * x(1) + 2 * x(2) + 2 * x(3) + 4 * x(4));
+
+        printemps::solver::Option option;
+        option.verbose                     = printemps::solver::None;
+        option.iteration_max               = 2;
+        option.is_enabled_lagrange_dual    = IS_ENABLED_LAGRANGE_DUAL;
+        option.is_enabled_local_search     = true;
+        option.lagrange_dual.iteration_max = 1000;
+        option.lagrange_dual.method =
+            printemps::solver::lagrange_dual::LagrangeDualMethod::Volume;
+
+        auto result = printemps::solver::solve(&model, option);
+
+        EXPECT_EQ(IS_ENABLED_LAGRANGE_DUAL,
+                  result.status.is_found_lagrangian_bound);
+        if (IS_ENABLED_LAGRANGE_DUAL) {
+            EXPECT_GT(result.status.lagrangian_bound, 0.0);
+            EXPECT_LE(result.status.lagrangian_bound,
+                      4.0 + printemps::constant::EPSILON);
+            EXPECT_LE(result.status.lagrangian_bound,
+                      result.solution.objective() +
+                          printemps::constant::EPSILON);
+        }
+    }
+}
+/*****************************************************************************/
+}  // namespace
+/*****************************************************************************/
+// END
+/*****************************************************************************/
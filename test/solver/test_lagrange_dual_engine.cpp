@@ -0,0 +1,533 @@
+/*****************************************************************************/
+// Copyright (c) 2020 Yuji KOGUMA
+// Released under the MIT license
+// https://opensource.org/licenses/mit-license.php
+/*****************************************************************************/
+#include <gtest/gtest.h>
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+#include <printemps.h>
+
+namespace {
+/*****************************************************************************/
+class TestLagrangeDualEngine : public ::testing::Test {
+   protected:
+    virtual void SetUp(void) {
+        /// nothing to do
+    }
+    virtual void TearDown() {
+        /// nothing to do
+    }
+
+    /*************************************************************************/
+    void setup_model(printemps::model::IPModel* a_model,
+                     const bool                 a_IS_MINIMIZATION) {
+        auto& x = a_model->create_variables("x", 5, 0, 1);
+        auto& y = a_model->create_variables("y", 3, -2, 4);
+
+        a_model->create_constraint("c_0", 2 * x(0) + x(1) - y(0) <= 3);
+        a_model->create_constraint("c_1", x.sum() + y.sum() >= 2);
+        a_model->create_constraint("c_2", x(2) + 3 * y(1) == 1);
+        a_model->create_constraint("c_3", x(3) - 2 * y(2) <= -1);
+
+        x(4).fix_by(1);
+
+        if (a_IS_MINIMIZATION) {
+            a_model->minimize(x.sum() - 3 * y.sum() + 5);
+        } else {
+            a_model->maximize(2 * x.sum() - y(0) + y(2) + 1);
+        }
+        a_model->setup(false, false, false, false, false, false, false, false,
+                       printemps::model::SelectionMode::None, false);
+        a_model->update();
+
+        for (auto&& constraint_ptr :
+             a_model->constraint_reference().constraint_ptrs) {
+            constraint_ptr->local_penalty_coefficient()  = 10.0;
+            constraint_ptr->global_penalty_coefficient() = 100.0;
+        }
+    }
+
+    /*************************************************************************/
+    void verify(printemps::model::IPModel* a_model,
+                const printemps::solver::lagrange_dual::LagrangeDualEngine<
+                    int, double>& a_ENGINE) {
+        const auto& variable_ptrs = a_model->variable_reference().variable_ptrs;
+        const auto& constraint_ptrs =
+            a_model->constraint_reference().constraint_ptrs;
+        const auto& dual_values = a_ENGINE.dual_values();
+
+        /// Reduced costs
+        const int VARIABLES_SIZE = variable_ptrs.size();
+        for (auto i = 0; i < VARIABLES_SIZE; i++) {
+            if (variable_ptrs[i]->is_fixed()) {
+                continue;
+            }
+            double reduced_cost = variable_ptrs[i]->objective_sensitivity();
+            for (const auto& item :
+                 variable_ptrs[i]->constraint_sensitivities()) {
+                reduced_cost += dual_values[item.first->global_index()] *
+                                item.second * a_model->sign();
+            }
+            EXPECT_FLOAT_EQ(reduced_cost, a_ENGINE.reduced_costs()[i]);
+        }
+
+        /// Primal solution
+        a_ENGINE.export_to_model(a_model);
+        const int CONSTRAINTS_SIZE = constraint_ptrs.size();
+        for (auto i = 0; i < CONSTRAINTS_SIZE; i++) {
+            EXPECT_FLOAT_EQ(constraint_ptrs[i]->constraint_value(),
+                            a_ENGINE.constraint_values()[i]);
+        }
+        EXPECT_FLOAT_EQ(a_model->objective().value(), a_ENGINE.objective());
+
+        auto compact_solution = a_ENGINE.export_compact_solution();
+        auto expected_solution = a_model->export_compact_solution();
+        EXPECT_EQ(expected_solution.variables, compact_solution.variables);
+        EXPECT_EQ(expected_solution.violations, compact_solution.violations);
+        EXPECT_FLOAT_EQ(expected_solution.objective,
+                        compact_solution.objective);
+        EXPECT_FLOAT_EQ(expected_solution.total_violation,
+                        compact_solution.total_violation);
+        EXPECT_EQ(expected_solution.is_feasible, compact_solution.is_feasible);
+
+        auto score          = a_ENGINE.evaluate();
+        auto expected_score = a_model->evaluate({});
+        EXPECT_FLOAT_EQ(expected_score.objective, score.objective);
+        EXPECT_FLOAT_EQ(expected_score.total_violation, score.total_violation);
+        EXPECT_FLOAT_EQ(expected_score.local_penalty, score.local_penalty);
+        EXPECT_FLOAT_EQ(expected_score.global_penalty, score.global_penalty);
+        EXPECT_FLOAT_EQ(expected_score.local_augmented_objective,
+                        score.local_augmented_objective);
+        EXPECT_FLOAT_EQ(expected_score.global_augmented_objective,
+                        score.global_augmented_objective);
+        EXPECT_EQ(expected_score.is_feasible, score.is_feasible);
+
+        /// Lagrangian
+        auto dual_value_proxies = printemps::solver::lagrange_dual::
+            LagrangeDualEngine<int, double>::export_dual_value_proxies(
+                a_model, dual_values);
+        EXPECT_FLOAT_EQ(
+            a_model->compute_lagrangian(dual_value_proxies) * a_model->sign(),
+            a_ENGINE.lagrangian());
+    }
+};
+
+/*****************************************************************************/
+TEST_F(TestLagrangeDualEngine, initialize) {
+    printemps::solver::lagrange_dual::LagrangeDualEngine<int, double> engine;
+
+    EXPECT_EQ(true, engine.variable_values().empty());
+    EXPECT_EQ(true, engine.reduced_costs().empty());
+    EXPECT_EQ(true, engine.constraint_values().empty());
+    EXPECT_EQ(true, engine.dual_values().empty());
+    using Constant_T =
+        printemps::solver::lagrange_dual::LagrangeDualEngineConstant;
+    EXPECT_EQ(static_cast<int>(Constant_T::DEFAULT_BLOCK_SIZE),
+              engine.block_size());
+    EXPECT_EQ(0.0, engine.objective());
+    EXPECT_EQ(0.0, engine.lagrangian());
+    EXPECT_EQ(0, engine.number_of_flipped_variables());
+}
+
+/*****************************************************************************/
+TEST_F(TestLagrangeDualEngine, setup) {
+    printemps::model::IPModel model;
+    this->setup_model(&model, true);
+
+    printemps::solver::lagrange_dual::LagrangeDualEngine<int, double> engine;
+    engine.setup(&model);
+
+    EXPECT_EQ(8, static_cast<int>(engine.variable_values().size()));
+    EXPECT_EQ(4, static_cast<int>(engine.constraint_values().size()));
+    EXPECT_EQ(std::vector<double>(4, 0.0), engine.dual_values());
+    EXPECT_FLOAT_EQ(model.objective().value(), engine.objective());
+    EXPECT_FLOAT_EQ(model.objective().value(), engine.lagrangian());
+}
+
+/*****************************************************************************/
+TEST_F(TestLagrangeDualEngine, update_dual) {
+    printemps::model::IPModel model;
+    this->setup_model(&model, true);
+
+    printemps::solver::lagrange_dual::LagrangeDualEngine<int, double> engine;
+    engine.setup(&model);
+
+    auto constraint_values = engine.constraint_values();
+    engine.update_dual(0.5, false);
+
+    const auto& constraint_ptrs = model.constraint_reference().constraint_ptrs;
+    for (auto i = 0; i < 4; i++) {
+        double expected = 0.5 * constraint_values[i];
+        if (constraint_ptrs[i]->sense() ==
+            printemps::model::ConstraintSense::Lower) {
+            expected = std::max(expected, 0.0);
+        } else if (constraint_ptrs[i]->sense() ==
+                   printemps::model::ConstraintSense::Upper) {
+            expected = std::min(expected, 0.0);
+        }
+        EXPECT_FLOAT_EQ(expected, engine.dual_values()[i]);
+    }
+}
+
+/*****************************************************************************/
+TEST_F(TestLagrangeDualEngine, update_dual_from_center) {
+    printemps::model::IPModel model;
+    this->setup_model(&model, true);
+
+    /**
+     * Just after the setup, the center is 0 and the averaged constraint
+     * values are the constraint values, so that the result is identical to
+     * that of update_dual().
+     */
+    printemps::solver::lagrange_dual::LagrangeDualEngine<int, double> engine;
+    printemps::solver::lagrange_dual::LagrangeDualEngine<int, double>
+        expected_engine;
+    engine.setup(&model);
+    expected_engine.setup(&model);
+
+    engine.update_dual_from_center(0.5, false);
+    expected_engine.update_dual(0.5, false);
+    EXPECT_EQ(expected_engine.dual_values(), engine.dual_values());
+    EXPECT_EQ(expected_engine.lagrangian(), engine.lagrangian());
+
+    /**
+     * The dual values move from the center, which is not updated.
+     */
+    engine.update_primal(false);
+    engine.update_average(0.5, false);
+    engine.update_dual_from_center(0.5, false);
+    EXPECT_EQ(std::vector<double>(4, 0.0), engine.center_dual_values());
+
+    const auto& constraint_ptrs = model.constraint_reference().constraint_ptrs;
+    for (auto i = 0; i < 4; i++) {
+        double expected = 0.5 * engine.averaged_constraint_values()[i];
+        if (constraint_ptrs[i]->sense() ==
+            printemps::model::ConstraintSense::Lower) {
+            expected = std::max(expected, 0.0);
+        } else if (constraint_ptrs[i]->sense() ==
+                   printemps::model::ConstraintSense::Upper) {
+            expected = std::min(expected, 0.0);
+        }
+        EXPECT_FLOAT_EQ(expected, engine.dual_values()[i]);
+    }
+
+    engine.update_primal(false);
+    this->verify(&model, engine);
+}
+
+/*****************************************************************************/
+TEST_F(TestLagrangeDualEngine, update_primal) {
+    for (const auto IS_MINIMIZATION : {true, false}) {
+        printemps::model::IPModel model;
+        this->setup_model(&model, IS_MINIMIZATION);
+
+        printemps::solver::lagrange_dual::LagrangeDualEngine<int, double>
+            engine;
+        engine.setup(&model);
+
+        for (auto i = 0; i < 20; i++) {
+            engine.update_dual(0.3, false);
+            engine.update_primal(false);
+            this->verify(&model, engine);
+        }
+
+        /// The fixed variable is not altered.
+        EXPECT_EQ(1, engine.variable_values()[4]);
+    }
+}
+
+/*****************************************************************************/
+TEST_F(TestLagrangeDualEngine, deterministic_reduction) {
+    /**
+     * The results of the parallel iterations must be bitwise identical to
+     * those of the serial iterations for any block size and any number of
+     * threads.
+     */
+#ifdef _OPENMP
+    const int              MAX_THREADS        = omp_get_max_threads();
+    const std::vector<int> NUMBERS_OF_THREADS = {1, 2, 3, 4};
+#else
+    const std::vector<int> NUMBERS_OF_THREADS = {1};
+#endif
+
+    for (const auto NUMBER_OF_THREADS : NUMBERS_OF_THREADS) {
+#ifdef _OPENMP
+        omp_set_num_threads(NUMBER_OF_THREADS);
+#endif
+        for (const auto BLOCK_SIZE : {1, 3, 4096}) {
+            printemps::model::IPModel model;
+            this->setup_model(&model, true);
+
+            printemps::solver::lagrange_dual::LagrangeDualEngine<int, double>
+                serial_engine;
+            printemps::solver::lagrange_dual::LagrangeDualEngine<int, double>
+                parallel_engine;
+            serial_engine.setup(&model);
+            parallel_engine.setup(&model);
+            serial_engine.set_block_size(BLOCK_SIZE);
+            parallel_engine.set_block_size(BLOCK_SIZE);
+
+            for (auto i = 0; i < 20; i++) {
+                serial_engine.update_dual(0.3, false);
+                serial_engine.update_primal(false);
+                parallel_engine.update_dual(0.3, true);
+                parallel_engine.update_primal(true);
+
+                EXPECT_EQ(serial_engine.dual_values(),
+                          parallel_engine.dual_values());
+                EXPECT_EQ(serial_engine.reduced_costs(),
+                          parallel_engine.reduced_costs());
+                EXPECT_EQ(serial_engine.variable_values(),
+                          parallel_engine.variable_values());
+                EXPECT_EQ(serial_engine.lagrangian(),
+                          parallel_engine.lagrangian());
+                EXPECT_EQ(serial_engine.compute_averaging_rate(0.1, false),
+                          parallel_engine.compute_averaging_rate(0.1, true));
+
+                serial_engine.update_average(0.1, false);
+                parallel_engine.update_average(0.1, true);
+                EXPECT_EQ(serial_engine.averaged_total_violation(),
+                          parallel_engine.averaged_total_violation());
+            }
+            this->verify(&model, parallel_engine);
+        }
+    }
+#ifdef _OPENMP
+    omp_set_num_threads(MAX_THREADS);
+#endif
+}
+
+/*****************************************************************************/
+TEST_F(TestLagrangeDualEngine, compute_averaging_rate) {
+    printemps::model::IPModel model;
+    this->setup_model(&model, true);
+
+    printemps::solver::lagrange_dual::LagrangeDualEngine<int, double> engine;
+    engine.setup(&model);
+
+    /**
+     * The rate is the upper bound if the constraint values are identical to
+     * the averaged ones.
+     */
+    EXPECT_FLOAT_EQ(0.1, engine.compute_averaging_rate(0.1, false));
+
+    engine.update_dual(0.3, false);
+    engine.update_primal(false);
+
+    double inner_product = 0.0;
+    double squared_norm  = 0.0;
+    for (auto i = 0; i < 4; i++) {
+        const double AVERAGED   = engine.averaged_constraint_values()[i];
+        const double DIFFERENCE = engine.constraint_values()[i] - AVERAGED;
+        inner_product += AVERAGED * DIFFERENCE;
+        squared_norm += DIFFERENCE * DIFFERENCE;
+    }
+    ASSERT_GT(squared_norm, 0.0);
+    const double RATE = -inner_product / squared_norm;
+
+    EXPECT_FLOAT_EQ(std::max(0.01, std::min(RATE, 0.1)),
+                    engine.compute_averaging_rate(0.1, false));
+    EXPECT_FLOAT_EQ(std::max(0.1, std::min(RATE, 1.0)),
+                    engine.compute_averaging_rate(1.0, false));
+}
+
+/*****************************************************************************/
+TEST_F(TestLagrangeDualEngine, update_average) {
+    printemps::model::IPModel model;
+    this->setup_model(&model, true);
+
+    printemps::solver::lagrange_dual::LagrangeDualEngine<int, double> engine;
+    engine.setup(&model);
+
+    auto averaged_variable_values   = engine.averaged_variable_values();
+    auto averaged_constraint_values = engine.averaged_constraint_values();
+    auto averaged_objective         = engine.averaged_objective();
+
+    engine.update_dual(0.3, false);
+    engine.update_primal(false);
+    engine.update_average(0.25, false);
+
+    for (auto i = 0; i < 8; i++) {
+        EXPECT_FLOAT_EQ(0.25 * engine.variable_values()[i] +
+                            0.75 * averaged_variable_values[i],
+                        engine.averaged_variable_values()[i]);
+    }
+    for (auto i = 0; i < 4; i++) {
+        EXPECT_FLOAT_EQ(0.25 * engine.constraint_values()[i] +
+                            0.75 * averaged_constraint_values[i],
+                        engine.averaged_constraint_values()[i]);
+    }
+    EXPECT_FLOAT_EQ(0.25 * engine.objective() + 0.75 * averaged_objective,
+                    engine.averaged_objective());
+
+    /**
+     * The averages are reset to the current state for the rate 1.
+     */
+    engine.update_average(1.0, false);
+    for (auto i = 0; i < 8; i++) {
+        EXPECT_FLOAT_EQ(engine.variable_values()[i],
+                        engine.averaged_variable_values()[i]);
+    }
+    EXPECT_FLOAT_EQ(engine.objective(), engine.averaged_objective());
+}
+
+/*****************************************************************************/
+TEST_F(TestLagrangeDualEngine, update_center) {
+    printemps::model::IPModel model;
+    this->setup_model(&model, true);
+
+    printemps::solver::lagrange_dual::LagrangeDualEngine<int, double> engine;
+    engine.setup(&model);
+
+    engine.update_dual(0.3, false);
+    EXPECT_EQ(std::vector<double>(4, 0.0), engine.center_dual_values());
+
+    engine.update_center();
+    EXPECT_EQ(engine.dual_values(), engine.center_dual_values());
+}
+
+/*****************************************************************************/
+TEST_F(TestLagrangeDualEngine, averaged_total_violation) {
+    printemps::model::IPModel model;
+    this->setup_model(&model, true);
+
+    printemps::solver::lagrange_dual::LagrangeDualEngine<int, double> engine;
+    engine.setup(&model);
+    EXPECT_FLOAT_EQ(model.evaluate({}).total_violation,
+                    engine.averaged_total_violation());
+
+    engine.update_dual(0.3, false);
+    engine.update_primal(false);
+    engine.update_average(0.5, false);
+
+    const auto& constraint_ptrs = model.constraint_reference().constraint_ptrs;
+    double      expected        = 0.0;
+    for (auto i = 0; i < 4; i++) {
+        expected += constraint_ptrs[i]->compute_violation(
+            engine.averaged_constraint_values()[i]);
+    }
+    EXPECT_FLOAT_EQ(expected, engine.averaged_total_violation());
+}
+
+/*****************************************************************************/
+TEST_F(TestLagrangeDualEngine, evaluate) {
+    /// This method is tested in update_primal().
+}
+
+/*****************************************************************************/
+TEST_F(TestLagrangeDualEngine, export_compact_solution) {
+    /// This method is tested in update_primal().
+}
+
+/*****************************************************************************/
+TEST_F(TestLagrangeDualEngine, export_to_model) {
+    /// This method is tested in update_primal().
+}
+
+/*****************************************************************************/
+TEST_F(TestLagrangeDualEngine, export_dual_value_proxies) {
+    printemps::model::IPModel model;
+    this->setup_model(&model, true);
+
+    auto dual_value_proxies = printemps::solver::lagrange_dual::
+        LagrangeDualEngine<int, double>::export_dual_value_proxies(
+            &model, {1.0, 2.0, 3.0, 4.0});
+
+    EXPECT_EQ(4, static_cast<int>(dual_value_proxies.size()));
+    EXPECT_EQ(1.0, dual_value_proxies[0].value());
+    EXPECT_EQ(4.0, dual_value_proxies[3].value());
+}
+
+/*****************************************************************************/
+TEST_F(TestLagrangeDualEngine, set_block_size) {
+    printemps::solver::lagrange_dual::LagrangeDualEngine<int, double> engine;
+
+    engine.set_block_size(16);
+    EXPECT_EQ(16, engine.block_size());
+
+    engine.set_block_size(0);
+    EXPECT_EQ(1, engine.block_size());
+}
+
+/*****************************************************************************/
+TEST_F(TestLagrangeDualEngine, block_size) {
+    /// This method is tested in set_block_size().
+}
+
+/*****************************************************************************/
+TEST_F(TestLagrangeDualEngine, lagrangian) {
+    /// This method is tested in update_primal().
+}
+
+/*****************************************************************************/
+TEST_F(TestLagrangeDualEngine, objective) {
+    /// This method is tested in update_primal().
+}
+
+/*****************************************************************************/
+TEST_F(TestLagrangeDualEngine, variable_values) {
+    /// This method is tested in update_primal().
+}
+
+/*****************************************************************************/
+TEST_F(TestLagrangeDualEngine, reduced_costs) {
+    /// This method is tested in update_primal().
+}
+
+/*****************************************************************************/
+TEST_F(TestLagrangeDualEngine, constraint_values) {
+    /// This method is tested in update_primal().
+}
+
+/*****************************************************************************/
+TEST_F(TestLagrangeDualEngine, dual_values) {
+    /// This method is tested in update_dual().
+}
+
+/*****************************************************************************/
+TEST_F(TestLagrangeDualEngine, center_dual_values) {
+    /// This method is tested in update_center().
+}
+
+/*****************************************************************************/
+TEST_F(TestLagrangeDualEngine, averaged_variable_values) {
+    /// This method is tested in update_average().
+}
+
+/*****************************************************************************/
+TEST_F(TestLagrangeDualEngine, averaged_constraint_values) {
+    /// This method is tested in update_average().
+}
+
+/*****************************************************************************/
+TEST_F(TestLagrangeDualEngine, averaged_objective) {
+    /// This method is tested in update_average().
+}
+
+/*****************************************************************************/
+TEST_F(TestLagrangeDualEngine, number_of_flipped_variables) {
+    printemps::model::IPModel model;
+    this->setup_model(&model, true);
+
+    printemps::solver::lagrange_dual::LagrangeDualEngine<int, double> engine;
+    engine.setup(&model);
+
+    auto variable_values = engine.variable_values();
+    engine.update_dual(0.3, false);
+    engine.update_primal(false);
+
+    int number_of_flipped_variables = 0;
+    for (auto i = 0; i < 8; i++) {
+        if (engine.variable_values()[i] != variable_values[i]) {
+            number_of_flipped_variables++;
+        }
+    }
+    EXPECT_EQ(number_of_flipped_variables,
+              engine.number_of_flipped_variables());
+}
+}  // namespace
+/*****************************************************************************/
+// END
+/*****************************************************************************/
@@ -0,0 +1,233 @@
+/*****************************************************************************/
+// Copyright (c) 2020 Yuji KOGUMA
+// Released under the MIT license
+// https://opensource.org/licenses/mit-license.php
+/*****************************************************************************/
+#include <gtest/gtest.h>
+#include <random>
+#include <printemps.h>
+
+namespace {
+/*****************************************************************************/
+class TestMemory : public ::testing::Test {
+   protected:
+    virtual void SetUp(void) {
+        /// nothing to do
+    }
+    virtual void TearDown() {
+        /// nothing to do
+    }
+
+    /*************************************************************************/
+    void setup_model(printemps::model::IPModel* a_model) {
+        auto& x = a_model->create_variables("x", 10, 0, 1);
+        auto& y = a_model->create_variables("y", {2, 3}, 0, 1);
+        a_model->create_constraint("c", x.sum() + y.sum() <= 5);
+        a_model->minimize(x.sum() + y.sum());
+        a_model->setup(false, false, false, false, false, false, false, false,
+                       printemps::model::SelectionMode::None, false);
+    }
+
+    /*************************************************************************/
+    double compute_bias(const printemps::solver::Memory& a_MEMORY) {
+        double result = 0.0;
+        for (const auto& count : a_MEMORY.update_counts()) {
+            double frequency =
+                count / static_cast<double>(a_MEMORY.total_update_counts());
+            result += frequency * frequency;
+        }
+        return result;
+    }
+};
+
+/*****************************************************************************/
+TEST_F(TestMemory, initialize) {
+    printemps::solver::Memory memory;
+
+    EXPECT_EQ(true, memory.last_update_iterations().empty());
+    EXPECT_EQ(true, memory.update_counts().empty());
+    EXPECT_EQ(0, memory.total_update_counts());
+    EXPECT_EQ(0, memory.total_squared_update_counts());
+}
+
+/*****************************************************************************/
+TEST_F(TestMemory, setup) {
+    printemps::model::IPModel model;
+    this->setup_model(&model);
+    printemps::solver::Memory memory(&model);
+
+    EXPECT_EQ(16, static_cast<int>(memory.last_update_iterations().size()));
+    EXPECT_EQ(16, static_cast<int>(memory.update_counts().size()));
+    const int INITIAL_LAST_UPDATE_ITERATION =
+        printemps::solver::MemoryConstant::INITIAL_LAST_UPDATE_ITERATION;
+    for (const auto& value : memory.last_update_iterations()) {
+        EXPECT_EQ(INITIAL_LAST_UPDATE_ITERATION, value);
+    }
+    for (const auto& value : memory.update_counts()) {
+        EXPECT_EQ(0, value);
+    }
+    EXPECT_EQ(0, memory.total_update_counts());
+    EXPECT_EQ(0, memory.total_squared_update_counts());
+}
+
+/*****************************************************************************/
+TEST_F(TestMemory, print_last_update_iterations) {
+    /// This method is for debug.
+}
+
+/*****************************************************************************/
+TEST_F(TestMemory, print_update_counts) {
+    /// This method is for debug.
+}
+
+/*****************************************************************************/
+TEST_F(TestMemory, print_frequency) {
+    /// This method is for debug.
+}
+
+/*****************************************************************************/
+TEST_F(TestMemory, print_bias) {
+    /// This method is for debug.
+}
+
+/*****************************************************************************/
+TEST_F(TestMemory, bias) {
+    printemps::model::IPModel model;
+    this->setup_model(&model);
+    printemps::solver::Memory memory(&model);
+
+    const auto& moves = model.neighborhood().binary_moves();
+    std::mt19937 get_rand_mt(0);
+    for (auto i = 0; i < 100; i++) {
+        memory.update(moves[get_rand_mt() % moves.size()], i);
+        EXPECT_FLOAT_EQ(this->compute_bias(memory), memory.bias());
+    }
+
+    /// All updates for one variable.
+    printemps::solver::Memory biased_memory(&model);
+    for (auto i = 0; i < 10; i++) {
+        biased_memory.update(moves[0], i);
+    }
+    EXPECT_FLOAT_EQ(1.0, biased_memory.bias());
+}
+
+/*****************************************************************************/
+TEST_F(TestMemory, update_arg_2) {
+    printemps::model::IPModel model;
+    this->setup_model(&model);
+    printemps::solver::Memory memory(&model);
+
+    const auto& moves = model.neighborhood().binary_moves();
+    memory.update(moves[1], 3);
+    memory.update(moves[1], 5);
+    memory.update(moves[12], 7);
+
+    const auto& last_update_iterations = memory.last_update_iterations();
+    const auto& update_counts          = memory.update_counts();
+
+    EXPECT_EQ(5, last_update_iterations[1]);
+    EXPECT_EQ(7, last_update_iterations[12]);
+    EXPECT_EQ(2, update_counts[1]);
+    EXPECT_EQ(1, update_counts[12]);
+    EXPECT_EQ(3, memory.total_update_counts());
+    EXPECT_EQ(2 * 2 + 1 * 1, memory.total_squared_update_counts());
+}
+
+/*****************************************************************************/
+TEST_F(TestMemory, update_arg_4) {
+    printemps::model::IPModel model;
+    this->setup_model(&model);
+    printemps::solver::Memory memory(&model);
+
+    const auto&  moves = model.neighborhood().binary_moves();
+    std::mt19937 get_rand_mt(0);
+    memory.update(moves[1], 10, 3, &get_rand_mt);
+    memory.update(moves[1], 20, 3, &get_rand_mt);
+
+    const auto& last_update_iterations = memory.last_update_iterations();
+    EXPECT_LE(17, last_update_iterations[1]);
+    EXPECT_GE(23, last_update_iterations[1]);
+    EXPECT_EQ(2, memory.total_update_counts());
+    EXPECT_EQ(4, memory.total_squared_update_counts());
+}
+
+/*****************************************************************************/
+TEST_F(TestMemory, reset_last_update_iterations) {
+    printemps::model::IPModel model;
+    this->setup_model(&model);
+    printemps::solver::Memory memory(&model);
+
+    memory.update(model.neighborhood().binary_moves()[1], 3);
+    memory.reset_last_update_iterations();
+
+    const int INITIAL_LAST_UPDATE_ITERATION =
+        printemps::solver::MemoryConstant::INITIAL_LAST_UPDATE_ITERATION;
+    for (const auto& value : memory.last_update_iterations()) {
+        EXPECT_EQ(INITIAL_LAST_UPDATE_ITERATION, value);
+    }
+    EXPECT_EQ(1, memory.total_update_counts());
+}
+
+/*****************************************************************************/
+TEST_F(TestMemory, import_values) {
+    printemps::model::IPModel model;
+    this->setup_model(&model);
+    printemps::solver::Memory memory(&model);
+
+    std::vector<int> last_update_iterations(16, 0);
+    std::vector<int> update_counts(16, 0);
+    last_update_iterations[4] = 8;
+    update_counts[4]          = 3;
+    update_counts[15]         = 2;
+
+    memory.import_values(last_update_iterations, update_counts, 5);
+
+    EXPECT_EQ(last_update_iterations,
+              memory.last_update_iterations());
+    EXPECT_EQ(update_counts, memory.update_counts());
+    EXPECT_EQ(5, memory.total_update_counts());
+    EXPECT_EQ(3 * 3 + 2 * 2, memory.total_squared_update_counts());
+    EXPECT_FLOAT_EQ(this->compute_bias(memory), memory.bias());
+}
+
+/*****************************************************************************/
+TEST_F(TestMemory, export_update_count_proxies) {
+    printemps::model::IPModel model;
+    this->setup_model(&model);
+    printemps::solver::Memory memory(&model);
+
+    const auto& moves = model.neighborhood().binary_moves();
+    memory.update(moves[1], 0);
+    memory.update(moves[12], 1);
+    memory.update(moves[12], 2);
+
+    auto update_count_proxies = memory.export_update_count_proxies(&model);
+    EXPECT_EQ(2, static_cast<int>(update_count_proxies.size()));
+    EXPECT_EQ(1, update_count_proxies[0](1));
+    EXPECT_EQ(0, update_count_proxies[0](2));
+    EXPECT_EQ(2, update_count_proxies[1](0, 2));
+}
+
+/*****************************************************************************/
+TEST_F(TestMemory, last_update_iterations) {
+    /// This method is tested in setup().
+}
+
+/*****************************************************************************/
+TEST_F(TestMemory, update_counts) {
+    /// This method is tested in setup().
+}
+
+/*****************************************************************************/
+TEST_F(TestMemory, total_update_counts) {
+    /// This method is tested in update_arg_2().
+}
+
+/*****************************************************************************/
+TEST_F(TestMemory, total_squared_update_counts) {
+    /// This method is tested in update_arg_2().
+}
+}  // namespace
+/*****************************************************************************/
+// END
+/*****************************************************************************/
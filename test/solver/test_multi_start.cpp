@@ -0,0 +1,208 @@
+/*****************************************************************************/
+// Copyright (c) 2020 Yuji KOGUMA
+// Released under the MIT license
+// https://opensource.org/licenses/mit-license.php
+/*****************************************************************************/
+#include <gtest/gtest.h>
+#include <atomic>
+#include <csignal>
+#include <fstream>
+#include <random>
+#include <printemps.h>
+
+namespace {
+/*****************************************************************************/
+void handle_test_signal(int) {
+    /// nothing to do
+}
+
+/*****************************************************************************/
+class TestMultiStart : public ::testing::Test {
+   protected:
+    virtual void SetUp(void) {
+        /// nothing to do
+    }
+    virtual void TearDown() {
+        /// nothing to do
+    }
+};
+
+/*****************************************************************************/
+TEST_F(TestMultiStart, is_better) {
+    printemps::model::PlainSolution<int, double> feasible;
+    printemps::model::PlainSolution<int, double> infeasible;
+
+    feasible.objective         = 10.0;
+    feasible.total_violation   = 0.0;
+    feasible.is_feasible       = true;
+    infeasible.objective       = 0.0;
+    infeasible.total_violation = 1.0;
+    infeasible.is_feasible     = false;
+
+    EXPECT_EQ(true, printemps::solver::multi_start::is_better(
+                        feasible, infeasible, 1.0));
+    EXPECT_EQ(false, printemps::solver::multi_start::is_better(
+                         infeasible, feasible, 1.0));
+
+    auto other_feasible      = feasible;
+    other_feasible.objective = 20.0;
+    EXPECT_EQ(true, printemps::solver::multi_start::is_better(
+                        feasible, other_feasible, 1.0));
+    EXPECT_EQ(false, printemps::solver::multi_start::is_better(
+                         feasible, other_feasible, -1.0));
+
+    auto other_infeasible            = infeasible;
+    other_infeasible.total_violation = 2.0;
+    EXPECT_EQ(true, printemps::solver::multi_start::is_better(
+                        infeasible, other_infeasible, 1.0));
+    EXPECT_EQ(true, printemps::solver::multi_start::is_better(
+                        infeasible, other_infeasible, -1.0));
+}
+
+/*****************************************************************************/
+TEST_F(TestMultiStart, solve) {
+    /*************************************************************************/
+    /// Problem statement
+    /*************************************************************************/
+    int number_of_items = 100;
+
+    std::vector<int> weights;
+    std::vector<int> prices;
+
+    for (auto n = 0; n < number_of_items; n++) {
+        prices.push_back(rand() % 100);
+        weights.push_back(prices.back() + rand() % 10);
+    }
+
+    /*************************************************************************/
+    /// Model builder definition
+    /*************************************************************************/
+    auto model_builder = [&weights, &prices,
+                          number_of_items](printemps::model::IPModel* a_model) {
+        auto& x = a_model->create_variables("x", number_of_items, 0, 1);
+
+        auto& total_weight =
+            a_model->create_expression("total_weight", x.dot(weights));
+        auto& total_price =
+            a_model->create_expression("total_price", x.dot(prices));
+
+        a_model->create_constraint("total_weight", total_weight <= 1000);
+        a_model->maximize(total_price);
+    };
+
+    /// solve
+    printemps::solver::Option option;
+
+    option.iteration_max                          = 10;
+    option.time_max                               = 10.0;
+    option.is_enabled_binary_move                 = true;
+    option.verbose                                = printemps::solver::None;
+    option.tabu_search.iteration_max              = 50;
+    option.multi_start.number_of_chains           = 2;
+    option.multi_start.number_of_rounds           = 2;
+    option.multi_start.migration_rate             = 0.5;
+    option.multi_start.is_enabled_parallel_chains = true;
+
+    auto result = printemps::solver::multi_start::solve<int, double>(
+        model_builder, option);
+
+    EXPECT_EQ(true, result.solution.is_feasible());
+    EXPECT_GT(result.solution.objective(), 0);
+    EXPECT_GE(2 * 10, result.status.number_of_tabu_search_loops);
+}
+
+/*****************************************************************************/
+TEST_F(TestMultiStart, solve_with_migration) {
+    /**
+     * Each chain builds its model once, and only the chains which receive
+     * migrants rebuild their models in the following rounds.
+     */
+    std::atomic<int> number_of_builds(0);
+    auto model_builder = [&number_of_builds](
+                             printemps::model::IPModel* a_model) {
+        auto& x = a_model->create_variables("x", 10, 0, 1);
+        a_model->create_constraint("g", x.sum() <= 5);
+        a_model->maximize(x.sum());
+        number_of_builds++;
+    };
+
+    printemps::solver::Option option;
+
+    option.iteration_max                          = 9;
+    option.time_max                               = 10.0;
+    option.verbose                                = printemps::solver::None;
+    option.tabu_search.iteration_max              = 50;
+    option.multi_start.number_of_chains           = 4;
+    option.multi_start.number_of_rounds           = 3;
+    option.multi_start.migration_rate             = 0.25;
+    option.multi_start.is_enabled_parallel_chains = true;
+
+    auto result = printemps::solver::multi_start::solve<int, double>(
+        model_builder, option);
+
+    EXPECT_EQ(4 + 1 + 1, number_of_builds.load());
+    EXPECT_EQ(true, result.solution.is_feasible());
+    EXPECT_EQ(5, result.solution.objective());
+}
+
+/*****************************************************************************/
+TEST_F(TestMultiStart, solve_with_checkpoint) {
+    /**
+     * The chains must not write the checkpoint, and SIGTERM must stop the
+     * rounds. The signal is raised in the model builder of the first round,
+     * after the handler is installed by the multi-start search.
+     */
+    const std::string CHECKPOINT_FILE_NAME = "test_multi_start_checkpoint.bin";
+    std::remove(CHECKPOINT_FILE_NAME.c_str());
+    std::remove((CHECKPOINT_FILE_NAME + ".tmp").c_str());
+
+    std::atomic<int> number_of_builds(0);
+    auto model_builder = [&number_of_builds](
+                             printemps::model::IPModel* a_model) {
+        auto& x = a_model->create_variables("x", 10, 0, 1);
+        a_model->create_constraint("g", x.sum() <= 5);
+        a_model->maximize(x.sum());
+        if (number_of_builds++ == 0) {
+            std::raise(SIGTERM);
+        }
+    };
+
+    printemps::solver::Option option;
+
+    option.iteration_max                          = 10;
+    option.time_max                               = 10.0;
+    option.verbose                                = printemps::solver::None;
+    option.tabu_search.iteration_max              = 50;
+    option.is_enabled_checkpoint                  = true;
+    option.checkpoint_file_name                   = CHECKPOINT_FILE_NAME;
+    option.checkpoint_interval                    = 1;
+    option.multi_start.number_of_chains           = 2;
+    option.multi_start.number_of_rounds           = 3;
+    option.multi_start.is_enabled_parallel_chains = true;
+
+    auto previous_handler = std::signal(SIGTERM, handle_test_signal);
+
+    auto result = printemps::solver::multi_start::solve<int, double>(
+        model_builder, option);
+
+    /// The handler is restored.
+    auto current_handler = std::signal(SIGTERM, previous_handler);
+    EXPECT_EQ(true, current_handler == handle_test_signal);
+
+    /// Only the first round was run.
+    EXPECT_EQ(2, number_of_builds.load());
+
+    /// No checkpoint was written.
+    EXPECT_EQ(false, std::ifstream(CHECKPOINT_FILE_NAME).good());
+    EXPECT_EQ(false, std::ifstream(CHECKPOINT_FILE_NAME + ".tmp").good());
+
+    EXPECT_EQ(true, result.solution.is_feasible());
+
+    /// The flag is cleared when the handler is restored.
+    EXPECT_EQ(false, printemps::utility::TerminationSignalHandler::is_received());
+}
+/*****************************************************************************/
+}  // namespace
+/*****************************************************************************/
+// END
+/*****************************************************************************/
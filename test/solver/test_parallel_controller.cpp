@@ -0,0 +1,178 @@
+/*****************************************************************************/
+// Copyright (c) 2020 Yuji KOGUMA
+// Released under the MIT license
+// https://opensource.org/licenses/mit-license.php
+/*****************************************************************************/
+#include <gtest/gtest.h>
+#include <printemps.h>
+
+namespace {
+/*****************************************************************************/
+class TestParallelController : public ::testing::Test {
+   protected:
+    virtual void SetUp(void) {
+        /// nothing to do
+    }
+    virtual void TearDown() {
+        /// nothing to do
+    }
+};
+
+/*****************************************************************************/
+TEST_F(TestParallelController, parallel_mode_name) {
+    EXPECT_EQ("serial", printemps::solver::parallel_mode_name(
+                            printemps::solver::ParallelMode::Serial));
+    EXPECT_EQ("parallel", printemps::solver::parallel_mode_name(
+                              printemps::solver::ParallelMode::Parallel));
+    EXPECT_EQ("calibrating", printemps::solver::parallel_mode_name(
+                                 printemps::solver::ParallelMode::Calibrating));
+}
+
+/*****************************************************************************/
+TEST_F(TestParallelController, initialize) {
+    printemps::solver::ParallelController controller;
+
+    EXPECT_EQ(false, controller.is_enabled_adaptive());
+    EXPECT_EQ(0, controller.parallel_size_threshold());
+    EXPECT_EQ(printemps::solver::ParallelMode::Serial,
+              controller.last_mode(
+                  printemps::solver::ParallelPhase::NeighborhoodUpdate));
+    EXPECT_EQ(printemps::solver::ParallelMode::Serial,
+              controller.last_mode(printemps::solver::ParallelPhase::Evaluation));
+    EXPECT_EQ(false, controller.is_parallel(
+                         printemps::solver::ParallelPhase::Evaluation, 100));
+}
+
+/*****************************************************************************/
+TEST_F(TestParallelController, setup) {
+    printemps::solver::ParallelController controller;
+    controller.setup(true, false, true, 100);
+
+    EXPECT_EQ(true, controller.is_enabled_adaptive());
+    EXPECT_EQ(100, controller.parallel_size_threshold());
+}
+
+/*****************************************************************************/
+TEST_F(TestParallelController, is_parallel) {
+    const auto NEIGHBORHOOD_UPDATE =
+        printemps::solver::ParallelPhase::NeighborhoodUpdate;
+    const auto EVALUATION = printemps::solver::ParallelPhase::Evaluation;
+    const int  TRIALS =
+        printemps::solver::ParallelControllerConstant::
+            NUMBER_OF_CALIBRATION_TRIALS;
+
+    /// Non-adaptive
+    {
+        printemps::solver::ParallelController controller;
+        controller.setup(true, false, false, 100);
+
+        EXPECT_EQ(false, controller.is_parallel(NEIGHBORHOOD_UPDATE, 99));
+        EXPECT_EQ(printemps::solver::ParallelMode::Serial,
+                  controller.last_mode(NEIGHBORHOOD_UPDATE));
+
+        EXPECT_EQ(true, controller.is_parallel(NEIGHBORHOOD_UPDATE, 100));
+        EXPECT_EQ(printemps::solver::ParallelMode::Parallel,
+                  controller.last_mode(NEIGHBORHOOD_UPDATE));
+
+        EXPECT_EQ(false, controller.is_parallel(EVALUATION, 100));
+        EXPECT_EQ(printemps::solver::ParallelMode::Serial,
+                  controller.last_mode(EVALUATION));
+    }
+
+    /// Adaptive: the parallel execution is faster.
+    {
+        printemps::solver::ParallelController controller;
+        controller.setup(true, true, true, 100);
+
+        for (auto i = 0; i < 2 * TRIALS; i++) {
+            const bool IS_PARALLEL = controller.is_parallel(EVALUATION, 1000);
+            EXPECT_EQ(i % 2 == 1, IS_PARALLEL);
+            EXPECT_EQ(printemps::solver::ParallelMode::Calibrating,
+                      controller.last_mode(EVALUATION));
+            controller.record(EVALUATION, 1000, IS_PARALLEL,
+                              IS_PARALLEL ? 1.0 : 2.0);
+        }
+        EXPECT_EQ(true, controller.is_parallel(EVALUATION, 1000));
+        EXPECT_EQ(printemps::solver::ParallelMode::Parallel,
+                  controller.last_mode(EVALUATION));
+
+        /// The same size class shares the calibration.
+        EXPECT_EQ(true, controller.is_parallel(EVALUATION, 1023));
+
+        /// Another size class requires another calibration.
+        EXPECT_EQ(false, controller.is_parallel(EVALUATION, 1024));
+        EXPECT_EQ(printemps::solver::ParallelMode::Calibrating,
+                  controller.last_mode(EVALUATION));
+
+        /// The phases are calibrated independently.
+        EXPECT_EQ(false, controller.is_parallel(NEIGHBORHOOD_UPDATE, 1000));
+        EXPECT_EQ(printemps::solver::ParallelMode::Calibrating,
+                  controller.last_mode(NEIGHBORHOOD_UPDATE));
+    }
+
+    /// Adaptive: the serial execution is faster.
+    {
+        printemps::solver::ParallelController controller;
+        controller.setup(true, true, true, 100);
+
+        for (auto i = 0; i < 2 * TRIALS; i++) {
+            const bool IS_PARALLEL = controller.is_parallel(EVALUATION, 1000);
+            controller.record(EVALUATION, 1000, IS_PARALLEL,
+                              IS_PARALLEL ? 2.0 : 1.0);
+        }
+        EXPECT_EQ(false, controller.is_parallel(EVALUATION, 1000));
+        EXPECT_EQ(printemps::solver::ParallelMode::Serial,
+                  controller.last_mode(EVALUATION));
+    }
+}
+
+/*****************************************************************************/
+TEST_F(TestParallelController, is_calibrating) {
+    const auto EVALUATION = printemps::solver::ParallelPhase::Evaluation;
+    const int  TRIALS =
+        printemps::solver::ParallelControllerConstant::
+            NUMBER_OF_CALIBRATION_TRIALS;
+
+    printemps::solver::ParallelController controller;
+
+    controller.setup(true, true, false, 100);
+    EXPECT_EQ(false, controller.is_calibrating(EVALUATION, 1000));
+
+    controller.setup(true, true, true, 100);
+    EXPECT_EQ(false, controller.is_calibrating(EVALUATION, 10));
+    EXPECT_EQ(true, controller.is_calibrating(EVALUATION, 1000));
+
+    for (auto i = 0; i < TRIALS; i++) {
+        controller.record(EVALUATION, 1000, false, 1.0);
+    }
+    EXPECT_EQ(true, controller.is_calibrating(EVALUATION, 1000));
+
+    for (auto i = 0; i < TRIALS; i++) {
+        controller.record(EVALUATION, 1000, true, 1.0);
+    }
+    EXPECT_EQ(false, controller.is_calibrating(EVALUATION, 1000));
+}
+
+/*****************************************************************************/
+TEST_F(TestParallelController, record) {
+    /// This method is tested in is_parallel() and is_calibrating().
+}
+
+/*****************************************************************************/
+TEST_F(TestParallelController, is_enabled_adaptive) {
+    /// This method is tested in setup().
+}
+
+/*****************************************************************************/
+TEST_F(TestParallelController, parallel_size_threshold) {
+    /// This method is tested in setup().
+}
+
+/*****************************************************************************/
+TEST_F(TestParallelController, last_mode) {
+    /// This method is tested in is_parallel().
+}
+}  // namespace
+/*****************************************************************************/
+// END
+/*****************************************************************************/
@@ -0,0 +1,203 @@
+/*****************************************************************************/
+// Copyright (c) 2020 Yuji KOGUMA
+// Released under the MIT license
+// https://opensource.org/licenses/mit-license.php
+/*****************************************************************************/
+#include <gtest/gtest.h>
+#include <cstdio>
+#include <fstream>
+#include <printemps.h>
+
+namespace {
+/*****************************************************************************/
+class TestProfiler : public ::testing::Test {
+   protected:
+    virtual void SetUp(void) {
+        /// nothing to do
+    }
+    virtual void TearDown() {
+        /// nothing to do
+    }
+};
+
+/*****************************************************************************/
+TEST_F(TestProfiler, initialize) {
+    printemps::solver::Profiler profiler;
+
+    EXPECT_EQ(false, profiler.is_enabled());
+    for (auto i = 0; i < printemps::solver::ProfilerConstant::NUMBER_OF_PHASES;
+         i++) {
+        const auto PHASE = static_cast<printemps::solver::ProfilePhase>(i);
+        EXPECT_EQ(0.0, profiler.elapsed_time(PHASE));
+        EXPECT_EQ(0, profiler.count(PHASE));
+        EXPECT_EQ(0.0, profiler.iteration_elapsed_time(PHASE));
+    }
+}
+
+/*****************************************************************************/
+TEST_F(TestProfiler, setup) {
+    printemps::solver::Profiler profiler;
+
+    profiler.setup(true);
+    EXPECT_EQ(true, profiler.is_enabled());
+
+    profiler.setup(false);
+    EXPECT_EQ(false, profiler.is_enabled());
+}
+
+/*****************************************************************************/
+TEST_F(TestProfiler, start_iteration) {
+    printemps::solver::Profiler profiler;
+    profiler.setup(true);
+
+    profiler.start();
+    profiler.stop(printemps::solver::ProfilePhase::Evaluation);
+    profiler.start_iteration();
+
+    EXPECT_EQ(0.0, profiler.iteration_elapsed_time(
+                       printemps::solver::ProfilePhase::Evaluation));
+    EXPECT_EQ(1, profiler.count(printemps::solver::ProfilePhase::Evaluation));
+}
+
+/*****************************************************************************/
+TEST_F(TestProfiler, start) {
+    /// This method is tested in stop().
+}
+
+/*****************************************************************************/
+TEST_F(TestProfiler, stop) {
+    printemps::solver::Profiler profiler;
+
+    /// Nothing is measured if the profiler is not enabled.
+    profiler.start();
+    profiler.stop(printemps::solver::ProfilePhase::Selection);
+    EXPECT_EQ(0, profiler.count(printemps::solver::ProfilePhase::Selection));
+
+    profiler.setup(true);
+    profiler.start();
+    profiler.stop(printemps::solver::ProfilePhase::Selection);
+    profiler.start();
+    profiler.stop(printemps::solver::ProfilePhase::Selection);
+
+    EXPECT_EQ(2, profiler.count(printemps::solver::ProfilePhase::Selection));
+    EXPECT_LE(0.0,
+              profiler.elapsed_time(printemps::solver::ProfilePhase::Selection));
+    EXPECT_EQ(0, profiler.count(printemps::solver::ProfilePhase::Evaluation));
+}
+
+/*****************************************************************************/
+TEST_F(TestProfiler, merge) {
+    printemps::solver::Profiler profiler;
+    printemps::solver::Profiler other;
+    other.setup(true);
+    other.start();
+    other.stop(printemps::solver::ProfilePhase::ModelUpdate);
+
+    profiler.merge(other);
+    profiler.merge(other);
+
+    EXPECT_EQ(2, profiler.count(printemps::solver::ProfilePhase::ModelUpdate));
+    EXPECT_EQ(
+        2.0 * other.elapsed_time(printemps::solver::ProfilePhase::ModelUpdate),
+        profiler.elapsed_time(printemps::solver::ProfilePhase::ModelUpdate));
+}
+
+/*****************************************************************************/
+TEST_F(TestProfiler, is_enabled) {
+    /// This method is tested in setup().
+}
+
+/*****************************************************************************/
+TEST_F(TestProfiler, elapsed_time) {
+    /// This method is tested in stop() and merge().
+}
+
+/*****************************************************************************/
+TEST_F(TestProfiler, count) {
+    /// This method is tested in stop() and merge().
+}
+
+/*****************************************************************************/
+TEST_F(TestProfiler, iteration_elapsed_time) {
+    /// This method is tested in start_iteration().
+}
+
+/*****************************************************************************/
+TEST_F(TestProfiler, profile_phase_name) {
+    EXPECT_EQ("evaluation", printemps::solver::profile_phase_name(
+                                printemps::solver::ProfilePhase::Evaluation));
+    EXPECT_EQ("primal_update",
+              printemps::solver::profile_phase_name(
+                  printemps::solver::ProfilePhase::PrimalUpdate));
+    EXPECT_EQ("averaging", printemps::solver::profile_phase_name(
+                               printemps::solver::ProfilePhase::Averaging));
+}
+
+/*****************************************************************************/
+TEST_F(TestProfiler, trace_writer) {
+    printemps::solver::TraceWriter  trace_writer;
+    printemps::solver::Profiler     profiler;
+    printemps::model::SolutionScore score = {};
+
+    EXPECT_EQ(false, trace_writer.is_enabled());
+    EXPECT_EQ("trace.csv", printemps::solver::TraceWriter::file_name(
+                               "trace", printemps::solver::TraceMode::CSV));
+    EXPECT_EQ("trace.jsonl", printemps::solver::TraceWriter::file_name(
+                                 "trace", printemps::solver::TraceMode::JSONL));
+
+    trace_writer.create("test_trace", printemps::solver::TraceMode::CSV);
+    trace_writer.open("test_trace", printemps::solver::TraceMode::CSV);
+    EXPECT_EQ(true, trace_writer.is_enabled());
+    trace_writer.write("tabu_search", 0, 0.0, score, 10, profiler);
+    trace_writer.write("tabu_search", 1, 0.1, score, 10, profiler);
+    trace_writer.close();
+
+    /// The header and two records are written.
+    std::ifstream ifs("test_trace.csv");
+    std::string   line;
+    int           number_of_lines = 0;
+    while (std::getline(ifs, line)) {
+        number_of_lines++;
+    }
+    ifs.close();
+    EXPECT_EQ(3, number_of_lines);
+
+    std::remove("test_trace.csv");
+}
+
+/*****************************************************************************/
+TEST_F(TestProfiler, trace_writer_jsonl) {
+    printemps::solver::TraceWriter  trace_writer;
+    printemps::solver::Profiler     profiler;
+    printemps::model::SolutionScore score = {};
+
+    score.objective                  = 1.0 / 3.0;
+    score.total_violation            = 0.0;
+    score.global_augmented_objective = HUGE_VAL;
+
+    trace_writer.create("test_trace", printemps::solver::TraceMode::JSONL);
+    trace_writer.open("test_trace", printemps::solver::TraceMode::JSONL);
+    trace_writer.write("tabu_search", 0, 0.0, score, 10, profiler);
+    trace_writer.close();
+
+    std::ifstream ifs("test_trace.jsonl");
+    std::string   line;
+    std::getline(ifs, line);
+    ifs.close();
+
+    /// The value is restored exactly.
+    const std::string KEY      = "\"objective\":";
+    const auto        POSITION = line.find(KEY);
+    ASSERT_NE(std::string::npos, POSITION);
+    EXPECT_EQ(1.0 / 3.0, std::stod(line.substr(POSITION + KEY.size())));
+
+    /// The non-finite value is written as null.
+    EXPECT_NE(std::string::npos,
+              line.find("\"global_augmented_objective\":null,"));
+
+    std::remove("test_trace.jsonl");
+}
+}  // namespace
+/*****************************************************************************/
+// END
+/*****************************************************************************/
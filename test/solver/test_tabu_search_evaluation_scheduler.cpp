@@ -0,0 +1,201 @@
+/*****************************************************************************/
+// Copyright (c) 2020 Yuji KOGUMA
+// Released under the MIT license
+// https://opensource.org/licenses/mit-license.php
+/*****************************************************************************/
+#include <gtest/gtest.h>
+#include <printemps.h>
+
+namespace {
+/*****************************************************************************/
+class TestTabuSearchEvaluationScheduler : public ::testing::Test {
+   protected:
+    virtual void SetUp(void) {
+        /// nothing to do
+    }
+    virtual void TearDown() {
+        /// nothing to do
+    }
+};
+
+/*****************************************************************************/
+TEST_F(TestTabuSearchEvaluationScheduler, evaluation_summary_initialize) {
+    printemps::solver::tabu_search::EvaluationSummary summary;
+    EXPECT_EQ(std::numeric_limits<double>::max(), summary.min_total_score);
+    EXPECT_EQ(std::numeric_limits<int>::max(), summary.argmin_total_score);
+    EXPECT_EQ(std::numeric_limits<double>::max(),
+              summary.min_global_augmented_objective);
+    EXPECT_EQ(std::numeric_limits<int>::max(),
+              summary.argmin_global_augmented_objective);
+    EXPECT_EQ(0, summary.number_of_feasible_moves);
+    EXPECT_EQ(0, summary.number_of_permissible_moves);
+    EXPECT_EQ(0, summary.number_of_improvable_moves);
+    EXPECT_EQ(0.0, summary.max_abs_objective_improvement);
+    EXPECT_EQ(std::numeric_limits<double>::max(),
+              summary.min_infeasible_local_penalty);
+}
+
+/*****************************************************************************/
+TEST_F(TestTabuSearchEvaluationScheduler, evaluation_summary_update_argmin) {
+    printemps::solver::tabu_search::EvaluationSummary summary;
+    summary.update_argmin(3, 1.0, 5.0);
+    summary.update_argmin(1, 1.0, 4.0);
+    summary.update_argmin(2, 2.0, 4.0);
+
+    /// Ties are broken by the smaller index.
+    EXPECT_EQ(1.0, summary.min_total_score);
+    EXPECT_EQ(1, summary.argmin_total_score);
+    EXPECT_EQ(4.0, summary.min_global_augmented_objective);
+    EXPECT_EQ(1, summary.argmin_global_augmented_objective);
+}
+
+/*****************************************************************************/
+TEST_F(TestTabuSearchEvaluationScheduler, evaluation_summary_update) {
+    printemps::solver::tabu_search::EvaluationSummary summary;
+
+    printemps::model::SolutionScore score_feasible   = {};
+    score_feasible.is_feasible                       = true;
+    score_feasible.objective_improvement             = -3.0;
+    score_feasible.global_augmented_objective        = 10.0;
+    printemps::model::SolutionScore score_infeasible = {};
+    score_infeasible.is_feasible                     = false;
+    score_infeasible.is_feasibility_improvable       = true;
+    score_infeasible.objective_improvement           = 2.0;
+    score_infeasible.local_penalty                   = 7.0;
+    score_infeasible.global_augmented_objective      = 20.0;
+
+    summary.update(0, score_feasible, true, 1.0);
+    summary.update(1, score_infeasible, false, 0.5);
+
+    EXPECT_EQ(1, summary.argmin_total_score);
+    EXPECT_EQ(0, summary.argmin_global_augmented_objective);
+    EXPECT_EQ(1, summary.number_of_feasible_moves);
+    EXPECT_EQ(1, summary.number_of_permissible_moves);
+    EXPECT_EQ(1, summary.number_of_improvable_moves);
+    EXPECT_EQ(3.0, summary.max_abs_objective_improvement);
+    EXPECT_EQ(7.0, summary.min_infeasible_local_penalty);
+}
+
+/*****************************************************************************/
+TEST_F(TestTabuSearchEvaluationScheduler, evaluation_summary_merge) {
+    printemps::model::SolutionScore score = {};
+    score.is_feasible                     = true;
+
+    printemps::solver::tabu_search::EvaluationSummary summary_first;
+    summary_first.update_argmin(5, 1.0, 3.0);
+    summary_first.update(5, score, true, 1.0);
+
+    printemps::solver::tabu_search::EvaluationSummary summary_second;
+    summary_second.update_argmin(2, 1.0, 4.0);
+    summary_second.update(2, score, false, 1.0);
+
+    printemps::solver::tabu_search::EvaluationSummary summary_empty;
+
+    summary_first.merge(summary_second);
+    summary_first.merge(summary_empty);
+    EXPECT_EQ(2, summary_first.argmin_total_score);
+    EXPECT_EQ(2, summary_first.argmin_global_augmented_objective);
+    EXPECT_EQ(0.0, summary_first.min_global_augmented_objective);
+    EXPECT_EQ(2, summary_first.number_of_feasible_moves);
+    EXPECT_EQ(1, summary_first.number_of_permissible_moves);
+}
+
+/*****************************************************************************/
+TEST_F(TestTabuSearchEvaluationScheduler, initialize) {
+    printemps::solver::tabu_search::EvaluationScheduler<int, double> scheduler;
+    EXPECT_EQ(1, scheduler.number_of_chunks_max());
+    EXPECT_EQ(true, scheduler.chunk_begins().empty());
+}
+
+/*****************************************************************************/
+TEST_F(TestTabuSearchEvaluationScheduler, setup) {
+    printemps::solver::tabu_search::EvaluationScheduler<int, double> scheduler;
+
+    scheduler.setup(1);
+    EXPECT_EQ(1, scheduler.number_of_chunks_max());
+
+    scheduler.setup(4);
+    EXPECT_EQ(4 * printemps::solver::tabu_search::EvaluationSchedulerConstant::
+                      DEFAULT_NUMBER_OF_CHUNKS_PER_THREAD,
+              scheduler.number_of_chunks_max());
+}
+
+/*****************************************************************************/
+TEST_F(TestTabuSearchEvaluationScheduler, prepare) {
+    printemps::model::Model<int, double> model;
+
+    auto& x = model.create_variables("x", 10, 0, 1);
+    model.create_constraint("g", x.sum() <= 5);
+    for (auto i = 0; i < 5; i++) {
+        model.create_constraint("h_" + std::to_string(i), x(0) + x(i + 1) <= 1);
+    }
+    model.setup_variable_related_constraints();
+
+    std::vector<printemps::model::Move<int, double>>   moves(10);
+    std::vector<printemps::model::Move<int, double>*> move_ptrs;
+    for (auto i = 0; i < 10; i++) {
+        moves[i].alterations.emplace_back(&x(i), 1);
+        moves[i].related_constraint_ptrs = x(i).related_constraint_ptrs();
+        move_ptrs.push_back(&moves[i]);
+    }
+
+    /// Serial
+    {
+        printemps::solver::tabu_search::EvaluationScheduler<int, double>
+            scheduler;
+        scheduler.setup(1);
+        scheduler.prepare(move_ptrs, 10, true);
+        EXPECT_EQ(1, scheduler.number_of_chunks());
+        EXPECT_EQ(std::vector<int>({0, 10}), scheduler.chunk_begins());
+    }
+
+    /// Parallel evaluation is disabled
+    {
+        printemps::solver::tabu_search::EvaluationScheduler<int, double>
+            scheduler;
+        scheduler.setup(2);
+        scheduler.prepare(move_ptrs, 10, false);
+        EXPECT_EQ(1, scheduler.number_of_chunks());
+        EXPECT_EQ(std::vector<int>({0, 10}), scheduler.chunk_begins());
+    }
+
+    /// Parallel
+    {
+        printemps::solver::tabu_search::EvaluationScheduler<int, double>
+            scheduler;
+        scheduler.setup(2);
+        scheduler.prepare(move_ptrs, 10, true);
+
+        /// The chunks cover all moves without overlaps.
+        const auto& chunk_begins = scheduler.chunk_begins();
+        EXPECT_EQ(0, chunk_begins.front());
+        EXPECT_EQ(10, chunk_begins.back());
+        for (auto i = 0; i < scheduler.number_of_chunks(); i++) {
+            EXPECT_LT(chunk_begins[i], chunk_begins[i + 1]);
+        }
+        EXPECT_LE(scheduler.number_of_chunks(),
+                  scheduler.number_of_chunks_max());
+
+        /// The most expensive move x(0) forms a chunk by itself.
+        EXPECT_EQ(1, chunk_begins[1]);
+    }
+}
+
+/*****************************************************************************/
+TEST_F(TestTabuSearchEvaluationScheduler, number_of_chunks_max) {
+    /// This method is tested in setup().
+}
+
+/*****************************************************************************/
+TEST_F(TestTabuSearchEvaluationScheduler, number_of_chunks) {
+    /// This method is tested in prepare().
+}
+
+/*****************************************************************************/
+TEST_F(TestTabuSearchEvaluationScheduler, chunk_begins) {
+    /// This method is tested in prepare().
+}
+}  // namespace
+/*****************************************************************************/
+// END
+/*****************************************************************************/
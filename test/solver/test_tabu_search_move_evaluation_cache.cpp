@@ -0,0 +1,195 @@
+/*****************************************************************************/
+// Copyright (c) 2020 Yuji KOGUMA
+// Released under the MIT license
+// https://opensource.org/licenses/mit-license.php
+/*****************************************************************************/
+#include <gtest/gtest.h>
+#include <printemps.h>
+
+namespace {
+/*****************************************************************************/
+class TestTabuSearchMoveEvaluationCache : public ::testing::Test {
+   protected:
+    virtual void SetUp(void) {
+        /// nothing to do
+    }
+    virtual void TearDown() {
+        /// nothing to do
+    }
+};
+
+/*****************************************************************************/
+printemps::model::Move<int, double> create_binary_move(
+    printemps::model::Variable<int, double>* a_variable_ptr) {
+    printemps::model::Move<int, double> move;
+    move.sense = printemps::model::MoveSense::Binary;
+    move.alterations.emplace_back(a_variable_ptr, 1 - a_variable_ptr->value());
+    for (auto&& constraint_ptr : a_variable_ptr->related_constraint_ptrs()) {
+        move.related_constraint_ptrs.insert(constraint_ptr);
+    }
+    move.is_special_neighborhood_move = false;
+    move.is_available                 = true;
+    move.overlap_rate                 = 0.0;
+    return move;
+}
+
+/*****************************************************************************/
+TEST_F(TestTabuSearchMoveEvaluationCache, initialize) {
+    printemps::solver::tabu_search::MoveEvaluationCache<int, double> cache;
+    EXPECT_EQ(0, cache.number_of_entries());
+}
+
+/*****************************************************************************/
+TEST_F(TestTabuSearchMoveEvaluationCache, setup) {
+    /// This method is tested in restore().
+}
+
+/*****************************************************************************/
+TEST_F(TestTabuSearchMoveEvaluationCache, prepare) {
+    printemps::model::Model<int, double> model;
+
+    auto& x = model.create_variables("x", 2, 0, 1);
+    model.setup_variable_related_constraints();
+
+    std::vector<printemps::model::Move<int, double>> binary_moves = {
+        create_binary_move(&x(0)), create_binary_move(&x(1))};
+    std::vector<printemps::model::Move<int, double>> integer_moves;
+    std::vector<printemps::model::Move<int, double>> selection_moves;
+
+    /// A move which is not in the static neighborhoods.
+    auto move_0 = create_binary_move(&x(0));
+
+    /// A chain move.
+    auto move_1  = create_binary_move(&x(1));
+    move_1.sense = printemps::model::MoveSense::Chain;
+
+    printemps::solver::tabu_search::MoveEvaluationCache<int, double> cache;
+    cache.setup(2, binary_moves, integer_moves, selection_moves);
+
+    /// The entries are assigned for the moves in the static neighborhoods.
+    EXPECT_EQ(2, cache.number_of_entries());
+
+    std::vector<printemps::model::Move<int, double>*> move_ptrs = {
+        &binary_moves[1], &move_0, &move_1, &binary_moves[0]};
+    cache.prepare(move_ptrs, 4);
+
+    auto current_score = model.evaluate({});
+    auto score_0       = model.evaluate(binary_moves[0], current_score);
+    auto score_1       = model.evaluate(binary_moves[1], current_score);
+
+    for (auto i = 0; i < 4; i++) {
+        cache.store(i, (i == 3) ? score_0 : score_1, current_score, 0);
+    }
+
+    /// Only the moves in the static neighborhoods are restored.
+    printemps::model::SolutionScore score;
+    EXPECT_EQ(true, cache.restore(&score, 0, binary_moves[1], current_score));
+    EXPECT_FLOAT_EQ(score_1.objective, score.objective);
+    EXPECT_EQ(false, cache.restore(&score, 1, move_0, current_score));
+    EXPECT_EQ(false, cache.restore(&score, 2, move_1, current_score));
+    EXPECT_EQ(true, cache.restore(&score, 3, binary_moves[0], current_score));
+    EXPECT_FLOAT_EQ(score_0.objective, score.objective);
+
+    /// The entries are kept for the same moves in the following iterations.
+    move_ptrs = {&binary_moves[0]};
+    cache.prepare(move_ptrs, 1);
+    EXPECT_EQ(2, cache.number_of_entries());
+    EXPECT_EQ(true, cache.restore(&score, 0, binary_moves[0], current_score));
+    EXPECT_FLOAT_EQ(score_0.objective, score.objective);
+}
+
+/*****************************************************************************/
+TEST_F(TestTabuSearchMoveEvaluationCache, restore) {
+    printemps::model::Model<int, double> model;
+
+    auto& x = model.create_variables("x", 4, 0, 1);
+    auto& g = model.create_constraints("g", 2);
+    g(0)    = x(0) + x(1) <= 1;
+    g(1)    = x(2) + x(3) >= 1;
+
+    g(0).local_penalty_coefficient()  = 10;
+    g(1).local_penalty_coefficient()  = 10;
+    g(0).global_penalty_coefficient() = 100;
+    g(1).global_penalty_coefficient() = 100;
+
+    model.minimize(x(0) + 2 * x(1) + 3 * x(2) + 4 * x(3));
+
+    model.setup_variable_related_constraints();
+    model.categorize_variables();
+    model.categorize_constraints();
+    model.update();
+
+    std::vector<printemps::model::Move<int, double>> moves;
+    for (auto&& element : x.flat_indexed_variables()) {
+        moves.push_back(create_binary_move(&element));
+    }
+    std::vector<printemps::model::Move<int, double>*> move_ptrs;
+    for (auto&& move : moves) {
+        move_ptrs.push_back(&move);
+    }
+
+    std::vector<printemps::model::Move<int, double>> integer_moves;
+    std::vector<printemps::model::Move<int, double>> selection_moves;
+
+    printemps::solver::tabu_search::MoveEvaluationCache<int, double> cache;
+    cache.setup(model.number_of_variables(), moves, integer_moves,
+                selection_moves);
+    cache.prepare(move_ptrs, 4);
+
+    auto current_score = model.evaluate({});
+
+    /// No move is restored before it is stored.
+    printemps::model::SolutionScore score;
+    for (auto i = 0; i < 4; i++) {
+        EXPECT_EQ(false, cache.restore(&score, i, moves[i], current_score));
+        model.evaluate(&score, moves[i], current_score);
+        cache.store(i, score, current_score, 0);
+    }
+
+    /// Apply the move for x(2), which affects the moves for x(2) and x(3).
+    model.update(moves[2]);
+    cache.invalidate(moves[2], 0);
+    current_score = model.evaluate({});
+
+    for (auto i = 0; i < 4; i++) {
+        moves[i].alterations.front().second = 1 - x(i).value();
+    }
+
+    EXPECT_EQ(true, cache.restore(&score, 0, moves[0], current_score));
+    auto expected = model.evaluate(moves[0], current_score);
+    EXPECT_FLOAT_EQ(expected.objective, score.objective);
+    EXPECT_FLOAT_EQ(expected.total_violation, score.total_violation);
+    EXPECT_FLOAT_EQ(expected.local_penalty, score.local_penalty);
+    EXPECT_FLOAT_EQ(expected.global_penalty, score.global_penalty);
+    EXPECT_FLOAT_EQ(expected.local_augmented_objective,
+                    score.local_augmented_objective);
+    EXPECT_FLOAT_EQ(expected.global_augmented_objective,
+                    score.global_augmented_objective);
+    EXPECT_EQ(expected.is_feasible, score.is_feasible);
+    EXPECT_EQ(expected.is_objective_improvable, score.is_objective_improvable);
+    EXPECT_EQ(expected.is_feasibility_improvable,
+              score.is_feasibility_improvable);
+
+    EXPECT_EQ(true, cache.restore(&score, 1, moves[1], current_score));
+    EXPECT_EQ(false, cache.restore(&score, 2, moves[2], current_score));
+    EXPECT_EQ(false, cache.restore(&score, 3, moves[3], current_score));
+}
+
+/*****************************************************************************/
+TEST_F(TestTabuSearchMoveEvaluationCache, store) {
+    /// This method is tested in restore().
+}
+
+/*****************************************************************************/
+TEST_F(TestTabuSearchMoveEvaluationCache, invalidate) {
+    /// This method is tested in restore().
+}
+
+/*****************************************************************************/
+TEST_F(TestTabuSearchMoveEvaluationCache, number_of_entries) {
+    /// This method is tested in prepare().
+}
+}  // namespace
+/*****************************************************************************/
+// END
+/*****************************************************************************/
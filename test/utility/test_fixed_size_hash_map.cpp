@@ -55,6 +55,7 @@ TEST_F(TestFixedSizeHashMap, setup) {
 
     auto& x = model.create_variables("x", {10, 20});
     auto& y = model.create_variables("y", {20, 30, 40});
+    auto& z = model.create_variable("z");
 
     std::unordered_map<printemps::model::Variable<int, double>*, double>
         unordered_map;
@@ -80,20 +81,104 @@ TEST_F(TestFixedSizeHashMap, setup) {
         fixed_size_hash_map.shift_size());
 
     /// 10 * 20 + 20 * 30 * 40 = 200 + 24000
-    /// 262144 < 24000 * 10(LOAD_MARGIN) < 262144
-    std::size_t expected_bucket_size = 262144;
+    /// 32768 < 24200 / 0.5(DEFAULT_LOAD_FACTOR) < 65536
+    std::size_t expected_bucket_size = 65536;
     EXPECT_EQ(expected_bucket_size, fixed_size_hash_map.bucket_size());
 
     for (const auto& element : unordered_map) {
         EXPECT_EQ(element.second, fixed_size_hash_map.at(element.first));
     }
+    EXPECT_EQ(0, fixed_size_hash_map.at(&z(0)));
+
+    /// 131072 < 24200 / 0.1 < 262144
+    fixed_size_hash_map.setup(
+        unordered_map, sizeof(printemps::model::Variable<int, double>), 0.1);
+    expected_bucket_size = 262144;
+    EXPECT_EQ(expected_bucket_size, fixed_size_hash_map.bucket_size());
+
+    for (const auto& element : unordered_map) {
+        EXPECT_EQ(element.second, fixed_size_hash_map.at(element.first));
+    }
+
+    /// The load factor must be in (0, 1).
+    ASSERT_THROW(fixed_size_hash_map.setup(
+                     unordered_map,
+                     sizeof(printemps::model::Variable<int, double>), 1.0),
+                 std::logic_error);
+}
+
+/*****************************************************************************/
+TEST_F(TestFixedSizeHashMap, copy) {
+    printemps::model::Model<int, double> model;
+
+    auto& x = model.create_variables("x", 10);
+
+    std::unordered_map<printemps::model::Variable<int, double>*, double>
+        unordered_map;
+    for (auto i = 0; i < 10; i++) {
+        unordered_map[&x(i)] = i + 1;
+    }
+
+    printemps::utility::FixedSizeHashMap<
+        printemps::model::Variable<int, double>*, double>
+        copied;
+    {
+        printemps::utility::FixedSizeHashMap<
+            printemps::model::Variable<int, double>*, double>
+            fixed_size_hash_map(
+                unordered_map, sizeof(printemps::model::Variable<int, double>));
+        copied = fixed_size_hash_map;
+    }
+
+    /// The copy is still valid after the original is destructed.
+    for (auto i = 0; i < 10; i++) {
+        EXPECT_EQ(i + 1, copied.at(&x(i)));
+    }
+
+    auto moved = std::move(copied);
+    for (auto i = 0; i < 10; i++) {
+        EXPECT_EQ(i + 1, moved.at(&x(i)));
+    }
 }
 
 /*****************************************************************************/
-TEST_F(TestFixedSizeHashMap, at) {
+TEST_F(TestFixedSizeHashMap, at_arg_key) {
     /// This method is tested in setup().
 }
 
+/*****************************************************************************/
+TEST_F(TestFixedSizeHashMap, at_arg_keys) {
+    printemps::model::Model<int, double> model;
+
+    auto& x = model.create_variables("x", 10);
+
+    std::unordered_map<printemps::model::Variable<int, double>*, double>
+        unordered_map;
+    for (auto i = 0; i < 5; i++) {
+        unordered_map[&x(i)] = i + 1;
+    }
+
+    printemps::utility::FixedSizeHashMap<
+        printemps::model::Variable<int, double>*, double>
+        fixed_size_hash_map(unordered_map,
+                            sizeof(printemps::model::Variable<int, double>));
+
+    std::vector<printemps::model::Variable<int, double>*> keys = {
+        &x(4), &x(0), &x(9), &x(2)};
+    std::vector<double> values(keys.size());
+    fixed_size_hash_map.at(values.data(), keys.data(), keys.size());
+
+    EXPECT_EQ(5, values[0]);
+    EXPECT_EQ(1, values[1]);
+    EXPECT_EQ(0, values[2]);
+    EXPECT_EQ(3, values[3]);
+}
+
+/*****************************************************************************/
+TEST_F(TestFixedSizeHashMap, prefetch) {
+    /// This method is tested in at_arg_keys().
+}
+
 /*****************************************************************************/
 TEST_F(TestFixedSizeHashMap, shift_size) {
     /// This method is tested in initialize() and setup().
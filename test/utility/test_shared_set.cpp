@@ -0,0 +1,146 @@
+/*****************************************************************************/
+// Copyright (c) 2020 Yuji KOGUMA
+// Released under the MIT license
+// https://opensource.org/licenses/mit-license.php
+/*****************************************************************************/
+#include <gtest/gtest.h>
+#include <printemps.h>
+
+namespace {
+/*****************************************************************************/
+class TestSharedSet : public ::testing::Test {
+   protected:
+    virtual void SetUp(void) {
+        /// nothing to do
+    }
+    virtual void TearDown() {
+        /// nothing to do
+    }
+};
+
+/*****************************************************************************/
+TEST_F(TestSharedSet, initialize) {
+    printemps::utility::SharedSet<int> shared_set;
+
+    EXPECT_EQ(0, shared_set.size());
+    EXPECT_EQ(true, shared_set.empty());
+    EXPECT_EQ(shared_set.begin(), shared_set.end());
+}
+
+/*****************************************************************************/
+TEST_F(TestSharedSet, constructor_arg_initializer_list) {
+    printemps::utility::SharedSet<int> shared_set = {3, 1, 2, 1};
+
+    EXPECT_EQ(3, shared_set.size());
+    EXPECT_EQ(1, shared_set.begin()[0]);
+    EXPECT_EQ(2, shared_set.begin()[1]);
+    EXPECT_EQ(3, shared_set.begin()[2]);
+}
+
+/*****************************************************************************/
+TEST_F(TestSharedSet, constructor_arg_unordered_set) {
+    std::unordered_set<int>            elements   = {3, 1, 2};
+    printemps::utility::SharedSet<int> shared_set = elements;
+
+    EXPECT_EQ(3, shared_set.size());
+    EXPECT_EQ(1, shared_set.count(1));
+    EXPECT_EQ(1, shared_set.count(2));
+    EXPECT_EQ(1, shared_set.count(3));
+}
+
+/*****************************************************************************/
+TEST_F(TestSharedSet, clear) {
+    printemps::utility::SharedSet<int> shared_set = {1, 2};
+    shared_set.clear();
+
+    EXPECT_EQ(0, shared_set.size());
+    EXPECT_EQ(true, shared_set.empty());
+}
+
+/*****************************************************************************/
+TEST_F(TestSharedSet, insert_arg_element) {
+    printemps::utility::SharedSet<int> shared_set;
+    shared_set.insert(2);
+    shared_set.insert(1);
+    shared_set.insert(2);
+
+    EXPECT_EQ(2, shared_set.size());
+    EXPECT_EQ(1, shared_set.begin()[0]);
+    EXPECT_EQ(2, shared_set.begin()[1]);
+
+    /// The copy shares the elements until either of them is modified.
+    auto copied = shared_set;
+    EXPECT_EQ(true, copied.is_shared_with(shared_set));
+
+    copied.insert(3);
+    EXPECT_EQ(false, copied.is_shared_with(shared_set));
+    EXPECT_EQ(3, copied.size());
+    EXPECT_EQ(2, shared_set.size());
+}
+
+/*****************************************************************************/
+TEST_F(TestSharedSet, insert_arg_iterators) {
+    printemps::utility::SharedSet<int> shared_set = {1, 3};
+    std::vector<int>                   elements   = {3, 2, 4};
+    shared_set.insert(elements.begin(), elements.end());
+
+    EXPECT_EQ(4, shared_set.size());
+    for (auto i = 0; i < 4; i++) {
+        EXPECT_EQ(i + 1, shared_set.begin()[i]);
+    }
+}
+
+/*****************************************************************************/
+TEST_F(TestSharedSet, find) {
+    printemps::utility::SharedSet<int> shared_set = {1, 3};
+
+    EXPECT_EQ(shared_set.begin() + 1, shared_set.find(3));
+    EXPECT_EQ(shared_set.end(), shared_set.find(2));
+}
+
+/*****************************************************************************/
+TEST_F(TestSharedSet, count) {
+    printemps::utility::SharedSet<int> shared_set = {1, 3};
+
+    EXPECT_EQ(1, shared_set.count(1));
+    EXPECT_EQ(0, shared_set.count(2));
+}
+
+/*****************************************************************************/
+TEST_F(TestSharedSet, begin) {
+    /// This method is tested in constructor_arg_initializer_list().
+}
+
+/*****************************************************************************/
+TEST_F(TestSharedSet, end) {
+    /// This method is tested in find().
+}
+
+/*****************************************************************************/
+TEST_F(TestSharedSet, size) {
+    /// This method is tested in insert_arg_element().
+}
+
+/*****************************************************************************/
+TEST_F(TestSharedSet, empty) {
+    /// This method is tested in initialize() and clear().
+}
+
+/*****************************************************************************/
+TEST_F(TestSharedSet, is_shared_with) {
+    /// This method is tested in insert_arg_element().
+}
+
+/*****************************************************************************/
+TEST_F(TestSharedSet, to_vector) {
+    printemps::utility::SharedSet<int> shared_set = {2, 1};
+
+    auto result = printemps::utility::to_vector(shared_set);
+    EXPECT_EQ(2, static_cast<int>(result.size()));
+    EXPECT_EQ(1, result[0]);
+    EXPECT_EQ(2, result[1]);
+}
+}  // namespace
+/*****************************************************************************/
+// END
+/*****************************************************************************/
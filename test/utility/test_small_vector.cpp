@@ -0,0 +1,162 @@
+/*****************************************************************************/
+// Copyright (c) 2020 Yuji KOGUMA
+// Released under the MIT license
+// https://opensource.org/licenses/mit-license.php
+/*****************************************************************************/
+#include <gtest/gtest.h>
+#include <printemps.h>
+
+namespace {
+/*****************************************************************************/
+class TestSmallVector : public ::testing::Test {
+   protected:
+    virtual void SetUp(void) {
+        /// nothing to do
+    }
+    virtual void TearDown() {
+        /// nothing to do
+    }
+};
+
+/*****************************************************************************/
+TEST_F(TestSmallVector, initialize) {
+    printemps::utility::SmallVector<int, 4> small_vector;
+
+    EXPECT_EQ(0, small_vector.size());
+    EXPECT_EQ(true, small_vector.empty());
+    EXPECT_EQ(4, small_vector.capacity());
+    EXPECT_EQ(small_vector.begin(), small_vector.end());
+}
+
+/*****************************************************************************/
+TEST_F(TestSmallVector, constructor_arg_initializer_list) {
+    printemps::utility::SmallVector<int, 2> small_vector = {1, 2, 3};
+
+    EXPECT_EQ(3, small_vector.size());
+    EXPECT_EQ(1, small_vector[0]);
+    EXPECT_EQ(2, small_vector[1]);
+    EXPECT_EQ(3, small_vector[2]);
+}
+
+/*****************************************************************************/
+TEST_F(TestSmallVector, clear) {
+    printemps::utility::SmallVector<int, 2> small_vector = {1, 2, 3};
+    small_vector.clear();
+
+    EXPECT_EQ(0, small_vector.size());
+    EXPECT_EQ(true, small_vector.empty());
+
+    /// The inline buffer is used again after clear().
+    small_vector.push_back(4);
+    EXPECT_EQ(1, small_vector.size());
+    EXPECT_EQ(4, small_vector.front());
+}
+
+/*****************************************************************************/
+TEST_F(TestSmallVector, push_back) {
+    printemps::utility::SmallVector<int, 2> small_vector;
+
+    small_vector.push_back(1);
+    small_vector.push_back(2);
+    EXPECT_EQ(2, small_vector.size());
+    EXPECT_EQ(2, small_vector.capacity());
+
+    /// The elements are moved to the heap if the size exceeds the buffer.
+    small_vector.push_back(3);
+    EXPECT_EQ(3, small_vector.size());
+    EXPECT_LE(3, small_vector.capacity());
+    EXPECT_EQ(1, small_vector[0]);
+    EXPECT_EQ(2, small_vector[1]);
+    EXPECT_EQ(3, small_vector[2]);
+
+    /// The copy keeps the elements.
+    auto copied = small_vector;
+    EXPECT_EQ(3, copied.size());
+    EXPECT_EQ(1, copied[0]);
+    EXPECT_EQ(2, copied[1]);
+    EXPECT_EQ(3, copied[2]);
+}
+
+/*****************************************************************************/
+TEST_F(TestSmallVector, emplace_back) {
+    printemps::utility::SmallVector<std::pair<int, double>, 2> small_vector;
+
+    small_vector.emplace_back(1, 0.5);
+    EXPECT_EQ(1, small_vector.size());
+    EXPECT_EQ(1, small_vector.front().first);
+    EXPECT_EQ(0.5, small_vector.front().second);
+}
+
+/*****************************************************************************/
+TEST_F(TestSmallVector, insert) {
+    printemps::utility::SmallVector<int, 2> small_vector = {1};
+    std::vector<int>                        elements     = {2, 3};
+
+    small_vector.insert(small_vector.end(), elements.begin(), elements.end());
+    EXPECT_EQ(3, small_vector.size());
+    EXPECT_EQ(1, small_vector[0]);
+    EXPECT_EQ(2, small_vector[1]);
+    EXPECT_EQ(3, small_vector[2]);
+
+    ASSERT_THROW(small_vector.insert(small_vector.begin(), elements.begin(),
+                                     elements.end()),
+                 std::logic_error);
+}
+
+/*****************************************************************************/
+TEST_F(TestSmallVector, data) {
+    /// This method is tested in begin() and end().
+}
+
+/*****************************************************************************/
+TEST_F(TestSmallVector, begin) {
+    printemps::utility::SmallVector<int, 2> small_vector = {1, 2, 3};
+
+    int sum = 0;
+    for (const auto& element : small_vector) {
+        sum += element;
+    }
+    EXPECT_EQ(6, sum);
+    EXPECT_EQ(3, small_vector.end() - small_vector.begin());
+}
+
+/*****************************************************************************/
+TEST_F(TestSmallVector, end) {
+    /// This method is tested in begin().
+}
+
+/*****************************************************************************/
+TEST_F(TestSmallVector, operator_square_bracket) {
+    /// This method is tested in push_back().
+}
+
+/*****************************************************************************/
+TEST_F(TestSmallVector, front) {
+    printemps::utility::SmallVector<int, 2> small_vector = {1, 2, 3};
+    EXPECT_EQ(1, small_vector.front());
+}
+
+/*****************************************************************************/
+TEST_F(TestSmallVector, back) {
+    printemps::utility::SmallVector<int, 2> small_vector = {1, 2, 3};
+    EXPECT_EQ(3, small_vector.back());
+}
+
+/*****************************************************************************/
+TEST_F(TestSmallVector, size) {
+    /// This method is tested in push_back().
+}
+
+/*****************************************************************************/
+TEST_F(TestSmallVector, empty) {
+    /// This method is tested in initialize() and clear().
+}
+
+/*****************************************************************************/
+TEST_F(TestSmallVector, capacity) {
+    /// This method is tested in push_back().
+}
+}  // namespace
+/*****************************************************************************/
+// END
+/*****************************************************************************/
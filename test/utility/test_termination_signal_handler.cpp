@@ -0,0 +1,76 @@
+/*****************************************************************************/
+// Copyright (c) 2020 Yuji KOGUMA
+// Released under the MIT license
+// https://opensource.org/licenses/mit-license.php
+/*****************************************************************************/
+#include <gtest/gtest.h>
+#include <csignal>
+
+#include <printemps.h>
+
+namespace {
+/*****************************************************************************/
+class TestTerminationSignalHandler : public ::testing::Test {
+   protected:
+    virtual void SetUp(void) {
+        /// nothing to do
+    }
+    virtual void TearDown() {
+        /// nothing to do
+    }
+};
+
+/*****************************************************************************/
+TEST_F(TestTerminationSignalHandler, initialize) {
+    printemps::utility::TerminationSignalHandler handler;
+    EXPECT_EQ(false, handler.is_installed());
+}
+
+/*****************************************************************************/
+TEST_F(TestTerminationSignalHandler, install) {
+    using Handler_T = printemps::utility::TerminationSignalHandler;
+    Handler_T handler;
+    handler.install();
+    EXPECT_EQ(true, handler.is_installed());
+    EXPECT_EQ(false, Handler_T::is_received());
+
+    std::raise(SIGTERM);
+    EXPECT_EQ(true, Handler_T::is_received());
+
+    /// The flag is reset by the next installation.
+    handler.restore();
+    handler.install();
+    EXPECT_EQ(false, Handler_T::is_received());
+    handler.restore();
+}
+
+/*****************************************************************************/
+TEST_F(TestTerminationSignalHandler, restore) {
+    using Handler_T = printemps::utility::TerminationSignalHandler;
+    Handler_T handler;
+    handler.install();
+    handler.restore();
+    EXPECT_EQ(false, handler.is_installed());
+    EXPECT_EQ(SIG_DFL, std::signal(SIGTERM, SIG_DFL));
+
+    /// The flag is cleared by the restoration.
+    handler.install();
+    std::raise(SIGTERM);
+    EXPECT_EQ(true, Handler_T::is_received());
+    handler.restore();
+    EXPECT_EQ(false, Handler_T::is_received());
+}
+
+/*****************************************************************************/
+TEST_F(TestTerminationSignalHandler, is_installed) {
+    /// This method is tested in install().
+}
+
+/*****************************************************************************/
+TEST_F(TestTerminationSignalHandler, is_received) {
+    /// This method is tested in install().
+}
+}  // namespace
+/*****************************************************************************/
+// END
+/*****************************************************************************/
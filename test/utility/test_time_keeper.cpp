@@ -0,0 +1,81 @@
+/*****************************************************************************/
+// Copyright (c) 2020 Yuji KOGUMA
+// Released under the MIT license
+// https://opensource.org/licenses/mit-license.php
+/*****************************************************************************/
+#include <gtest/gtest.h>
+#include <thread>
+#include <chrono>
+
+#include <printemps.h>
+
+namespace {
+/*****************************************************************************/
+class TestTimeKeeper : public ::testing::Test {
+   protected:
+    virtual void SetUp(void) {
+        /// nothing to do
+    }
+    virtual void TearDown() {
+        /// nothing to do
+    }
+};
+
+/*****************************************************************************/
+TEST_F(TestTimeKeeper, initialize) {
+    printemps::utility::TimeKeeper time_keeper;
+
+    EXPECT_EQ(0.0, time_keeper.elapsed_time());
+    EXPECT_EQ(0.0, time_keeper.elapsed_cpu_time());
+}
+
+/*****************************************************************************/
+TEST_F(TestTimeKeeper, setup) {
+    printemps::utility::TimeKeeper time_keeper;
+
+    std::this_thread::sleep_for(std::chrono::milliseconds(20));
+    time_keeper.clock();
+    EXPECT_LE(0.02, time_keeper.elapsed_time());
+
+    time_keeper.setup();
+    EXPECT_EQ(0.0, time_keeper.elapsed_time());
+    EXPECT_GT(0.02, time_keeper.clock());
+}
+
+/*****************************************************************************/
+TEST_F(TestTimeKeeper, clock) {
+    printemps::utility::TimeKeeper time_keeper;
+
+    /**
+     * The wall-clock time elapses while the thread sleeps, whereas the CPU
+     * time hardly does.
+     */
+    std::this_thread::sleep_for(std::chrono::milliseconds(50));
+    double elapsed_time = time_keeper.clock();
+    EXPECT_LE(0.05, elapsed_time);
+    EXPECT_EQ(elapsed_time, time_keeper.elapsed_time());
+    EXPECT_GT(0.05, time_keeper.cpu_clock());
+}
+
+/*****************************************************************************/
+TEST_F(TestTimeKeeper, cpu_clock) {
+    printemps::utility::TimeKeeper time_keeper;
+
+    double elapsed_cpu_time = time_keeper.cpu_clock();
+    EXPECT_LE(0.0, elapsed_cpu_time);
+    EXPECT_EQ(elapsed_cpu_time, time_keeper.elapsed_cpu_time());
+}
+
+/*****************************************************************************/
+TEST_F(TestTimeKeeper, elapsed_time) {
+    /// This method is tested in clock().
+}
+
+/*****************************************************************************/
+TEST_F(TestTimeKeeper, elapsed_cpu_time) {
+    /// This method is tested in cpu_clock().
+}
+}  // namespace
+/*****************************************************************************/
+// END
+/*****************************************************************************/